@@ -0,0 +1,6111 @@
+.intel_syntax noprefix
+.text
+.globl _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE PTR [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE PTR [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+strlen_sse2:
+mov rax, rdi
+and rax, -16
+mov rcx, rdi
+and ecx, 15
+pxor xmm0, xmm0
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+shr edx, cl
+test edx, edx
+jnz .head
+.loop:
+add rax, 16
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+test edx, edx
+jz .loop
+bsf edx, edx
+add rax, rdx
+sub rax, rdi
+ret
+.head:
+bsf eax, edx
+ret
+_start:
+mov rdi, [rsp]
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax
+call main
+mov rax, 60
+mov rdi, 0
+syscall
+ret
+v13:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L0:
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L1
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L0
+L1:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v16:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L2:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L3
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L4
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L5
+L4:
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L6
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L6:
+L5:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L2
+L3:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v17:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L7:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L8
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L7
+L8:
+add rsp, 32
+pop rbp
+ret
+v19:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L9:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L10
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L9
+L10:
+L11:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L12
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L11
+L12:
+add rsp, 40
+pop rbp
+ret
+v22:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L13:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L14
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L15
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L15:
+jmp L13
+L14:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v23:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+pop rdi
+call v22
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L16
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v228]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+mul rbx
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L16:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L17:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L18
+push QWORD PTR [rbp-8]
+push QWORD PTR [v228]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-56]
+mov rax, OFFSET str0
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v228]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L17
+L18:
+add rsp, 56
+pop rbp
+ret
+v25:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 47
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 58
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v26:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 48
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 49
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v27:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v25
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 96
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 103
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 71
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v30:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 91
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L19
+lea rax, [rbp-8]
+push rax
+mov rax, 32
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L19:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v31:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 10
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L20
+mov rax, 2
+push rax
+mov rax, OFFSET str1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L21
+lea rax, [rbp-32]
+push rax
+mov rax, 16
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L22:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-56]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L23
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v30
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+pop rdi
+call v25
+push rax
+pop rax
+test rax, rax
+jz L24
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L25
+L24:
+push QWORD PTR [rbp-72]
+pop rdi
+call v27
+push rax
+pop rax
+test rax, rax
+jz L26
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 10
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 97
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L27
+L26:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v242]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L28
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v152]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L28:
+L27:
+L25:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L22
+L23:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L29
+L21:
+mov rax, 2
+push rax
+mov rax, OFFSET str2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L30
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L31:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L32
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v30
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+pop rdi
+call v26
+push rax
+pop rax
+test rax, rax
+jz L33
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L34
+L33:
+push QWORD PTR [rbp-80]
+push QWORD PTR [v242]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L35
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v152]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L35:
+L34:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L31
+L32:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L30:
+L29:
+L20:
+push QWORD PTR [rbp-48]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L36
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L37:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L38
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v242]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L39
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-88]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L39:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L37
+L38:
+L36:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v34:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v36:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD PTR [v266]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v37:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L40
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L41
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v34
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L42
+L41:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L43
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L44
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L45
+L44:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L45:
+L43:
+L42:
+L40:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v38:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L46
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v37
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L46:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v39:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v22
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L47
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v23
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L48
+L47:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L49
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L50
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v23
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L51
+L50:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v23
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L51:
+L49:
+L48:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v40:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L52
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v287]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L53
+L52:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L54
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v287]
+pop rbx
+pop rax
+mov [rax], rbx
+L54:
+L53:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v42:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L55
+push QWORD PTR [v150]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v151]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L56
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L57
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v150]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+mov rax, OFFSET v150
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v150]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L57:
+jmp L58
+L56:
+L58:
+L55:
+add rsp, 16
+pop rbp
+ret
+v47:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v324]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v48:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v325]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+add rsp, 32
+pop rbp
+ret
+v49:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v326]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v50:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v329]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v52:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v384]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v57:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+mov [rbp-48], r9
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v333]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 48
+pop rbp
+ret
+v58:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v349]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+syscall
+push rax
+pop rax
+add rsp, 40
+pop rbp
+ret
+v59:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v335]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v60:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v383]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v61:
+push rbp
+mov rbp, rsp
+push QWORD PTR [v381]
+pop rax
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v62:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v385]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v64:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 127
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v67:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v407]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v68:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [v750]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v47
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L59:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L60
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v750]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v47
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L59
+L60:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v70:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-160], rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v50
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L61
+lea rax, [rbp-160]
+push rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [v683]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L61:
+push QWORD PTR [rbp-160]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v71:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v750]
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+mov rax, 34
+push rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v57
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L62
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+L62:
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L63:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L64
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L65
+push QWORD PTR [v9]
+push QWORD PTR [v653]
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v58
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L66
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v59
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L67
+L66:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L67:
+L65:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L68
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v47
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L69
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L69:
+L68:
+jmp L63
+L64:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L70
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [v9]
+mov rax, 0
+push rax
+push QWORD PTR [v749]
+push QWORD PTR [rbp-32]
+push QWORD PTR [v749]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v749]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v58
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L70:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v76:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v152]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L71
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L71:
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L72:
+push QWORD PTR [rbp-80]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L73
+push QWORD PTR [rbp-48]
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L74
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L75
+L74:
+push QWORD PTR [rbp-96]
+mov rax, 92
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L76
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 116
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L77
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v120]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L78
+L77:
+push QWORD PTR [rbp-96]
+mov rax, 98
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L79
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v119]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L80
+L79:
+push QWORD PTR [rbp-96]
+mov rax, 110
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L81
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v121]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L82
+L81:
+push QWORD PTR [rbp-96]
+mov rax, 114
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L83
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v124]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L84
+L83:
+push QWORD PTR [rbp-96]
+mov rax, 102
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L85
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v123]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L86
+L85:
+push QWORD PTR [rbp-96]
+mov rax, 39
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L87
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov rax, 39
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L87:
+L86:
+L84:
+L82:
+L80:
+L78:
+jmp L88
+L76:
+push QWORD PTR [rbp-96]
+mov rax, 37
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L89
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L90
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v38
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L91
+L90:
+push QWORD PTR [rbp-96]
+mov rax, 99
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L92
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L93
+L92:
+push QWORD PTR [rbp-96]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L94
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L95
+L94:
+push QWORD PTR [rbp-96]
+mov rax, 105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L96
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L97
+L96:
+push QWORD PTR [rbp-96]
+mov rax, 42
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L98
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L99
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v37
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L100
+L99:
+L100:
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L101
+L98:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L101:
+L97:
+L95:
+L93:
+L91:
+jmp L102
+L89:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L102:
+L88:
+L75:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L103
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v36
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L103:
+jmp L72
+L73:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L104
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L104:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 112
+pop rbp
+ret
+v77:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov eax, [v154]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v80:
+push rbp
+mov rbp, rsp
+sub rsp, 1056
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-1048], al
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rax, 1024
+push rax
+lea rax, [rbp-1048]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-1056], rax
+push QWORD PTR [rbp-1056]
+lea rax, [rbp-1048]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v48
+add rsp, 1056
+pop rbp
+ret
+v82:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v311]
+pop rdi
+pop rsi
+pop rdx
+call v80
+add rsp, 16
+pop rbp
+ret
+v89:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L105
+lea rax, [rbp-16]
+push rax
+mov rax, OFFSET str3
+push rax
+push QWORD PTR [v312]
+pop rdi
+pop rsi
+pop rdx
+call v80
+mov rax, 1
+push rax
+pop rdi
+call v52
+L105:
+add rsp, 16
+pop rbp
+ret
+v92:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 16
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L106:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v843]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L107
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v846
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L108
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L108:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L106
+L107:
+mov rax, OFFSET str4
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v841]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v89
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L109:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v844]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L110
+L111:
+mov rax, OFFSET v846
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [v842]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L112
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L111
+L112:
+mov rax, OFFSET v847
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L109
+L110:
+mov rax, OFFSET v851
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v93:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, OFFSET v847
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 15
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v842]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v94:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+push QWORD PTR [v851]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L113
+call v92
+L113:
+push QWORD PTR [rbp-8]
+pop rdi
+call v93
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, OFFSET v846
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v848
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L114
+mov rax, OFFSET v848
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+call v17
+jmp L115
+L114:
+mov rax, OFFSET v849
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v850
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L116
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+push QWORD PTR [v845]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v57
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v850
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [v845]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L116:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L117
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v849
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L117:
+L115:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v95:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+pop rdi
+call v93
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v848
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v848
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v96:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L118
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v841]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L119
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v59
+jmp L120
+L119:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v95
+L120:
+L118:
+add rsp, 16
+pop rbp
+ret
+v97:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v841]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L121
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-16]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v57
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L122
+L121:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v94
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L122:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L123
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L123:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v98:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v841]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v841]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L124
+push QWORD PTR [v653]
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-40]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v58
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L125
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L125:
+jmp L126
+L124:
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v841]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [v841]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L127
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+call v93
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+call v93
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L128
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+L128:
+L127:
+L126:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L129
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v97
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L130
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L131
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+L131:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-8]
+pop rdi
+call v96
+L130:
+L129:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v100:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [v890]
+push QWORD PTR [v888]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L132
+lea rax, [rbp-8]
+push rax
+mov rax, OFFSET v889
+push rax
+mov rax, 24
+push rax
+push QWORD PTR [v890]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v890
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v890]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L132:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v101:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+call v100
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L133
+push QWORD PTR [rbp-16]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+L133:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v102:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L134:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L135
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L136
+push QWORD PTR [rbp-16]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L137
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L138
+L137:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L138:
+jmp L139
+L136:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L139:
+jmp L134
+L135:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v103:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L140
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L141
+L140:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L142
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L143
+L142:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L144
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v103
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L145
+L144:
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v103
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L145:
+L143:
+L141:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v104:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L146
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v101
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L147
+L146:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L148
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v104
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L149
+L148:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L150
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v104
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L150:
+L149:
+L147:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v105:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L151
+push QWORD PTR [rbp-8]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L152
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v105
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L153
+L152:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L154
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v105
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L155
+L154:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L156
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L157
+L156:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L158
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L159
+L158:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L160
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L161
+L160:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v102
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v105
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L161:
+L159:
+L157:
+L155:
+L153:
+L151:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v106:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L162
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v106
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v106
+L162:
+add rsp, 16
+pop rbp
+ret
+v107:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L163
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L164:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L165
+push QWORD PTR [v9]
+mov rax, OFFSET str5
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v80
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L164
+L165:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-40]
+push rax
+mov rax, OFFSET str6
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v80
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v107
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v107
+L163:
+add rsp, 40
+pop rbp
+ret
+v109:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L166
+push QWORD PTR [rbp-8]
+push QWORD PTR [v886]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v884]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v109
+lea rax, [rbp-24]
+push rax
+mov rax, OFFSET str7
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v80
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v109
+L166:
+add rsp, 24
+pop rbp
+ret
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov rax, OFFSET v890
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 5
+push rax
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 4
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 7
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 6
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 5
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-8]
+pop rdi
+call v106
+push QWORD PTR [v311]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v109
+add rsp, 72
+pop rbp
+ret
+.data
+str0: .byte 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 97, 98, 99, 100, 101, 102, 0
+str1: .byte 48, 120, 0
+str2: .byte 48, 98, 0
+str3: .byte 91, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 93, 58, 32, 37, 115, 0
+str4: .byte 109, 101, 109, 111, 114, 121, 95, 105, 110, 105, 116, 58, 32, 115, 105, 122, 101, 32, 99, 108, 97, 115, 115, 101, 115, 32, 100, 111, 32, 110, 111, 116, 32, 101, 110, 100, 32, 97, 116, 32, 77, 69, 77, 79, 82, 89, 95, 83, 77, 65, 76, 76, 95, 77, 65, 88, 10, 0
+str5: .byte 32, 32, 0
+str6: .byte 37, 100, 10, 0
+str7: .byte 37, 100, 10, 0
+v7: .quad 15819268900350807916
+v8: .quad 0
+v9: .quad 0
+v111: .byte 0
+v112: .byte 1
+v113: .byte 2
+v114: .byte 3
+v115: .byte 4
+v116: .byte 5
+v117: .byte 6
+v118: .byte 7
+v119: .byte 8
+v120: .byte 9
+v121: .byte 10
+v122: .byte 11
+v123: .byte 12
+v124: .byte 13
+v125: .byte 14
+v126: .byte 15
+v127: .byte 16
+v128: .byte 17
+v129: .byte 18
+v130: .byte 19
+v131: .byte 20
+v132: .byte 21
+v133: .byte 22
+v134: .byte 23
+v135: .byte 24
+v136: .byte 25
+v137: .byte 26
+v138: .byte 27
+v139: .byte 28
+v140: .byte 29
+v141: .byte 30
+v142: .byte 31
+v143: .quad 0
+v144: .quad 1
+v145: .quad 18446744073709551614
+v146: .quad 0
+v147: .quad 1
+v148: .quad 1048576
+v152: .quad 18446744073709551615
+v153: .quad 9223372036854775807
+v154: .long 4294967295
+v155: .long 2147483647
+v156: .word 65535
+v157: .word 32767
+v158: .byte 255
+v159: .byte 127
+v160: .quad 18446744073709551615
+v161: .quad 9223372036854775807
+v162: .long 4294967295
+v163: .long 2147483647
+v164: .word 65535
+v165: .word 32767
+v166: .byte 255
+v167: .byte 127
+v168: .quad 18446744073709551615
+v169: .quad 512
+v170: .quad 0
+v171: .quad 8
+v222: .quad 10
+v228: .quad 10
+v235: .quad 20
+v242: .quad 95
+v266: .quad 1
+v287: .quad 1
+v293: .quad 32
+v307: .quad 0
+v308: .quad 8
+v310: .quad 0
+v311: .quad 1
+v312: .quad 2
+v313: .quad 0
+v314: .quad 1
+v315: .quad 2
+v316: .quad 3
+v317: .quad 4
+v318: .quad 5
+v319: .quad 6
+v320: .quad 7
+v321: .quad 8
+v322: .quad 9
+v323: .quad 11
+v324: .quad 0
+v325: .quad 1
+v326: .quad 2
+v327: .quad 3
+v328: .quad 4
+v329: .quad 5
+v330: .quad 6
+v331: .quad 7
+v332: .quad 8
+v333: .quad 9
+v334: .quad 10
+v335: .quad 11
+v336: .quad 12
+v337: .quad 13
+v338: .quad 14
+v339: .quad 15
+v340: .quad 16
+v341: .quad 17
+v342: .quad 18
+v343: .quad 19
+v344: .quad 20
+v345: .quad 21
+v346: .quad 22
+v347: .quad 23
+v348: .quad 24
+v349: .quad 25
+v350: .quad 26
+v351: .quad 27
+v352: .quad 28
+v353: .quad 29
+v354: .quad 30
+v355: .quad 31
+v356: .quad 32
+v357: .quad 33
+v358: .quad 34
+v359: .quad 35
+v360: .quad 36
+v361: .quad 37
+v362: .quad 38
+v363: .quad 39
+v364: .quad 40
+v365: .quad 41
+v366: .quad 42
+v367: .quad 43
+v368: .quad 44
+v369: .quad 45
+v370: .quad 46
+v371: .quad 47
+v372: .quad 48
+v373: .quad 49
+v374: .quad 50
+v375: .quad 51
+v376: .quad 52
+v377: .quad 53
+v378: .quad 54
+v379: .quad 55
+v380: .quad 56
+v381: .quad 57
+v382: .quad 58
+v383: .quad 59
+v384: .quad 60
+v385: .quad 61
+v386: .quad 62
+v387: .quad 63
+v388: .quad 64
+v389: .quad 65
+v390: .quad 66
+v391: .quad 67
+v392: .quad 68
+v393: .quad 69
+v394: .quad 70
+v395: .quad 71
+v396: .quad 72
+v397: .quad 73
+v398: .quad 74
+v399: .quad 75
+v400: .quad 76
+v401: .quad 77
+v402: .quad 78
+v403: .quad 79
+v404: .quad 80
+v405: .quad 81
+v406: .quad 82
+v407: .quad 83
+v408: .quad 84
+v409: .quad 85
+v410: .quad 86
+v411: .quad 87
+v412: .quad 88
+v413: .quad 89
+v414: .quad 90
+v415: .quad 91
+v416: .quad 92
+v417: .quad 93
+v418: .quad 94
+v419: .quad 95
+v420: .quad 96
+v421: .quad 97
+v422: .quad 98
+v423: .quad 99
+v424: .quad 100
+v425: .quad 101
+v426: .quad 102
+v427: .quad 103
+v428: .quad 104
+v429: .quad 105
+v430: .quad 106
+v431: .quad 107
+v432: .quad 108
+v433: .quad 109
+v434: .quad 110
+v435: .quad 111
+v436: .quad 112
+v437: .quad 113
+v438: .quad 114
+v439: .quad 115
+v440: .quad 116
+v441: .quad 117
+v442: .quad 118
+v443: .quad 119
+v444: .quad 120
+v445: .quad 121
+v446: .quad 122
+v447: .quad 123
+v448: .quad 124
+v449: .quad 125
+v450: .quad 126
+v451: .quad 127
+v452: .quad 128
+v453: .quad 129
+v454: .quad 130
+v455: .quad 131
+v456: .quad 132
+v457: .quad 133
+v458: .quad 134
+v459: .quad 135
+v460: .quad 136
+v461: .quad 137
+v462: .quad 138
+v463: .quad 139
+v464: .quad 140
+v465: .quad 141
+v466: .quad 142
+v467: .quad 143
+v468: .quad 144
+v469: .quad 145
+v470: .quad 146
+v471: .quad 147
+v472: .quad 148
+v473: .quad 149
+v474: .quad 150
+v475: .quad 151
+v476: .quad 152
+v477: .quad 153
+v478: .quad 154
+v479: .quad 155
+v480: .quad 156
+v481: .quad 157
+v482: .quad 158
+v483: .quad 159
+v484: .quad 160
+v485: .quad 161
+v486: .quad 162
+v487: .quad 163
+v488: .quad 164
+v489: .quad 165
+v490: .quad 166
+v491: .quad 167
+v492: .quad 168
+v493: .quad 169
+v494: .quad 170
+v495: .quad 171
+v496: .quad 172
+v497: .quad 173
+v498: .quad 174
+v499: .quad 175
+v500: .quad 176
+v501: .quad 177
+v502: .quad 178
+v503: .quad 179
+v504: .quad 180
+v505: .quad 181
+v506: .quad 182
+v507: .quad 183
+v508: .quad 184
+v509: .quad 185
+v510: .quad 186
+v511: .quad 187
+v512: .quad 188
+v513: .quad 189
+v514: .quad 190
+v515: .quad 191
+v516: .quad 192
+v517: .quad 193
+v518: .quad 194
+v519: .quad 195
+v520: .quad 196
+v521: .quad 197
+v522: .quad 198
+v523: .quad 199
+v524: .quad 200
+v525: .quad 201
+v526: .quad 202
+v527: .quad 203
+v528: .quad 204
+v529: .quad 205
+v530: .quad 206
+v531: .quad 207
+v532: .quad 208
+v533: .quad 209
+v534: .quad 210
+v535: .quad 211
+v536: .quad 212
+v537: .quad 213
+v538: .quad 214
+v539: .quad 215
+v540: .quad 216
+v541: .quad 217
+v542: .quad 218
+v543: .quad 219
+v544: .quad 220
+v545: .quad 221
+v546: .quad 222
+v547: .quad 223
+v548: .quad 224
+v549: .quad 225
+v550: .quad 226
+v551: .quad 227
+v552: .quad 228
+v553: .quad 229
+v554: .quad 230
+v555: .quad 231
+v556: .quad 232
+v557: .quad 233
+v558: .quad 234
+v559: .quad 235
+v560: .quad 236
+v561: .quad 237
+v562: .quad 238
+v563: .quad 239
+v564: .quad 240
+v565: .quad 241
+v566: .quad 242
+v567: .quad 243
+v568: .quad 244
+v569: .quad 245
+v570: .quad 246
+v571: .quad 247
+v572: .quad 248
+v573: .quad 249
+v574: .quad 250
+v575: .quad 251
+v576: .quad 252
+v577: .quad 253
+v578: .quad 254
+v579: .quad 255
+v580: .quad 256
+v581: .quad 257
+v582: .quad 258
+v583: .quad 259
+v584: .quad 260
+v585: .quad 261
+v586: .quad 262
+v587: .quad 263
+v588: .quad 264
+v589: .quad 265
+v590: .quad 266
+v591: .quad 267
+v592: .quad 268
+v593: .quad 269
+v594: .quad 270
+v595: .quad 271
+v596: .quad 272
+v597: .quad 273
+v598: .quad 274
+v599: .quad 275
+v600: .quad 276
+v601: .quad 277
+v602: .quad 278
+v603: .quad 279
+v604: .quad 280
+v605: .quad 281
+v606: .quad 282
+v607: .quad 283
+v608: .quad 284
+v609: .quad 285
+v610: .quad 286
+v611: .quad 287
+v612: .quad 288
+v613: .quad 289
+v614: .quad 290
+v615: .quad 291
+v616: .quad 292
+v617: .quad 293
+v618: .quad 294
+v619: .quad 295
+v620: .quad 296
+v621: .quad 297
+v622: .quad 298
+v623: .quad 299
+v624: .quad 300
+v625: .quad 301
+v626: .quad 302
+v627: .quad 303
+v628: .quad 304
+v629: .quad 305
+v630: .quad 306
+v631: .quad 307
+v632: .quad 308
+v633: .quad 309
+v634: .quad 310
+v635: .quad 311
+v636: .quad 312
+v637: .quad 313
+v638: .quad 0
+v639: .quad 1
+v640: .quad 64
+v641: .quad 512
+v642: .quad 0
+v643: .quad 1
+v644: .quad 2
+v645: .quad 4
+v646: .quad 16777216
+v647: .quad 33554432
+v648: .quad 1
+v649: .quad 2
+v650: .quad 16
+v651: .quad 32
+v652: .quad 32
+v653: .quad 1
+v654: .quad 2
+v655: .quad 4
+v656: .quad 1
+v657: .quad 2
+v658: .quad 3
+v659: .quad 4
+v660: .quad 5
+v661: .quad 6
+v662: .quad 10
+v663: .quad 2
+v664: .quad 0
+v665: .quad 0
+v666: .quad 2
+v668: .quad 0
+v670: .quad 0
+v671: .quad 2
+v672: .quad 4
+v673: .quad 8
+v675: .quad 0
+v676: .quad 8
+v677: .quad 16
+v678: .quad 24
+v679: .quad 28
+v680: .quad 32
+v681: .quad 36
+v682: .quad 40
+v683: .quad 48
+v684: .quad 56
+v685: .quad 64
+v686: .quad 72
+v687: .quad 88
+v688: .quad 104
+v689: .quad 120
+v748: .quad 1024
+v749: .quad 4096
+v750: .quad 65536
+v841: .quad 2048
+v842: .quad 4
+v843: .quad 24
+v844: .quad 129
+v845: .quad 65536
+v884: .quad 0
+v885: .quad 8
+v886: .quad 16
+v888: .quad 1024
+.bss
+v149: .zero 1048576
+v150: .zero 8
+v151: .zero 8
+v172: .zero 16
+v309: .zero 16
+v667: .zero 16
+v669: .zero 4
+v674: .zero 16
+v690: .zero 144
+v846: .zero 192
+v847: .zero 129
+v848: .zero 192
+v849: .zero 192
+v850: .zero 192
+v851: .zero 8
+v887: .zero 24
+v889: .zero 24576
+v890: .zero 8
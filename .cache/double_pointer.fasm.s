@@ -0,0 +1,122 @@
+.intel_syntax noprefix
+.text
+.globl _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE PTR [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE PTR [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+strlen_sse2:
+mov rax, rdi
+and rax, -16
+mov rcx, rdi
+and ecx, 15
+pxor xmm0, xmm0
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+shr edx, cl
+test edx, edx
+jnz .head
+.loop:
+add rax, 16
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+test edx, edx
+jz .loop
+bsf edx, edx
+add rax, rdx
+sub rax, rdi
+ret
+.head:
+bsf eax, edx
+ret
+_start:
+mov rdi, [rsp]
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax
+call main
+mov rax, 60
+mov rdi, 0
+syscall
+ret
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+lea rax, [rbp-8]
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+mov rax, 12
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rdi
+call print
+add rsp, 32
+pop rbp
+ret
+.data
+v7: .quad 8940760783898902717
+v8: .quad 0
+v9: .quad 0
+.bss
@@ -0,0 +1,3381 @@
+.intel_syntax noprefix
+.text
+.globl _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE PTR [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE PTR [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+_start:
+mov rdi, [rsp]
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax
+call main
+mov rax, 60
+mov rdi, 0
+syscall
+ret
+v13:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L0:
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L1
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L0
+L1:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v16:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L2:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L3
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L4
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L5
+L4:
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L6
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L6:
+L5:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L2
+L3:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v20:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L7:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L8
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L7
+L8:
+add rsp, 32
+pop rbp
+ret
+v21:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L9:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L10
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L11
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L11:
+jmp L9
+L10:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v22:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+pop rdi
+call v21
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L12
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v201]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+mul rbx
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L12:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L13:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L14
+push QWORD PTR [rbp-8]
+push QWORD PTR [v201]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-56]
+mov rax, OFFSET str0
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v201]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L13
+L14:
+add rsp, 56
+pop rbp
+ret
+v24:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 47
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 58
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v25:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 48
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 49
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v26:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v24
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 96
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 103
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 71
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v29:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 91
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L15
+lea rax, [rbp-8]
+push rax
+mov rax, 32
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L15:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v30:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 10
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L16
+mov rax, 2
+push rax
+mov rax, OFFSET str1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L17
+lea rax, [rbp-32]
+push rax
+mov rax, 16
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L18:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-56]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L19
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v29
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+pop rdi
+call v24
+push rax
+pop rax
+test rax, rax
+jz L20
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L21
+L20:
+push QWORD PTR [rbp-72]
+pop rdi
+call v26
+push rax
+pop rax
+test rax, rax
+jz L22
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 10
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 97
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L23
+L22:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v215]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L24
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v132]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L24:
+L23:
+L21:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L18
+L19:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L25
+L17:
+mov rax, 2
+push rax
+mov rax, OFFSET str2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L26
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L27:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L28
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v29
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+pop rdi
+call v25
+push rax
+pop rax
+test rax, rax
+jz L29
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L30
+L29:
+push QWORD PTR [rbp-80]
+push QWORD PTR [v215]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L31
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v132]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L31:
+L30:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L27
+L28:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L26:
+L25:
+L16:
+push QWORD PTR [rbp-48]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L32
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L33:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L34
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v215]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L35
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-88]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L35:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L33
+L34:
+L32:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v33:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v20
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v35:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v239]
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v20
+push QWORD PTR [v239]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v36:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L36
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L37
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v33
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L38
+L37:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L39
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L40
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v20
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L41
+L40:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v20
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L41:
+L39:
+L38:
+L36:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v37:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L42
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v13
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v36
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L42:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v38:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v21
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L43
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v22
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L44
+L43:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L45
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L46
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v22
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L47
+L46:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v22
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L47:
+L45:
+L44:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v39:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L48
+push QWORD PTR [v260]
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v20
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v260]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L49
+L48:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L50
+push QWORD PTR [v260]
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v20
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v260]
+pop rbx
+pop rax
+mov [rax], rbx
+L50:
+L49:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v41:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L51
+push QWORD PTR [v130]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v131]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L52
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L53
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v130]
+pop rdi
+pop rsi
+pop rdx
+call v20
+mov rax, OFFSET v130
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v130]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L53:
+jmp L54
+L52:
+L54:
+L51:
+add rsp, 16
+pop rbp
+ret
+v46:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v297]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v47:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v298]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+add rsp, 32
+pop rbp
+ret
+v48:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v299]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v50:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v357]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v55:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+mov [rbp-48], r9
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v306]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 48
+pop rbp
+ret
+v56:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v322]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+syscall
+push rax
+pop rax
+add rsp, 40
+pop rbp
+ret
+v57:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v308]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v58:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v356]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v59:
+push rbp
+mov rbp, rsp
+push QWORD PTR [v354]
+pop rax
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v60:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v358]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v62:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 127
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v65:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v380]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v70:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v132]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L55
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L55:
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L56:
+push QWORD PTR [rbp-80]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L57
+push QWORD PTR [rbp-48]
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L58
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L59
+L58:
+push QWORD PTR [rbp-96]
+mov rax, 92
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L60
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 116
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L61
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v100]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L62
+L61:
+push QWORD PTR [rbp-96]
+mov rax, 98
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L63
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v99]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L64
+L63:
+push QWORD PTR [rbp-96]
+mov rax, 110
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L65
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v101]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L66
+L65:
+push QWORD PTR [rbp-96]
+mov rax, 114
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L67
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v104]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L68
+L67:
+push QWORD PTR [rbp-96]
+mov rax, 102
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L69
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v103]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L70
+L69:
+push QWORD PTR [rbp-96]
+mov rax, 39
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L71
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov rax, 39
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L71:
+L70:
+L68:
+L66:
+L64:
+L62:
+jmp L72
+L60:
+push QWORD PTR [rbp-96]
+mov rax, 37
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L73
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L74
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v37
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L75
+L74:
+push QWORD PTR [rbp-96]
+mov rax, 99
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L76
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L77
+L76:
+push QWORD PTR [rbp-96]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L78
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v38
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L79
+L78:
+push QWORD PTR [rbp-96]
+mov rax, 105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L80
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v38
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L81
+L80:
+push QWORD PTR [rbp-96]
+mov rax, 42
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L82
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L83
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v36
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L84
+L83:
+L84:
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L85
+L82:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L85:
+L81:
+L79:
+L77:
+L75:
+jmp L86
+L73:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L86:
+L72:
+L59:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L87
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v35
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L87:
+jmp L56
+L57:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L88
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L88:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 112
+pop rbp
+ret
+v71:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov eax, [v134]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v70
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v74:
+push rbp
+mov rbp, rsp
+sub rsp, 1056
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-1048], al
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rax, 1024
+push rax
+lea rax, [rbp-1048]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v70
+push rax
+pop rax
+mov QWORD PTR [rbp-1056], rax
+push QWORD PTR [rbp-1056]
+lea rax, [rbp-1048]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v47
+add rsp, 1056
+pop rbp
+ret
+v76:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v284]
+pop rdi
+pop rsi
+pop rdx
+call v74
+add rsp, 16
+pop rbp
+ret
+v89:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call print
+mov rax, 3
+push rax
+pop rdi
+call v50
+add rsp, 8
+pop rbp
+ret
+main:
+push rbp
+mov rbp, rsp
+mov rax, 7
+push rax
+pop rdi
+call v89
+mov rax, 9
+push rax
+pop rdi
+call print
+pop rbp
+ret
+.data
+str0: .byte 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 97, 98, 99, 100, 101, 102, 0
+str1: .byte 48, 120, 0
+str2: .byte 48, 98, 0
+v7: .quad 117690036531621345
+v8: .quad 0
+v9: .quad 0
+v91: .byte 0
+v92: .byte 1
+v93: .byte 2
+v94: .byte 3
+v95: .byte 4
+v96: .byte 5
+v97: .byte 6
+v98: .byte 7
+v99: .byte 8
+v100: .byte 9
+v101: .byte 10
+v102: .byte 11
+v103: .byte 12
+v104: .byte 13
+v105: .byte 14
+v106: .byte 15
+v107: .byte 16
+v108: .byte 17
+v109: .byte 18
+v110: .byte 19
+v111: .byte 20
+v112: .byte 21
+v113: .byte 22
+v114: .byte 23
+v115: .byte 24
+v116: .byte 25
+v117: .byte 26
+v118: .byte 27
+v119: .byte 28
+v120: .byte 29
+v121: .byte 30
+v122: .byte 31
+v123: .quad 0
+v124: .quad 1
+v125: .quad 18446744073709551614
+v126: .quad 0
+v127: .quad 1
+v128: .quad 1048576
+v132: .quad 18446744073709551615
+v133: .quad 9223372036854775807
+v134: .long 4294967295
+v135: .long 2147483647
+v136: .word 65535
+v137: .word 32767
+v138: .byte 255
+v139: .byte 127
+v140: .quad 18446744073709551615
+v141: .quad 9223372036854775807
+v142: .long 4294967295
+v143: .long 2147483647
+v144: .word 65535
+v145: .word 32767
+v146: .byte 255
+v147: .byte 127
+v148: .quad 18446744073709551615
+v149: .quad 512
+v150: .quad 0
+v151: .quad 8
+v195: .quad 10
+v201: .quad 10
+v208: .quad 20
+v215: .quad 95
+v239: .quad 1
+v260: .quad 1
+v266: .quad 32
+v280: .quad 0
+v281: .quad 8
+v283: .quad 0
+v284: .quad 1
+v285: .quad 2
+v286: .quad 0
+v287: .quad 1
+v288: .quad 2
+v289: .quad 3
+v290: .quad 4
+v291: .quad 5
+v292: .quad 6
+v293: .quad 7
+v294: .quad 8
+v295: .quad 9
+v296: .quad 11
+v297: .quad 0
+v298: .quad 1
+v299: .quad 2
+v300: .quad 3
+v301: .quad 4
+v302: .quad 5
+v303: .quad 6
+v304: .quad 7
+v305: .quad 8
+v306: .quad 9
+v307: .quad 10
+v308: .quad 11
+v309: .quad 12
+v310: .quad 13
+v311: .quad 14
+v312: .quad 15
+v313: .quad 16
+v314: .quad 17
+v315: .quad 18
+v316: .quad 19
+v317: .quad 20
+v318: .quad 21
+v319: .quad 22
+v320: .quad 23
+v321: .quad 24
+v322: .quad 25
+v323: .quad 26
+v324: .quad 27
+v325: .quad 28
+v326: .quad 29
+v327: .quad 30
+v328: .quad 31
+v329: .quad 32
+v330: .quad 33
+v331: .quad 34
+v332: .quad 35
+v333: .quad 36
+v334: .quad 37
+v335: .quad 38
+v336: .quad 39
+v337: .quad 40
+v338: .quad 41
+v339: .quad 42
+v340: .quad 43
+v341: .quad 44
+v342: .quad 45
+v343: .quad 46
+v344: .quad 47
+v345: .quad 48
+v346: .quad 49
+v347: .quad 50
+v348: .quad 51
+v349: .quad 52
+v350: .quad 53
+v351: .quad 54
+v352: .quad 55
+v353: .quad 56
+v354: .quad 57
+v355: .quad 58
+v356: .quad 59
+v357: .quad 60
+v358: .quad 61
+v359: .quad 62
+v360: .quad 63
+v361: .quad 64
+v362: .quad 65
+v363: .quad 66
+v364: .quad 67
+v365: .quad 68
+v366: .quad 69
+v367: .quad 70
+v368: .quad 71
+v369: .quad 72
+v370: .quad 73
+v371: .quad 74
+v372: .quad 75
+v373: .quad 76
+v374: .quad 77
+v375: .quad 78
+v376: .quad 79
+v377: .quad 80
+v378: .quad 81
+v379: .quad 82
+v380: .quad 83
+v381: .quad 84
+v382: .quad 85
+v383: .quad 86
+v384: .quad 87
+v385: .quad 88
+v386: .quad 89
+v387: .quad 90
+v388: .quad 91
+v389: .quad 92
+v390: .quad 93
+v391: .quad 94
+v392: .quad 95
+v393: .quad 96
+v394: .quad 97
+v395: .quad 98
+v396: .quad 99
+v397: .quad 100
+v398: .quad 101
+v399: .quad 102
+v400: .quad 103
+v401: .quad 104
+v402: .quad 105
+v403: .quad 106
+v404: .quad 107
+v405: .quad 108
+v406: .quad 109
+v407: .quad 110
+v408: .quad 111
+v409: .quad 112
+v410: .quad 113
+v411: .quad 114
+v412: .quad 115
+v413: .quad 116
+v414: .quad 117
+v415: .quad 118
+v416: .quad 119
+v417: .quad 120
+v418: .quad 121
+v419: .quad 122
+v420: .quad 123
+v421: .quad 124
+v422: .quad 125
+v423: .quad 126
+v424: .quad 127
+v425: .quad 128
+v426: .quad 129
+v427: .quad 130
+v428: .quad 131
+v429: .quad 132
+v430: .quad 133
+v431: .quad 134
+v432: .quad 135
+v433: .quad 136
+v434: .quad 137
+v435: .quad 138
+v436: .quad 139
+v437: .quad 140
+v438: .quad 141
+v439: .quad 142
+v440: .quad 143
+v441: .quad 144
+v442: .quad 145
+v443: .quad 146
+v444: .quad 147
+v445: .quad 148
+v446: .quad 149
+v447: .quad 150
+v448: .quad 151
+v449: .quad 152
+v450: .quad 153
+v451: .quad 154
+v452: .quad 155
+v453: .quad 156
+v454: .quad 157
+v455: .quad 158
+v456: .quad 159
+v457: .quad 160
+v458: .quad 161
+v459: .quad 162
+v460: .quad 163
+v461: .quad 164
+v462: .quad 165
+v463: .quad 166
+v464: .quad 167
+v465: .quad 168
+v466: .quad 169
+v467: .quad 170
+v468: .quad 171
+v469: .quad 172
+v470: .quad 173
+v471: .quad 174
+v472: .quad 175
+v473: .quad 176
+v474: .quad 177
+v475: .quad 178
+v476: .quad 179
+v477: .quad 180
+v478: .quad 181
+v479: .quad 182
+v480: .quad 183
+v481: .quad 184
+v482: .quad 185
+v483: .quad 186
+v484: .quad 187
+v485: .quad 188
+v486: .quad 189
+v487: .quad 190
+v488: .quad 191
+v489: .quad 192
+v490: .quad 193
+v491: .quad 194
+v492: .quad 195
+v493: .quad 196
+v494: .quad 197
+v495: .quad 198
+v496: .quad 199
+v497: .quad 200
+v498: .quad 201
+v499: .quad 202
+v500: .quad 203
+v501: .quad 204
+v502: .quad 205
+v503: .quad 206
+v504: .quad 207
+v505: .quad 208
+v506: .quad 209
+v507: .quad 210
+v508: .quad 211
+v509: .quad 212
+v510: .quad 213
+v511: .quad 214
+v512: .quad 215
+v513: .quad 216
+v514: .quad 217
+v515: .quad 218
+v516: .quad 219
+v517: .quad 220
+v518: .quad 221
+v519: .quad 222
+v520: .quad 223
+v521: .quad 224
+v522: .quad 225
+v523: .quad 226
+v524: .quad 227
+v525: .quad 228
+v526: .quad 229
+v527: .quad 230
+v528: .quad 231
+v529: .quad 232
+v530: .quad 233
+v531: .quad 234
+v532: .quad 235
+v533: .quad 236
+v534: .quad 237
+v535: .quad 238
+v536: .quad 239
+v537: .quad 240
+v538: .quad 241
+v539: .quad 242
+v540: .quad 243
+v541: .quad 244
+v542: .quad 245
+v543: .quad 246
+v544: .quad 247
+v545: .quad 248
+v546: .quad 249
+v547: .quad 250
+v548: .quad 251
+v549: .quad 252
+v550: .quad 253
+v551: .quad 254
+v552: .quad 255
+v553: .quad 256
+v554: .quad 257
+v555: .quad 258
+v556: .quad 259
+v557: .quad 260
+v558: .quad 261
+v559: .quad 262
+v560: .quad 263
+v561: .quad 264
+v562: .quad 265
+v563: .quad 266
+v564: .quad 267
+v565: .quad 268
+v566: .quad 269
+v567: .quad 270
+v568: .quad 271
+v569: .quad 272
+v570: .quad 273
+v571: .quad 274
+v572: .quad 275
+v573: .quad 276
+v574: .quad 277
+v575: .quad 278
+v576: .quad 279
+v577: .quad 280
+v578: .quad 281
+v579: .quad 282
+v580: .quad 283
+v581: .quad 284
+v582: .quad 285
+v583: .quad 286
+v584: .quad 287
+v585: .quad 288
+v586: .quad 289
+v587: .quad 290
+v588: .quad 291
+v589: .quad 292
+v590: .quad 293
+v591: .quad 294
+v592: .quad 295
+v593: .quad 296
+v594: .quad 297
+v595: .quad 298
+v596: .quad 299
+v597: .quad 300
+v598: .quad 301
+v599: .quad 302
+v600: .quad 303
+v601: .quad 304
+v602: .quad 305
+v603: .quad 306
+v604: .quad 307
+v605: .quad 308
+v606: .quad 309
+v607: .quad 310
+v608: .quad 311
+v609: .quad 312
+v610: .quad 313
+v611: .quad 0
+v612: .quad 1
+v613: .quad 64
+v614: .quad 512
+v615: .quad 0
+v616: .quad 1
+v617: .quad 2
+v618: .quad 4
+v619: .quad 16777216
+v620: .quad 33554432
+v621: .quad 1
+v622: .quad 2
+v623: .quad 16
+v624: .quad 32
+v625: .quad 32
+v626: .quad 1
+v627: .quad 2
+v628: .quad 4
+v629: .quad 1
+v630: .quad 2
+v631: .quad 3
+v632: .quad 4
+v633: .quad 5
+v634: .quad 6
+v635: .quad 10
+v636: .quad 2
+v637: .quad 0
+v638: .quad 0
+v639: .quad 2
+v641: .quad 0
+v643: .quad 0
+v644: .quad 2
+v645: .quad 4
+v646: .quad 8
+v703: .quad 1024
+.bss
+v129: .zero 1048576
+v130: .zero 8
+v131: .zero 8
+v152: .zero 16
+v282: .zero 16
+v640: .zero 16
+v642: .zero 4
+v647: .zero 16
@@ -0,0 +1,9119 @@
+.intel_syntax noprefix
+.text
+.globl _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE PTR [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE PTR [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+strlen_sse2:
+mov rax, rdi
+and rax, -16
+mov rcx, rdi
+and ecx, 15
+pxor xmm0, xmm0
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+shr edx, cl
+test edx, edx
+jnz .head
+.loop:
+add rax, 16
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+test edx, edx
+jz .loop
+bsf edx, edx
+add rax, rdx
+sub rax, rdi
+ret
+.head:
+bsf eax, edx
+ret
+_start:
+mov rdi, [rsp]
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax
+call main
+mov rax, 60
+mov rdi, 0
+syscall
+ret
+v11:
+push rbp
+mov rbp, rsp
+mov rax, OFFSET v176
+push rax
+mov rax, OFFSET v175
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v177
+push rax
+mov rax, OFFSET v175
+push rax
+push QWORD PTR [v174]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v12:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L0
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L1
+L0:
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L1:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v13:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L2:
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L3
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L2
+L3:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v16:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L4:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L5
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L6
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L7
+L6:
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L8
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L8:
+L7:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L4
+L5:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v17:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L9:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L10
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L9
+L10:
+add rsp, 32
+pop rbp
+ret
+v18:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-16]
+mov rax, 255
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 72340172838076673
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v17
+push QWORD PTR [rbp-40]
+pop rax
+mov QWORD PTR [rbp-48], rax
+L11:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L12
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L11
+L12:
+add rsp, 48
+pop rbp
+ret
+v19:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L13:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L14
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L13
+L14:
+L15:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L16
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L15
+L16:
+add rsp, 40
+pop rbp
+ret
+v21:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L17:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L18
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L19
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L19:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L17
+L18:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v22:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L20:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L21
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L22
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L22:
+jmp L20
+L21:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v23:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+pop rdi
+call v22
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L23
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v254]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+mul rbx
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L23:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L24:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L25
+push QWORD PTR [rbp-8]
+push QWORD PTR [v254]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-56]
+mov rax, OFFSET str0
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v254]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L24
+L25:
+add rsp, 56
+pop rbp
+ret
+v25:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 47
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 58
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v26:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 48
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 49
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v27:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v25
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 96
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 103
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 71
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v30:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 91
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L26
+lea rax, [rbp-8]
+push rax
+mov rax, 32
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L26:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v31:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 10
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L27
+mov rax, 2
+push rax
+mov rax, OFFSET str1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L28
+lea rax, [rbp-32]
+push rax
+mov rax, 16
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L29:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-56]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L30
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v30
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+pop rdi
+call v25
+push rax
+pop rax
+test rax, rax
+jz L31
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L32
+L31:
+push QWORD PTR [rbp-72]
+pop rdi
+call v27
+push rax
+pop rax
+test rax, rax
+jz L33
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 10
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 97
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L34
+L33:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v268]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L35
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v178]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L35:
+L34:
+L32:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L29
+L30:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L36
+L28:
+mov rax, 2
+push rax
+mov rax, OFFSET str2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L37
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L38:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L39
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v30
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+pop rdi
+call v26
+push rax
+pop rax
+test rax, rax
+jz L40
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L41
+L40:
+push QWORD PTR [rbp-80]
+push QWORD PTR [v268]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L42
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v178]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L42:
+L41:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L38
+L39:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L37:
+L36:
+L27:
+push QWORD PTR [rbp-48]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L43
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L44:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L45
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v268]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L46
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-88]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L46:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L44
+L45:
+L43:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v34:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v36:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD PTR [v292]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v37:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L47
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L48
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v34
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L49
+L48:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L50
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L51
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L52
+L51:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L52:
+L50:
+L49:
+L47:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v38:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L53
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v37
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L53:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v39:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v22
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L54
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v23
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L55
+L54:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L56
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L57
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v23
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L58
+L57:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v23
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L58:
+L56:
+L55:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v40:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L59
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v313]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L60
+L59:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L61
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v313]
+pop rbx
+pop rax
+mov [rax], rbx
+L61:
+L60:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v42:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L62
+push QWORD PTR [v176]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v177]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L63
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L64
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v176]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+mov rax, OFFSET v176
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v176]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L64:
+jmp L65
+L63:
+L65:
+L62:
+add rsp, 16
+pop rbp
+ret
+v47:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v350]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v48:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v351]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+add rsp, 32
+pop rbp
+ret
+v49:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v352]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v50:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v355]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v52:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v410]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v55:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v578]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v57:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+mov [rbp-48], r9
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v359]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 48
+pop rbp
+ret
+v58:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v375]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+syscall
+push rax
+pop rax
+add rsp, 40
+pop rbp
+ret
+v59:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v361]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v60:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v409]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v61:
+push rbp
+mov rbp, rsp
+push QWORD PTR [v407]
+pop rax
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v62:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v411]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v64:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 127
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v67:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v433]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v68:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [v776]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v47
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L66:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L67
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v776]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v47
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L66
+L67:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v70:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-160], rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v50
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L68
+lea rax, [rbp-160]
+push rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [v709]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L68:
+push QWORD PTR [rbp-160]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v71:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v776]
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+mov rax, 34
+push rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v57
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L69
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+L69:
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L70:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L71
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L72
+push QWORD PTR [v9]
+push QWORD PTR [v679]
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v58
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L73
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v59
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L74
+L73:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L74:
+L72:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L75
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v47
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L76
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L76:
+L75:
+jmp L70
+L71:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L77
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [v9]
+mov rax, 0
+push rax
+push QWORD PTR [v775]
+push QWORD PTR [rbp-32]
+push QWORD PTR [v775]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v775]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v58
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L77:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v76:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v178]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L78
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L78:
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L79:
+push QWORD PTR [rbp-80]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L80
+push QWORD PTR [rbp-48]
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L81
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L82
+L81:
+push QWORD PTR [rbp-96]
+mov rax, 92
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L83
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 116
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L84
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v144]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L85
+L84:
+push QWORD PTR [rbp-96]
+mov rax, 98
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L86
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v143]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L87
+L86:
+push QWORD PTR [rbp-96]
+mov rax, 110
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L88
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v145]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L89
+L88:
+push QWORD PTR [rbp-96]
+mov rax, 114
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L90
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v148]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L91
+L90:
+push QWORD PTR [rbp-96]
+mov rax, 102
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L92
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v147]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L93
+L92:
+push QWORD PTR [rbp-96]
+mov rax, 39
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L94
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov rax, 39
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L94:
+L93:
+L91:
+L89:
+L87:
+L85:
+jmp L95
+L83:
+push QWORD PTR [rbp-96]
+mov rax, 37
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L96
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L97
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v38
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L98
+L97:
+push QWORD PTR [rbp-96]
+mov rax, 99
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L99
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L100
+L99:
+push QWORD PTR [rbp-96]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L101
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L102
+L101:
+push QWORD PTR [rbp-96]
+mov rax, 105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L103
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L104
+L103:
+push QWORD PTR [rbp-96]
+mov rax, 42
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L105
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L106
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v37
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L107
+L106:
+L107:
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L108
+L105:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L108:
+L104:
+L102:
+L100:
+L98:
+jmp L109
+L96:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L109:
+L95:
+L82:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L110
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v36
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L110:
+jmp L79
+L80:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L111
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L111:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 112
+pop rbp
+ret
+v77:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov eax, [v180]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v80:
+push rbp
+mov rbp, rsp
+sub rsp, 1056
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-1048], al
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rax, 1024
+push rax
+lea rax, [rbp-1048]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-1056], rax
+push QWORD PTR [rbp-1056]
+lea rax, [rbp-1048]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v48
+add rsp, 1056
+pop rbp
+ret
+v82:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v337]
+pop rdi
+pop rsi
+pop rdx
+call v80
+add rsp, 16
+pop rbp
+ret
+v89:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L112
+lea rax, [rbp-16]
+push rax
+mov rax, OFFSET str3
+push rax
+push QWORD PTR [v338]
+pop rdi
+pop rsi
+pop rdx
+call v80
+mov rax, 1
+push rax
+pop rdi
+call v52
+L112:
+add rsp, 16
+pop rbp
+ret
+v92:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 16
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L113:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v869]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L114
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v872
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L115
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L115:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L113
+L114:
+mov rax, OFFSET str4
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v867]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v89
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L116:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v870]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L117
+L118:
+mov rax, OFFSET v872
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [v868]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L119
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L118
+L119:
+mov rax, OFFSET v873
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L116
+L117:
+mov rax, OFFSET v877
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v93:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, OFFSET v873
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 15
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v868]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v94:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+push QWORD PTR [v877]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L120
+call v92
+L120:
+push QWORD PTR [rbp-8]
+pop rdi
+call v93
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, OFFSET v872
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v874
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L121
+mov rax, OFFSET v874
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+call v17
+jmp L122
+L121:
+mov rax, OFFSET v875
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v876
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L123
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+push QWORD PTR [v871]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v57
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v876
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [v871]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L123:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L124
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v875
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L124:
+L122:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v95:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+pop rdi
+call v93
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v874
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v874
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v96:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L125
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v867]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L126
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v59
+jmp L127
+L126:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v95
+L127:
+L125:
+add rsp, 16
+pop rbp
+ret
+v97:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v867]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L128
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-16]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v57
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L129
+L128:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v94
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L129:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L130
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L130:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v98:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v867]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v867]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L131
+push QWORD PTR [v679]
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-40]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v58
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L132
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L132:
+jmp L133
+L131:
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v867]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [v867]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L134
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+call v93
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+call v93
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L135
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+L135:
+L134:
+L133:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L136
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v97
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L137
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L138
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+L138:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-8]
+pop rdi
+call v96
+L137:
+L136:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v100:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 5381
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L139
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L140:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L141
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-24]
+mov rax, 5
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L140
+L141:
+L139:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v102:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L142
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L143:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L144
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 6
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 16
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L143
+L144:
+L142:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v103:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v104:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v925]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+mov rax, 31
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 33
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v924]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v105:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v924]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v927]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v106:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-16], rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 33
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v925]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 29
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v926]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v107:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+mov rax, 32
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L145
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v928]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L146
+L145:
+mov rax, 6983438078262162902
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [v925]
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 7046029288634856825
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L147:
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L148
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v104
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L147
+L148:
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v103
+push rax
+mov rax, 7
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v103
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 12
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+call v103
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 18
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v103
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v105
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v105
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v105
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v105
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L146:
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L149:
+push QWORD PTR [rbp-24]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L150
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+call v104
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 27
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 37
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v924]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v927]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L149
+L150:
+push QWORD PTR [rbp-24]
+mov rax, 4
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L151
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+push QWORD PTR [v924]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 23
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 41
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v925]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v926]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 4
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L151:
+L152:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L153
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [v928]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 11
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 53
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v924]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L152
+L153:
+push QWORD PTR [rbp-32]
+pop rdi
+call v106
+push rax
+pop rax
+add rsp, 72
+pop rbp
+ret
+v109:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v924]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v106
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v110:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v954]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v956]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v957]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 24
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v12
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v958]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v959]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v960]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v107
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v111:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v954]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v957]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v112:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v959]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v170]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L154
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L155:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L156
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L157
+push QWORD PTR [rbp-24]
+push QWORD PTR [v951]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v96
+L157:
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L155
+L156:
+L154:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v954]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v96
+push QWORD PTR [rbp-8]
+push QWORD PTR [v954]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v956]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v114:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 32
+pop rbp
+ret
+v115:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v959]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v169]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L158
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L159
+L158:
+mov rax, OFFSET v107
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v960]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rdi
+pop rsi
+call rax
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L159:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L160
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L160:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v116:
+push rbp
+mov rbp, rsp
+sub rsp, 104
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [v194]
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+pop rax
+test rax, rax
+jz L161
+push QWORD PTR [rbp-8]
+push QWORD PTR [v959]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v170]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+L162:
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L163
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+push QWORD PTR [rbp-104]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v114
+push rax
+push QWORD PTR [rbp-80]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L164
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L165
+L164:
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L166
+push QWORD PTR [rbp-56]
+pop rax
+test rax, rax
+jz L167
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-96]
+push QWORD PTR [v952]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L168
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-96]
+push QWORD PTR [v951]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v21
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L169
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L169:
+L168:
+jmp L170
+L167:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-96]
+push QWORD PTR [v951]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L171
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L171:
+L170:
+L166:
+L165:
+lea rax, [rbp-72]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L162
+L163:
+L161:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 104
+pop rbp
+ret
+v117:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v957]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+L172:
+push QWORD PTR [rbp-72]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L173
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L174
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L175
+L174:
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v114
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L176
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L177
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L177:
+lea rax, [rbp-64]
+push rax
+push QWORD PTR [rbp-88]
+pop rbx
+pop rax
+mov [rax], rbx
+L176:
+L175:
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L178
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L178:
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-56]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+push QWORD PTR [rbp-64]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L172
+L173:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v118:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v954]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L179
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v949]
+pop rbx
+pop rax
+mov [rax], rbx
+L179:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v957]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v97
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, OFFSET str5
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v89
+push QWORD PTR [rbp-8]
+push QWORD PTR [v954]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L180:
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L181
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L182
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v117
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L182:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L180
+L181:
+push QWORD PTR [rbp-16]
+pop rdi
+call v96
+add rsp, 80
+pop rbp
+ret
+v119:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v115
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v116
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v194]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L183
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L184
+L183:
+mov rax, 4
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v956]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L185
+push QWORD PTR [rbp-8]
+pop rdi
+call v118
+L185:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v957]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rax
+pop rcx
+rep stosb
+push QWORD PTR [rbp-64]
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-64]
+push QWORD PTR [v951]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v959]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v170]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L186
+push QWORD PTR [rbp-24]
+pop rdi
+call v97
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, OFFSET str6
+push rax
+push QWORD PTR [rbp-72]
+pop rdi
+pop rsi
+call v89
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-72]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-64]
+push QWORD PTR [v951]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-64]
+push QWORD PTR [v952]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+L186:
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v117
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v956]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v956]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L184:
+push QWORD PTR [rbp-56]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L187
+push QWORD PTR [rbp-8]
+push QWORD PTR [v958]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+L187:
+push QWORD PTR [rbp-80]
+pop rax
+add rsp, 80
+pop rbp
+ret
+v120:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v115
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v116
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [v194]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L188
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L188:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v121:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v115
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v116
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [v194]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L189
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v959]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v170]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L190
+push QWORD PTR [rbp-48]
+push QWORD PTR [v951]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v96
+L190:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v955]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v957]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+L191:
+push QWORD PTR [rbp-72]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L192
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-88]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v114
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L193
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+push QWORD PTR [v950]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L194
+L193:
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-88]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L194:
+jmp L191
+L192:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v956]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v956]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L189:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v122:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v119
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v123:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v120
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v125:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v119
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v126:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v120
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v129:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [v333]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v333]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+mov rax, 1000000000
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v334]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v334]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rax, 1000
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L195
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L195:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v130:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rax, 50000000
+push rax
+push QWORD PTR [rbp-24]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-48]
+push rax
+mov rax, OFFSET str7
+push rax
+pop rdi
+pop rsi
+call v82
+add rsp, 48
+pop rbp
+ret
+v131:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L196:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1063]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L197
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET str8
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+mov ax, [rsi+0]
+mov [rdi+0], ax
+mov al, [rsi+2]
+mov [rdi+2], al
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-56], al
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+lea rax, [rbp-56]
+push rax
+mov rax, 48
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+L198:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L199
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 48
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L198
+L199:
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L200
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L200:
+L201:
+push QWORD PTR [rbp-64]
+pop rax
+test rax, rax
+jz L202
+lea rax, [rbp-64]
+push rax
+push QWORD PTR [rbp-64]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L201
+L202:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L196
+L197:
+add rsp, 64
+pop rbp
+ret
+v132:
+push rbp
+mov rbp, rsp
+sub rsp, 136
+mov rax, 8
+push rax
+push QWORD PTR [v169]
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v110
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [v340]
+pop rdi
+pop rsi
+call v55
+push rax
+pop rax
+mov QWORD PTR [rbp-96], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-104], rax
+L203:
+push QWORD PTR [rbp-104]
+push QWORD PTR [v1063]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L204
+push QWORD PTR [v9]
+push QWORD PTR [rbp-104]
+mov rax, 7919
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v122
+push rax
+push QWORD PTR [rbp-104]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-104]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-104]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L203
+L204:
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v340]
+pop rdi
+pop rsi
+call v55
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-32]
+push rax
+lea rax, [rbp-16]
+push rax
+pop rdi
+pop rsi
+call v129
+push rax
+mov rax, OFFSET str9
+push rax
+mov rax, OFFSET str10
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v130
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [v340]
+pop rdi
+pop rsi
+call v55
+push rax
+pop rax
+mov QWORD PTR [rbp-120], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-128], rax
+lea rax, [rbp-104]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L205:
+push QWORD PTR [rbp-104]
+push QWORD PTR [v1063]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L206
+push QWORD PTR [rbp-104]
+mov rax, 7919
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v123
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-104]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L207
+lea rax, [rbp-128]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-128]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L207:
+lea rax, [rbp-104]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-104]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L205
+L206:
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v340]
+pop rdi
+pop rsi
+call v55
+push rax
+pop rax
+mov QWORD PTR [rbp-136], rax
+lea rax, [rbp-32]
+push rax
+lea rax, [rbp-16]
+push rax
+pop rdi
+pop rsi
+call v129
+push rax
+mov rax, OFFSET str11
+push rax
+mov rax, OFFSET str12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v130
+mov rax, OFFSET str13
+push rax
+push QWORD PTR [rbp-128]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v89
+lea rax, [rbp-88]
+push rax
+pop rdi
+call v112
+add rsp, 136
+pop rbp
+ret
+v133:
+push rbp
+mov rbp, rsp
+sub rsp, 176
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 8
+push rax
+push QWORD PTR [v170]
+lea rax, [rbp-112]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v110
+lea rax, [rbp-112]
+push rax
+push QWORD PTR [v960]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v340]
+pop rdi
+pop rsi
+call v55
+push rax
+pop rax
+mov QWORD PTR [rbp-120], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-128], rax
+L208:
+push QWORD PTR [rbp-128]
+push QWORD PTR [v1063]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L209
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-128]
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-136], rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-136]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-136]
+lea rax, [rbp-112]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v125
+push rax
+push QWORD PTR [rbp-128]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-128]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-128]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L208
+L209:
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v340]
+pop rdi
+pop rsi
+call v55
+push rax
+pop rax
+mov QWORD PTR [rbp-144], rax
+lea rax, [rbp-56]
+push rax
+lea rax, [rbp-40]
+push rax
+pop rdi
+pop rsi
+call v129
+push rax
+mov rax, OFFSET str14
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v130
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v340]
+pop rdi
+pop rsi
+call v55
+push rax
+pop rax
+mov QWORD PTR [rbp-152], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-160], rax
+lea rax, [rbp-128]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L210:
+push QWORD PTR [rbp-128]
+push QWORD PTR [v1063]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L211
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-128]
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-168], rax
+push QWORD PTR [rbp-168]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-168]
+lea rax, [rbp-112]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-128]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L212
+lea rax, [rbp-160]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-160]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L212:
+lea rax, [rbp-128]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-128]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L210
+L211:
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v340]
+pop rdi
+pop rsi
+call v55
+push rax
+pop rax
+mov QWORD PTR [rbp-176], rax
+lea rax, [rbp-56]
+push rax
+lea rax, [rbp-40]
+push rax
+pop rdi
+pop rsi
+call v129
+push rax
+mov rax, OFFSET str15
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v130
+mov rax, OFFSET str16
+push rax
+push QWORD PTR [rbp-160]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v89
+lea rax, [rbp-112]
+push rax
+pop rdi
+call v112
+add rsp, 176
+pop rbp
+ret
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+call v11
+mov rax, 800000
+push rax
+pop rdi
+call v97
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [rbp-8]
+pop rdi
+call v131
+call v132
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v107
+push rax
+mov rax, OFFSET str17
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v133
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v100
+push rax
+mov rax, OFFSET str18
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v133
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v102
+push rax
+mov rax, OFFSET str19
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v133
+push QWORD PTR [rbp-8]
+pop rdi
+call v96
+add rsp, 8
+pop rbp
+ret
+.data
+str0: .byte 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 97, 98, 99, 100, 101, 102, 0
+str1: .byte 48, 120, 0
+str2: .byte 48, 98, 0
+str3: .byte 91, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 93, 58, 32, 37, 115, 0
+str4: .byte 109, 101, 109, 111, 114, 121, 95, 105, 110, 105, 116, 58, 32, 115, 105, 122, 101, 32, 99, 108, 97, 115, 115, 101, 115, 32, 100, 111, 32, 110, 111, 116, 32, 101, 110, 100, 32, 97, 116, 32, 77, 69, 77, 79, 82, 89, 95, 83, 77, 65, 76, 76, 95, 77, 65, 88, 10, 0
+str5: .byte 104, 97, 115, 104, 109, 97, 112, 95, 103, 114, 111, 119, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str6: .byte 104, 97, 115, 104, 109, 97, 112, 95, 105, 110, 115, 101, 114, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str7: .byte 37, 115, 32, 37, 115, 58, 32, 37, 100, 32, 107, 47, 115, 10, 0
+str8: .byte 107, 101, 121, 0
+str9: .byte 105, 110, 115, 101, 114, 116, 0
+str10: .byte 117, 54, 52, 0
+str11: .byte 108, 111, 111, 107, 117, 112, 0
+str12: .byte 117, 54, 52, 0
+str13: .byte 98, 101, 110, 99, 104, 95, 117, 54, 52, 58, 32, 108, 111, 111, 107, 117, 112, 32, 102, 97, 105, 108, 101, 100, 10, 0
+str14: .byte 105, 110, 115, 101, 114, 116, 0
+str15: .byte 108, 111, 111, 107, 117, 112, 0
+str16: .byte 98, 101, 110, 99, 104, 95, 115, 116, 114, 58, 32, 108, 111, 111, 107, 117, 112, 32, 102, 97, 105, 108, 101, 100, 10, 0
+str17: .byte 120, 120, 104, 54, 52, 0
+str18: .byte 100, 106, 98, 50, 0
+str19: .byte 115, 100, 98, 109, 0
+v7: .quad 14646898837843034141
+v8: .quad 0
+v9: .quad 0
+v135: .byte 0
+v136: .byte 1
+v137: .byte 2
+v138: .byte 3
+v139: .byte 4
+v140: .byte 5
+v141: .byte 6
+v142: .byte 7
+v143: .byte 8
+v144: .byte 9
+v145: .byte 10
+v146: .byte 11
+v147: .byte 12
+v148: .byte 13
+v149: .byte 14
+v150: .byte 15
+v151: .byte 16
+v152: .byte 17
+v153: .byte 18
+v154: .byte 19
+v155: .byte 20
+v156: .byte 21
+v157: .byte 22
+v158: .byte 23
+v159: .byte 24
+v160: .byte 25
+v161: .byte 26
+v162: .byte 27
+v163: .byte 28
+v164: .byte 29
+v165: .byte 30
+v166: .byte 31
+v167: .quad 0
+v168: .quad 1
+v169: .quad 0
+v170: .quad 1
+v171: .quad 18446744073709551614
+v172: .quad 0
+v173: .quad 1
+v174: .quad 1048576
+v178: .quad 18446744073709551615
+v179: .quad 9223372036854775807
+v180: .long 4294967295
+v181: .long 2147483647
+v182: .word 65535
+v183: .word 32767
+v184: .byte 255
+v185: .byte 127
+v186: .quad 18446744073709551615
+v187: .quad 9223372036854775807
+v188: .long 4294967295
+v189: .long 2147483647
+v190: .word 65535
+v191: .word 32767
+v192: .byte 255
+v193: .byte 127
+v194: .quad 18446744073709551615
+v195: .quad 512
+v196: .quad 0
+v197: .quad 8
+v248: .quad 10
+v254: .quad 10
+v261: .quad 20
+v268: .quad 95
+v292: .quad 1
+v313: .quad 1
+v319: .quad 32
+v333: .quad 0
+v334: .quad 8
+v336: .quad 0
+v337: .quad 1
+v338: .quad 2
+v339: .quad 0
+v340: .quad 1
+v341: .quad 2
+v342: .quad 3
+v343: .quad 4
+v344: .quad 5
+v345: .quad 6
+v346: .quad 7
+v347: .quad 8
+v348: .quad 9
+v349: .quad 11
+v350: .quad 0
+v351: .quad 1
+v352: .quad 2
+v353: .quad 3
+v354: .quad 4
+v355: .quad 5
+v356: .quad 6
+v357: .quad 7
+v358: .quad 8
+v359: .quad 9
+v360: .quad 10
+v361: .quad 11
+v362: .quad 12
+v363: .quad 13
+v364: .quad 14
+v365: .quad 15
+v366: .quad 16
+v367: .quad 17
+v368: .quad 18
+v369: .quad 19
+v370: .quad 20
+v371: .quad 21
+v372: .quad 22
+v373: .quad 23
+v374: .quad 24
+v375: .quad 25
+v376: .quad 26
+v377: .quad 27
+v378: .quad 28
+v379: .quad 29
+v380: .quad 30
+v381: .quad 31
+v382: .quad 32
+v383: .quad 33
+v384: .quad 34
+v385: .quad 35
+v386: .quad 36
+v387: .quad 37
+v388: .quad 38
+v389: .quad 39
+v390: .quad 40
+v391: .quad 41
+v392: .quad 42
+v393: .quad 43
+v394: .quad 44
+v395: .quad 45
+v396: .quad 46
+v397: .quad 47
+v398: .quad 48
+v399: .quad 49
+v400: .quad 50
+v401: .quad 51
+v402: .quad 52
+v403: .quad 53
+v404: .quad 54
+v405: .quad 55
+v406: .quad 56
+v407: .quad 57
+v408: .quad 58
+v409: .quad 59
+v410: .quad 60
+v411: .quad 61
+v412: .quad 62
+v413: .quad 63
+v414: .quad 64
+v415: .quad 65
+v416: .quad 66
+v417: .quad 67
+v418: .quad 68
+v419: .quad 69
+v420: .quad 70
+v421: .quad 71
+v422: .quad 72
+v423: .quad 73
+v424: .quad 74
+v425: .quad 75
+v426: .quad 76
+v427: .quad 77
+v428: .quad 78
+v429: .quad 79
+v430: .quad 80
+v431: .quad 81
+v432: .quad 82
+v433: .quad 83
+v434: .quad 84
+v435: .quad 85
+v436: .quad 86
+v437: .quad 87
+v438: .quad 88
+v439: .quad 89
+v440: .quad 90
+v441: .quad 91
+v442: .quad 92
+v443: .quad 93
+v444: .quad 94
+v445: .quad 95
+v446: .quad 96
+v447: .quad 97
+v448: .quad 98
+v449: .quad 99
+v450: .quad 100
+v451: .quad 101
+v452: .quad 102
+v453: .quad 103
+v454: .quad 104
+v455: .quad 105
+v456: .quad 106
+v457: .quad 107
+v458: .quad 108
+v459: .quad 109
+v460: .quad 110
+v461: .quad 111
+v462: .quad 112
+v463: .quad 113
+v464: .quad 114
+v465: .quad 115
+v466: .quad 116
+v467: .quad 117
+v468: .quad 118
+v469: .quad 119
+v470: .quad 120
+v471: .quad 121
+v472: .quad 122
+v473: .quad 123
+v474: .quad 124
+v475: .quad 125
+v476: .quad 126
+v477: .quad 127
+v478: .quad 128
+v479: .quad 129
+v480: .quad 130
+v481: .quad 131
+v482: .quad 132
+v483: .quad 133
+v484: .quad 134
+v485: .quad 135
+v486: .quad 136
+v487: .quad 137
+v488: .quad 138
+v489: .quad 139
+v490: .quad 140
+v491: .quad 141
+v492: .quad 142
+v493: .quad 143
+v494: .quad 144
+v495: .quad 145
+v496: .quad 146
+v497: .quad 147
+v498: .quad 148
+v499: .quad 149
+v500: .quad 150
+v501: .quad 151
+v502: .quad 152
+v503: .quad 153
+v504: .quad 154
+v505: .quad 155
+v506: .quad 156
+v507: .quad 157
+v508: .quad 158
+v509: .quad 159
+v510: .quad 160
+v511: .quad 161
+v512: .quad 162
+v513: .quad 163
+v514: .quad 164
+v515: .quad 165
+v516: .quad 166
+v517: .quad 167
+v518: .quad 168
+v519: .quad 169
+v520: .quad 170
+v521: .quad 171
+v522: .quad 172
+v523: .quad 173
+v524: .quad 174
+v525: .quad 175
+v526: .quad 176
+v527: .quad 177
+v528: .quad 178
+v529: .quad 179
+v530: .quad 180
+v531: .quad 181
+v532: .quad 182
+v533: .quad 183
+v534: .quad 184
+v535: .quad 185
+v536: .quad 186
+v537: .quad 187
+v538: .quad 188
+v539: .quad 189
+v540: .quad 190
+v541: .quad 191
+v542: .quad 192
+v543: .quad 193
+v544: .quad 194
+v545: .quad 195
+v546: .quad 196
+v547: .quad 197
+v548: .quad 198
+v549: .quad 199
+v550: .quad 200
+v551: .quad 201
+v552: .quad 202
+v553: .quad 203
+v554: .quad 204
+v555: .quad 205
+v556: .quad 206
+v557: .quad 207
+v558: .quad 208
+v559: .quad 209
+v560: .quad 210
+v561: .quad 211
+v562: .quad 212
+v563: .quad 213
+v564: .quad 214
+v565: .quad 215
+v566: .quad 216
+v567: .quad 217
+v568: .quad 218
+v569: .quad 219
+v570: .quad 220
+v571: .quad 221
+v572: .quad 222
+v573: .quad 223
+v574: .quad 224
+v575: .quad 225
+v576: .quad 226
+v577: .quad 227
+v578: .quad 228
+v579: .quad 229
+v580: .quad 230
+v581: .quad 231
+v582: .quad 232
+v583: .quad 233
+v584: .quad 234
+v585: .quad 235
+v586: .quad 236
+v587: .quad 237
+v588: .quad 238
+v589: .quad 239
+v590: .quad 240
+v591: .quad 241
+v592: .quad 242
+v593: .quad 243
+v594: .quad 244
+v595: .quad 245
+v596: .quad 246
+v597: .quad 247
+v598: .quad 248
+v599: .quad 249
+v600: .quad 250
+v601: .quad 251
+v602: .quad 252
+v603: .quad 253
+v604: .quad 254
+v605: .quad 255
+v606: .quad 256
+v607: .quad 257
+v608: .quad 258
+v609: .quad 259
+v610: .quad 260
+v611: .quad 261
+v612: .quad 262
+v613: .quad 263
+v614: .quad 264
+v615: .quad 265
+v616: .quad 266
+v617: .quad 267
+v618: .quad 268
+v619: .quad 269
+v620: .quad 270
+v621: .quad 271
+v622: .quad 272
+v623: .quad 273
+v624: .quad 274
+v625: .quad 275
+v626: .quad 276
+v627: .quad 277
+v628: .quad 278
+v629: .quad 279
+v630: .quad 280
+v631: .quad 281
+v632: .quad 282
+v633: .quad 283
+v634: .quad 284
+v635: .quad 285
+v636: .quad 286
+v637: .quad 287
+v638: .quad 288
+v639: .quad 289
+v640: .quad 290
+v641: .quad 291
+v642: .quad 292
+v643: .quad 293
+v644: .quad 294
+v645: .quad 295
+v646: .quad 296
+v647: .quad 297
+v648: .quad 298
+v649: .quad 299
+v650: .quad 300
+v651: .quad 301
+v652: .quad 302
+v653: .quad 303
+v654: .quad 304
+v655: .quad 305
+v656: .quad 306
+v657: .quad 307
+v658: .quad 308
+v659: .quad 309
+v660: .quad 310
+v661: .quad 311
+v662: .quad 312
+v663: .quad 313
+v664: .quad 0
+v665: .quad 1
+v666: .quad 64
+v667: .quad 512
+v668: .quad 0
+v669: .quad 1
+v670: .quad 2
+v671: .quad 4
+v672: .quad 16777216
+v673: .quad 33554432
+v674: .quad 1
+v675: .quad 2
+v676: .quad 16
+v677: .quad 32
+v678: .quad 32
+v679: .quad 1
+v680: .quad 2
+v681: .quad 4
+v682: .quad 1
+v683: .quad 2
+v684: .quad 3
+v685: .quad 4
+v686: .quad 5
+v687: .quad 6
+v688: .quad 10
+v689: .quad 2
+v690: .quad 0
+v691: .quad 0
+v692: .quad 2
+v694: .quad 0
+v696: .quad 0
+v697: .quad 2
+v698: .quad 4
+v699: .quad 8
+v701: .quad 0
+v702: .quad 8
+v703: .quad 16
+v704: .quad 24
+v705: .quad 28
+v706: .quad 32
+v707: .quad 36
+v708: .quad 40
+v709: .quad 48
+v710: .quad 56
+v711: .quad 64
+v712: .quad 72
+v713: .quad 88
+v714: .quad 104
+v715: .quad 120
+v774: .quad 1024
+v775: .quad 4096
+v776: .quad 65536
+v867: .quad 2048
+v868: .quad 4
+v869: .quad 24
+v870: .quad 129
+v871: .quad 65536
+v924: .quad 11400714785074694791
+v925: .quad 14029467366897019727
+v926: .quad 1609587929392839161
+v927: .quad 9650029242287828579
+v928: .quad 2870177450012600261
+v949: .quad 16
+v950: .quad 0
+v951: .quad 8
+v952: .quad 16
+v954: .quad 0
+v955: .quad 8
+v956: .quad 16
+v957: .quad 24
+v958: .quad 32
+v959: .quad 40
+v960: .quad 48
+v1063: .quad 50000
+v1064: .quad 16
+.bss
+v175: .zero 1048576
+v176: .zero 8
+v177: .zero 8
+v198: .zero 16
+v335: .zero 16
+v693: .zero 16
+v695: .zero 4
+v700: .zero 16
+v716: .zero 144
+v872: .zero 192
+v873: .zero 129
+v874: .zero 192
+v875: .zero 192
+v876: .zero 192
+v877: .zero 8
+v953: .zero 24
+v961: .zero 56
@@ -0,0 +1,5473 @@
+.intel_syntax noprefix
+.text
+.globl _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE PTR [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE PTR [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+strlen_sse2:
+mov rax, rdi
+and rax, -16
+mov rcx, rdi
+and ecx, 15
+pxor xmm0, xmm0
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+shr edx, cl
+test edx, edx
+jnz .head
+.loop:
+add rax, 16
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+test edx, edx
+jz .loop
+bsf edx, edx
+add rax, rdx
+sub rax, rdi
+ret
+.head:
+bsf eax, edx
+ret
+_start:
+mov rdi, [rsp]
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax
+call main
+mov rax, 60
+mov rdi, 0
+syscall
+ret
+v13:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L0:
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L1
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L0
+L1:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v16:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L2:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L3
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L4
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L5
+L4:
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L6
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L6:
+L5:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L2
+L3:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v17:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L7:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L8
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L7
+L8:
+add rsp, 32
+pop rbp
+ret
+v19:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L9:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L10
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L9
+L10:
+L11:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L12
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L11
+L12:
+add rsp, 40
+pop rbp
+ret
+v22:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v22
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v23:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v23
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v24:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L13:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L14
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L15
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L15:
+jmp L13
+L14:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v25:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L16
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v238]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+mul rbx
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L16:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L17:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L18
+push QWORD PTR [rbp-8]
+push QWORD PTR [v238]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-56]
+mov rax, OFFSET str0
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v238]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L17
+L18:
+add rsp, 56
+pop rbp
+ret
+v27:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 47
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 58
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v28:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 48
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 49
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v29:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v27
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 96
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 103
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 71
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v32:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 91
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L19
+lea rax, [rbp-8]
+push rax
+mov rax, 32
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L19:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v33:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 10
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L20
+mov rax, 2
+push rax
+mov rax, OFFSET str1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L21
+lea rax, [rbp-32]
+push rax
+mov rax, 16
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L22:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-56]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L23
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+pop rdi
+call v27
+push rax
+pop rax
+test rax, rax
+jz L24
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L25
+L24:
+push QWORD PTR [rbp-72]
+pop rdi
+call v29
+push rax
+pop rax
+test rax, rax
+jz L26
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 10
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 97
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L27
+L26:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v252]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L28
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v157]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L28:
+L27:
+L25:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L22
+L23:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L29
+L21:
+mov rax, 2
+push rax
+mov rax, OFFSET str2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L30
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L31:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L32
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+pop rdi
+call v28
+push rax
+pop rax
+test rax, rax
+jz L33
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L34
+L33:
+push QWORD PTR [rbp-80]
+push QWORD PTR [v252]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L35
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v157]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L35:
+L34:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L31
+L32:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L30:
+L29:
+L20:
+push QWORD PTR [rbp-48]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L36
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L37:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L38
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v252]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L39
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-88]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L39:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L37
+L38:
+L36:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v36:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v38:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD PTR [v276]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v39:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L40
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L41
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v36
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L42
+L41:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L43
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L44
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L45
+L44:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L45:
+L43:
+L42:
+L40:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v40:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L46
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L46:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v41:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L47
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L48
+L47:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L49
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L50
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L51
+L50:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L51:
+L49:
+L48:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v42:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L52
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v297]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L53
+L52:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L54
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v297]
+pop rbx
+pop rax
+mov [rax], rbx
+L54:
+L53:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v44:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L55
+push QWORD PTR [v155]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v156]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L56
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L57
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v155]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+mov rax, OFFSET v155
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v155]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L57:
+jmp L58
+L56:
+L58:
+L55:
+add rsp, 16
+pop rbp
+ret
+v49:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v334]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v50:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v335]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+add rsp, 32
+pop rbp
+ret
+v51:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v336]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v52:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v339]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v54:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v565]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v59:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+mov [rbp-48], r9
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v343]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 48
+pop rbp
+ret
+v60:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v359]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+syscall
+push rax
+pop rax
+add rsp, 40
+pop rbp
+ret
+v61:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v345]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v63:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v393]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v64:
+push rbp
+mov rbp, rsp
+push QWORD PTR [v391]
+pop rax
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v65:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v395]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v67:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 127
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v70:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v417]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v74:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push QWORD PTR [v358]
+pop rax
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+add rsp, 8
+pop rbp
+ret
+v77:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v77
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v78:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [v790]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L59:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L60
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v790]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L59
+L60:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v80:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-160], rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v52
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L61
+lea rax, [rbp-160]
+push rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [v706]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L61:
+push QWORD PTR [rbp-160]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v81:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v790]
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+mov rax, 34
+push rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L62
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+L62:
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L63:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L64
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L65
+push QWORD PTR [v9]
+push QWORD PTR [v665]
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L66
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L67
+L66:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L67:
+L65:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L68
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L69
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L69:
+L68:
+jmp L63
+L64:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L70
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [v9]
+mov rax, 0
+push rax
+push QWORD PTR [v789]
+push QWORD PTR [rbp-32]
+push QWORD PTR [v789]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v789]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L70:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v86:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v157]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L71
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L71:
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L72:
+push QWORD PTR [rbp-80]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L73
+push QWORD PTR [rbp-48]
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L74
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L75
+L74:
+push QWORD PTR [rbp-96]
+mov rax, 92
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L76
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 116
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L77
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v125]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L78
+L77:
+push QWORD PTR [rbp-96]
+mov rax, 98
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L79
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v124]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L80
+L79:
+push QWORD PTR [rbp-96]
+mov rax, 110
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L81
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v126]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L82
+L81:
+push QWORD PTR [rbp-96]
+mov rax, 114
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L83
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v129]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L84
+L83:
+push QWORD PTR [rbp-96]
+mov rax, 102
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L85
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v128]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L86
+L85:
+push QWORD PTR [rbp-96]
+mov rax, 39
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L87
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov rax, 39
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L87:
+L86:
+L84:
+L82:
+L80:
+L78:
+jmp L88
+L76:
+push QWORD PTR [rbp-96]
+mov rax, 37
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L89
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L90
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L91
+L90:
+push QWORD PTR [rbp-96]
+mov rax, 99
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L92
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L93
+L92:
+push QWORD PTR [rbp-96]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L94
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L95
+L94:
+push QWORD PTR [rbp-96]
+mov rax, 105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L96
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L97
+L96:
+push QWORD PTR [rbp-96]
+mov rax, 42
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L98
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L99
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L100
+L99:
+L100:
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L101
+L98:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L101:
+L97:
+L95:
+L93:
+L91:
+jmp L102
+L89:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L102:
+L88:
+L75:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L103
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v38
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L103:
+jmp L72
+L73:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L104
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L104:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 112
+pop rbp
+ret
+v87:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov eax, [v159]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v90:
+push rbp
+mov rbp, rsp
+sub rsp, 1056
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-1048], al
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rax, 1024
+push rax
+lea rax, [rbp-1048]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+mov QWORD PTR [rbp-1056], rax
+push QWORD PTR [rbp-1056]
+lea rax, [rbp-1048]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v50
+add rsp, 1056
+pop rbp
+ret
+v92:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v321]
+pop rdi
+pop rsi
+pop rdx
+call v90
+add rsp, 16
+pop rbp
+ret
+v99:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L105
+lea rax, [rbp-16]
+push rax
+mov rax, OFFSET str3
+push rax
+push QWORD PTR [v322]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, 1
+push rax
+pop rdi
+call v54
+L105:
+add rsp, 16
+pop rbp
+ret
+v102:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 16
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L106:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v883]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L107
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v886
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L108
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L108:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L106
+L107:
+mov rax, OFFSET str4
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v881]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L109:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v884]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L110
+L111:
+mov rax, OFFSET v886
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [v882]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L112
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L111
+L112:
+mov rax, OFFSET v887
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L109
+L110:
+mov rax, OFFSET v891
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v103:
+push rbp
+mov rbp, rsp
+L113:
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+mov rax, OFFSET v892
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v23
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L114
+L115:
+mov rax, OFFSET v892
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L116
+call v74
+jmp L115
+L116:
+jmp L113
+L114:
+pop rbp
+ret
+v104:
+push rbp
+mov rbp, rsp
+mov rax, OFFSET v892
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v105:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, OFFSET v887
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 15
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v882]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v106:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+call v103
+push QWORD PTR [v891]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L117
+call v102
+L117:
+push QWORD PTR [rbp-8]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, OFFSET v886
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v888
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L118
+mov rax, OFFSET v888
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L119
+L118:
+mov rax, OFFSET v889
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v890
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L120
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+lea rax, [rbp-48]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-56]
+push QWORD PTR [v885]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v890
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [v885]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L120:
+push QWORD PTR [rbp-48]
+pop rax
+test rax, rax
+jz L121
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v889
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L121:
+L119:
+call v104
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L122
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+call v17
+L122:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v107:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+call v103
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v888
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v888
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+call v104
+add rsp, 24
+pop rbp
+ret
+v108:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L123
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v881]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L124
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v61
+jmp L125
+L124:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v107
+L125:
+L123:
+add rsp, 16
+pop rbp
+ret
+v109:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v881]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L126
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-16]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L127
+L126:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v106
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L127:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L128
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L128:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v110:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v881]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v881]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L129
+push QWORD PTR [v665]
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-40]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L130
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L130:
+jmp L131
+L129:
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v881]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [v881]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L132
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+call v105
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+call v105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L133
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+L133:
+L132:
+L131:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L134
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L135
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L136
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+L136:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-8]
+pop rdi
+call v108
+L135:
+L134:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v112:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-16], al
+lea rax, [rbp-16]
+push rax
+mov rax, 6278066737626506568
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 7792634774869013103
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 13
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v50
+add rsp, 24
+pop rbp
+ret
+v113:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-16], al
+lea rax, [rbp-16]
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+mov rax, 72
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 101
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 108
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 108
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 111
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 44
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 87
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 111
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 114
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 108
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 100
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+mov rax, 10
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+lea rax, [rbp-16]
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v50
+add rsp, 32
+pop rbp
+ret
+v114:
+push rbp
+mov rbp, rsp
+mov rax, 13
+push rax
+mov rax, OFFSET str5
+push rax
+mov rax, 1
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v50
+pop rbp
+ret
+main:
+push rbp
+mov rbp, rsp
+call v112
+call v113
+call v114
+pop rbp
+ret
+.data
+str0: .byte 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 97, 98, 99, 100, 101, 102, 0
+str1: .byte 48, 120, 0
+str2: .byte 48, 98, 0
+str3: .byte 91, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 93, 58, 32, 37, 115, 0
+str4: .byte 109, 101, 109, 111, 114, 121, 95, 105, 110, 105, 116, 58, 32, 115, 105, 122, 101, 32, 99, 108, 97, 115, 115, 101, 115, 32, 100, 111, 32, 110, 111, 116, 32, 101, 110, 100, 32, 97, 116, 32, 77, 69, 77, 79, 82, 89, 95, 83, 77, 65, 76, 76, 95, 77, 65, 88, 10, 0
+str5: .byte 72, 101, 108, 108, 111, 44, 32, 87, 111, 114, 108, 100, 10, 0
+v7: .quad 12601202263713404031
+v8: .quad 0
+v9: .quad 0
+v116: .byte 0
+v117: .byte 1
+v118: .byte 2
+v119: .byte 3
+v120: .byte 4
+v121: .byte 5
+v122: .byte 6
+v123: .byte 7
+v124: .byte 8
+v125: .byte 9
+v126: .byte 10
+v127: .byte 11
+v128: .byte 12
+v129: .byte 13
+v130: .byte 14
+v131: .byte 15
+v132: .byte 16
+v133: .byte 17
+v134: .byte 18
+v135: .byte 19
+v136: .byte 20
+v137: .byte 21
+v138: .byte 22
+v139: .byte 23
+v140: .byte 24
+v141: .byte 25
+v142: .byte 26
+v143: .byte 27
+v144: .byte 28
+v145: .byte 29
+v146: .byte 30
+v147: .byte 31
+v148: .quad 0
+v149: .quad 1
+v150: .quad 18446744073709551614
+v151: .quad 0
+v152: .quad 1
+v153: .quad 1048576
+v157: .quad 18446744073709551615
+v158: .quad 9223372036854775807
+v159: .long 4294967295
+v160: .long 2147483647
+v161: .word 65535
+v162: .word 32767
+v163: .byte 255
+v164: .byte 127
+v165: .quad 18446744073709551615
+v166: .quad 9223372036854775807
+v167: .long 4294967295
+v168: .long 2147483647
+v169: .word 65535
+v170: .word 32767
+v171: .byte 255
+v172: .byte 127
+v173: .quad 18446744073709551615
+v174: .quad 512
+v175: .quad 0
+v176: .quad 8
+v232: .quad 10
+v238: .quad 10
+v245: .quad 20
+v252: .quad 95
+v276: .quad 1
+v297: .quad 1
+v303: .quad 32
+v317: .quad 0
+v318: .quad 8
+v320: .quad 0
+v321: .quad 1
+v322: .quad 2
+v323: .quad 0
+v324: .quad 1
+v325: .quad 2
+v326: .quad 3
+v327: .quad 4
+v328: .quad 5
+v329: .quad 6
+v330: .quad 7
+v331: .quad 8
+v332: .quad 9
+v333: .quad 11
+v334: .quad 0
+v335: .quad 1
+v336: .quad 2
+v337: .quad 3
+v338: .quad 4
+v339: .quad 5
+v340: .quad 6
+v341: .quad 7
+v342: .quad 8
+v343: .quad 9
+v344: .quad 10
+v345: .quad 11
+v346: .quad 12
+v347: .quad 13
+v348: .quad 14
+v349: .quad 15
+v350: .quad 16
+v351: .quad 17
+v352: .quad 18
+v353: .quad 19
+v354: .quad 20
+v355: .quad 21
+v356: .quad 22
+v357: .quad 23
+v358: .quad 24
+v359: .quad 25
+v360: .quad 26
+v361: .quad 27
+v362: .quad 28
+v363: .quad 29
+v364: .quad 30
+v365: .quad 31
+v366: .quad 32
+v367: .quad 33
+v368: .quad 34
+v369: .quad 35
+v370: .quad 36
+v371: .quad 37
+v372: .quad 38
+v373: .quad 39
+v374: .quad 40
+v375: .quad 41
+v376: .quad 42
+v377: .quad 43
+v378: .quad 44
+v379: .quad 45
+v380: .quad 46
+v381: .quad 47
+v382: .quad 48
+v383: .quad 49
+v384: .quad 50
+v385: .quad 51
+v386: .quad 52
+v387: .quad 53
+v388: .quad 54
+v389: .quad 55
+v390: .quad 56
+v391: .quad 57
+v392: .quad 58
+v393: .quad 59
+v394: .quad 60
+v395: .quad 61
+v396: .quad 62
+v397: .quad 63
+v398: .quad 64
+v399: .quad 65
+v400: .quad 66
+v401: .quad 67
+v402: .quad 68
+v403: .quad 69
+v404: .quad 70
+v405: .quad 71
+v406: .quad 72
+v407: .quad 73
+v408: .quad 74
+v409: .quad 75
+v410: .quad 76
+v411: .quad 77
+v412: .quad 78
+v413: .quad 79
+v414: .quad 80
+v415: .quad 81
+v416: .quad 82
+v417: .quad 83
+v418: .quad 84
+v419: .quad 85
+v420: .quad 86
+v421: .quad 87
+v422: .quad 88
+v423: .quad 89
+v424: .quad 90
+v425: .quad 91
+v426: .quad 92
+v427: .quad 93
+v428: .quad 94
+v429: .quad 95
+v430: .quad 96
+v431: .quad 97
+v432: .quad 98
+v433: .quad 99
+v434: .quad 100
+v435: .quad 101
+v436: .quad 102
+v437: .quad 103
+v438: .quad 104
+v439: .quad 105
+v440: .quad 106
+v441: .quad 107
+v442: .quad 108
+v443: .quad 109
+v444: .quad 110
+v445: .quad 111
+v446: .quad 112
+v447: .quad 113
+v448: .quad 114
+v449: .quad 115
+v450: .quad 116
+v451: .quad 117
+v452: .quad 118
+v453: .quad 119
+v454: .quad 120
+v455: .quad 121
+v456: .quad 122
+v457: .quad 123
+v458: .quad 124
+v459: .quad 125
+v460: .quad 126
+v461: .quad 127
+v462: .quad 128
+v463: .quad 129
+v464: .quad 130
+v465: .quad 131
+v466: .quad 132
+v467: .quad 133
+v468: .quad 134
+v469: .quad 135
+v470: .quad 136
+v471: .quad 137
+v472: .quad 138
+v473: .quad 139
+v474: .quad 140
+v475: .quad 141
+v476: .quad 142
+v477: .quad 143
+v478: .quad 144
+v479: .quad 145
+v480: .quad 146
+v481: .quad 147
+v482: .quad 148
+v483: .quad 149
+v484: .quad 150
+v485: .quad 151
+v486: .quad 152
+v487: .quad 153
+v488: .quad 154
+v489: .quad 155
+v490: .quad 156
+v491: .quad 157
+v492: .quad 158
+v493: .quad 159
+v494: .quad 160
+v495: .quad 161
+v496: .quad 162
+v497: .quad 163
+v498: .quad 164
+v499: .quad 165
+v500: .quad 166
+v501: .quad 167
+v502: .quad 168
+v503: .quad 169
+v504: .quad 170
+v505: .quad 171
+v506: .quad 172
+v507: .quad 173
+v508: .quad 174
+v509: .quad 175
+v510: .quad 176
+v511: .quad 177
+v512: .quad 178
+v513: .quad 179
+v514: .quad 180
+v515: .quad 181
+v516: .quad 182
+v517: .quad 183
+v518: .quad 184
+v519: .quad 185
+v520: .quad 186
+v521: .quad 187
+v522: .quad 188
+v523: .quad 189
+v524: .quad 190
+v525: .quad 191
+v526: .quad 192
+v527: .quad 193
+v528: .quad 194
+v529: .quad 195
+v530: .quad 196
+v531: .quad 197
+v532: .quad 198
+v533: .quad 199
+v534: .quad 200
+v535: .quad 201
+v536: .quad 202
+v537: .quad 203
+v538: .quad 204
+v539: .quad 205
+v540: .quad 206
+v541: .quad 207
+v542: .quad 208
+v543: .quad 209
+v544: .quad 210
+v545: .quad 211
+v546: .quad 212
+v547: .quad 213
+v548: .quad 214
+v549: .quad 215
+v550: .quad 216
+v551: .quad 217
+v552: .quad 218
+v553: .quad 219
+v554: .quad 220
+v555: .quad 221
+v556: .quad 222
+v557: .quad 223
+v558: .quad 224
+v559: .quad 225
+v560: .quad 226
+v561: .quad 227
+v562: .quad 228
+v563: .quad 229
+v564: .quad 230
+v565: .quad 231
+v566: .quad 232
+v567: .quad 233
+v568: .quad 234
+v569: .quad 235
+v570: .quad 236
+v571: .quad 237
+v572: .quad 238
+v573: .quad 239
+v574: .quad 240
+v575: .quad 241
+v576: .quad 242
+v577: .quad 243
+v578: .quad 244
+v579: .quad 245
+v580: .quad 246
+v581: .quad 247
+v582: .quad 248
+v583: .quad 249
+v584: .quad 250
+v585: .quad 251
+v586: .quad 252
+v587: .quad 253
+v588: .quad 254
+v589: .quad 255
+v590: .quad 256
+v591: .quad 257
+v592: .quad 258
+v593: .quad 259
+v594: .quad 260
+v595: .quad 261
+v596: .quad 262
+v597: .quad 263
+v598: .quad 264
+v599: .quad 265
+v600: .quad 266
+v601: .quad 267
+v602: .quad 268
+v603: .quad 269
+v604: .quad 270
+v605: .quad 271
+v606: .quad 272
+v607: .quad 273
+v608: .quad 274
+v609: .quad 275
+v610: .quad 276
+v611: .quad 277
+v612: .quad 278
+v613: .quad 279
+v614: .quad 280
+v615: .quad 281
+v616: .quad 282
+v617: .quad 283
+v618: .quad 284
+v619: .quad 285
+v620: .quad 286
+v621: .quad 287
+v622: .quad 288
+v623: .quad 289
+v624: .quad 290
+v625: .quad 291
+v626: .quad 292
+v627: .quad 293
+v628: .quad 294
+v629: .quad 295
+v630: .quad 296
+v631: .quad 297
+v632: .quad 298
+v633: .quad 299
+v634: .quad 300
+v635: .quad 301
+v636: .quad 302
+v637: .quad 303
+v638: .quad 304
+v639: .quad 305
+v640: .quad 306
+v641: .quad 307
+v642: .quad 308
+v643: .quad 309
+v644: .quad 310
+v645: .quad 311
+v646: .quad 312
+v647: .quad 313
+v648: .quad 0
+v649: .quad 1
+v650: .quad 64
+v651: .quad 512
+v652: .quad 0
+v653: .quad 1
+v654: .quad 2
+v655: .quad 4
+v656: .quad 16777216
+v657: .quad 33554432
+v658: .quad 1
+v659: .quad 2
+v660: .quad 16
+v661: .quad 32
+v662: .quad 32
+v663: .quad 16384
+v664: .quad 131072
+v665: .quad 1
+v666: .quad 2
+v667: .quad 4
+v668: .quad 256
+v669: .quad 512
+v670: .quad 1024
+v671: .quad 2048
+v672: .quad 65536
+v673: .quad 262144
+v674: .quad 1048576
+v675: .quad 2097152
+v676: .quad 0
+v677: .quad 1
+v678: .quad 128
+v679: .quad 1
+v680: .quad 2
+v681: .quad 3
+v682: .quad 4
+v683: .quad 5
+v684: .quad 6
+v685: .quad 10
+v686: .quad 2
+v687: .quad 0
+v688: .quad 0
+v689: .quad 2
+v691: .quad 0
+v693: .quad 0
+v694: .quad 2
+v695: .quad 4
+v696: .quad 8
+v698: .quad 0
+v699: .quad 8
+v700: .quad 16
+v701: .quad 24
+v702: .quad 28
+v703: .quad 32
+v704: .quad 36
+v705: .quad 40
+v706: .quad 48
+v707: .quad 56
+v708: .quad 64
+v709: .quad 72
+v710: .quad 88
+v711: .quad 104
+v712: .quad 120
+v788: .quad 1024
+v789: .quad 4096
+v790: .quad 65536
+v881: .quad 2048
+v882: .quad 4
+v883: .quad 24
+v884: .quad 129
+v885: .quad 65536
+.bss
+v154: .zero 1048576
+v155: .zero 8
+v156: .zero 8
+v177: .zero 16
+v319: .zero 16
+v690: .zero 16
+v692: .zero 4
+v697: .zero 16
+v713: .zero 144
+v886: .zero 192
+v887: .zero 129
+v888: .zero 192
+v889: .zero 192
+v890: .zero 192
+v891: .zero 8
+v892: .zero 8
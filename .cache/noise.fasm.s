@@ -0,0 +1,9548 @@
+.intel_syntax noprefix
+.text
+.globl _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE PTR [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE PTR [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+strlen_sse2:
+mov rax, rdi
+and rax, -16
+mov rcx, rdi
+and ecx, 15
+pxor xmm0, xmm0
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+shr edx, cl
+test edx, edx
+jnz .head
+.loop:
+add rax, 16
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+test edx, edx
+jz .loop
+bsf edx, edx
+add rax, rdx
+sub rax, rdi
+ret
+.head:
+bsf eax, edx
+ret
+thread_clone:
+mov eax, 56
+syscall
+test rax, rax
+jz .child
+ret
+.child:
+xor ebp, ebp
+pop rax
+pop rdi
+call rax
+mov eax, 60
+xor edi, edi
+syscall
+_start:
+mov rdi, [rsp]
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax
+call main
+mov rax, 231
+mov rdi, 0
+syscall
+ret
+v11:
+push rbp
+mov rbp, rsp
+mov rax, OFFSET v195
+push rax
+mov rax, OFFSET v194
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v196
+push rax
+mov rax, OFFSET v194
+push rax
+push QWORD PTR [v193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v13:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L0:
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L1
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L0
+L1:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v16:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L2:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L3
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L4
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L5
+L4:
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L6
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L6:
+L5:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L2
+L3:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v17:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L7:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L8
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L7
+L8:
+add rsp, 32
+pop rbp
+ret
+v19:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L9:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L10
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L9
+L10:
+L11:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L12
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L11
+L12:
+add rsp, 40
+pop rbp
+ret
+v22:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v23:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v24:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L13:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L14
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L15
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L15:
+jmp L13
+L14:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v25:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L16
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v278]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+mul rbx
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L16:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L17:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L18
+push QWORD PTR [rbp-8]
+push QWORD PTR [v278]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-56]
+mov rax, OFFSET str0
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v278]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L17
+L18:
+add rsp, 56
+pop rbp
+ret
+v27:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 47
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 58
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v28:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 48
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 49
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v29:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v27
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 96
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 103
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 71
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v32:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 91
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L19
+lea rax, [rbp-8]
+push rax
+mov rax, 32
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L19:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v33:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 10
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L20
+mov rax, 2
+push rax
+mov rax, OFFSET str1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L21
+lea rax, [rbp-32]
+push rax
+mov rax, 16
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L22:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-56]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L23
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+pop rdi
+call v27
+push rax
+pop rax
+test rax, rax
+jz L24
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L25
+L24:
+push QWORD PTR [rbp-72]
+pop rdi
+call v29
+push rax
+pop rax
+test rax, rax
+jz L26
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 10
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 97
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L27
+L26:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v292]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L28
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v197]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L28:
+L27:
+L25:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L22
+L23:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L29
+L21:
+mov rax, 2
+push rax
+mov rax, OFFSET str2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L30
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L31:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L32
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+pop rdi
+call v28
+push rax
+pop rax
+test rax, rax
+jz L33
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L34
+L33:
+push QWORD PTR [rbp-80]
+push QWORD PTR [v292]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L35
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v197]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L35:
+L34:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L31
+L32:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L30:
+L29:
+L20:
+push QWORD PTR [rbp-48]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L36
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L37:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L38
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v292]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L39
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-88]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L39:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L37
+L38:
+L36:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v36:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v38:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD PTR [v316]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v39:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L40
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L41
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v36
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L42
+L41:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L43
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L44
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L45
+L44:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L45:
+L43:
+L42:
+L40:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v40:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L46
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L46:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v41:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L47
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L48
+L47:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L49
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L50
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L51
+L50:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L51:
+L49:
+L48:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v42:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L52
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v337]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L53
+L52:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L54
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v337]
+pop rbx
+pop rax
+mov [rax], rbx
+L54:
+L53:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v44:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L55
+push QWORD PTR [v195]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v196]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L56
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L57
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v195]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+mov rax, OFFSET v195
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L57:
+jmp L58
+L56:
+L58:
+L55:
+add rsp, 16
+pop rbp
+ret
+v49:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v374]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v50:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v375]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+add rsp, 32
+pop rbp
+ret
+v51:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v376]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v52:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v379]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v53:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v377]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v54:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v605]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v55:
+push rbp
+mov rbp, rsp
+mov rax, 0
+push rax
+push QWORD PTR [v575]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v59:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+mov [rbp-48], r9
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v383]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 48
+pop rbp
+ret
+v60:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v399]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+syscall
+push rax
+pop rax
+add rsp, 40
+pop rbp
+ret
+v61:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v385]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v62:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v384]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v63:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v433]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v64:
+push rbp
+mov rbp, rsp
+push QWORD PTR [v431]
+pop rax
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v65:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v435]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v67:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 127
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v70:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v457]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v74:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push QWORD PTR [v398]
+pop rax
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+add rsp, 8
+pop rbp
+ret
+v75:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v578]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v76:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v576]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v77:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop r10
+xor r8d, r8d
+call thread_clone
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v78:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [v830]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L59:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L60
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v830]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L59
+L60:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v80:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-160], rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v52
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L61
+lea rax, [rbp-160]
+push rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [v746]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L61:
+push QWORD PTR [rbp-160]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v81:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v830]
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+mov rax, 34
+push rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L62
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+L62:
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L63:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L64
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L65
+push QWORD PTR [v9]
+push QWORD PTR [v705]
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L66
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L67
+L66:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L67:
+L65:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L68
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L69
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L69:
+L68:
+jmp L63
+L64:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L70
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [v9]
+mov rax, 0
+push rax
+push QWORD PTR [v829]
+push QWORD PTR [rbp-32]
+push QWORD PTR [v829]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v829]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L70:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v86:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v197]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L71
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L71:
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L72:
+push QWORD PTR [rbp-80]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L73
+push QWORD PTR [rbp-48]
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L74
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L75
+L74:
+push QWORD PTR [rbp-96]
+mov rax, 92
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L76
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 116
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L77
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v165]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L78
+L77:
+push QWORD PTR [rbp-96]
+mov rax, 98
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L79
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v164]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L80
+L79:
+push QWORD PTR [rbp-96]
+mov rax, 110
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L81
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v166]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L82
+L81:
+push QWORD PTR [rbp-96]
+mov rax, 114
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L83
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v169]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L84
+L83:
+push QWORD PTR [rbp-96]
+mov rax, 102
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L85
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v168]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L86
+L85:
+push QWORD PTR [rbp-96]
+mov rax, 39
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L87
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov rax, 39
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L87:
+L86:
+L84:
+L82:
+L80:
+L78:
+jmp L88
+L76:
+push QWORD PTR [rbp-96]
+mov rax, 37
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L89
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L90
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L91
+L90:
+push QWORD PTR [rbp-96]
+mov rax, 99
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L92
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L93
+L92:
+push QWORD PTR [rbp-96]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L94
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L95
+L94:
+push QWORD PTR [rbp-96]
+mov rax, 105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L96
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L97
+L96:
+push QWORD PTR [rbp-96]
+mov rax, 42
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L98
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L99
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L100
+L99:
+L100:
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L101
+L98:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L101:
+L97:
+L95:
+L93:
+L91:
+jmp L102
+L89:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L102:
+L88:
+L75:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L103
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v38
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L103:
+jmp L72
+L73:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L104
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L104:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 112
+pop rbp
+ret
+v87:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov eax, [v199]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v90:
+push rbp
+mov rbp, rsp
+sub rsp, 1056
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-1048], al
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rax, 1024
+push rax
+lea rax, [rbp-1048]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+mov QWORD PTR [rbp-1056], rax
+push QWORD PTR [rbp-1056]
+lea rax, [rbp-1048]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v50
+add rsp, 1056
+pop rbp
+ret
+v92:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v361]
+pop rdi
+pop rsi
+pop rdx
+call v90
+add rsp, 16
+pop rbp
+ret
+v99:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L105
+lea rax, [rbp-16]
+push rax
+mov rax, OFFSET str3
+push rax
+push QWORD PTR [v362]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, 1
+push rax
+pop rdi
+call v54
+L105:
+add rsp, 16
+pop rbp
+ret
+v102:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 16
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L106:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v923]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L107
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v926
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L108
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L108:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L106
+L107:
+mov rax, OFFSET str4
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v921]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L109:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v924]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L110
+L111:
+mov rax, OFFSET v926
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [v922]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L112
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L111
+L112:
+mov rax, OFFSET v927
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L109
+L110:
+mov rax, OFFSET v931
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v103:
+push rbp
+mov rbp, rsp
+L113:
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+mov rax, OFFSET v932
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L114
+L115:
+mov rax, OFFSET v932
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L116
+call v74
+jmp L115
+L116:
+jmp L113
+L114:
+pop rbp
+ret
+v104:
+push rbp
+mov rbp, rsp
+mov rax, OFFSET v932
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v105:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, OFFSET v927
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 15
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v922]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v106:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+call v103
+push QWORD PTR [v931]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L117
+call v102
+L117:
+push QWORD PTR [rbp-8]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, OFFSET v926
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v928
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L118
+mov rax, OFFSET v928
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L119
+L118:
+mov rax, OFFSET v929
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v930
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L120
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+lea rax, [rbp-48]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-56]
+push QWORD PTR [v925]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v930
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [v925]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L120:
+push QWORD PTR [rbp-48]
+pop rax
+test rax, rax
+jz L121
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v929
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L121:
+L119:
+call v104
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L122
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+call v17
+L122:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v107:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+call v103
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v928
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v928
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+call v104
+add rsp, 24
+pop rbp
+ret
+v108:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L123
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v921]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L124
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v61
+jmp L125
+L124:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v107
+L125:
+L123:
+add rsp, 16
+pop rbp
+ret
+v109:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v921]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L126
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-16]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L127
+L126:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v106
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L127:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L128
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L128:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v110:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v921]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v921]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L129
+push QWORD PTR [v705]
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-40]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L130
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L130:
+jmp L131
+L129:
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v921]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [v921]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L132
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+call v105
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+call v105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L133
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+L133:
+L132:
+L131:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L134
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L135
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L136
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+L136:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-8]
+pop rdi
+call v108
+L135:
+L134:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v115:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v116:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v981]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+mov rax, 31
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 33
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v980]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v117:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+call v116
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v980]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v983]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v118:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-16], rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 33
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v981]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 29
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v982]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v119:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+mov rax, 32
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L137
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v984]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L138
+L137:
+mov rax, 6983438078262162902
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [v981]
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 7046029288634856825
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L139:
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L140
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v116
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v116
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+call v116
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v116
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L139
+L140:
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v115
+push rax
+mov rax, 7
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v115
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 12
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+call v115
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 18
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v115
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v117
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v117
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v117
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v117
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L138:
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L141:
+push QWORD PTR [rbp-24]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L142
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+call v116
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 27
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 37
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v980]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v983]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L141
+L142:
+push QWORD PTR [rbp-24]
+mov rax, 4
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L143
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+push QWORD PTR [v980]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 23
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 41
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v981]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v982]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 4
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L143:
+L144:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L145
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [v984]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 11
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 53
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v980]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L144
+L145:
+push QWORD PTR [rbp-32]
+pop rdi
+call v118
+push rax
+pop rax
+add rsp, 72
+pop rbp
+ret
+v121:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v980]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v118
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v122:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L146:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L147
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L146
+L147:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v123:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+mov rax, 4294967295
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 128
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v124:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+mov rax, 129
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v125:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1020]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v126:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L148
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L149
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v122
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L149:
+L150:
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L151
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v123
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v122
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L150
+L151:
+L148:
+add rsp, 16
+pop rbp
+ret
+v128:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L152
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1020]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v124
+L152:
+add rsp, 8
+pop rbp
+ret
+v129:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1027]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v130:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1027]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v128
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v123
+L153:
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v122
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L154
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v123
+jmp L153
+L154:
+add rsp, 24
+pop rbp
+ret
+v131:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v124
+add rsp, 16
+pop rbp
+ret
+v132:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [v1007]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v124
+add rsp, 16
+pop rbp
+ret
+v133:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8392704
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 131106
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L155
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L156
+L155:
+push QWORD PTR [v692]
+push QWORD PTR [v829]
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+pop rdx
+call v62
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-40]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-80]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1037]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1038]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1037]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1037]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1006]
+pop rdi
+pop rsi
+pop rdx
+pop r10
+xor r8d, r8d
+call thread_clone
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L157
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L157:
+L156:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v134:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1037]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+L158:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L159
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v716]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1037]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1037]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L158
+L159:
+mov rax, 8392704
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1038]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v61
+add rsp, 24
+pop rbp
+ret
+v135:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-128], al
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-136], rax
+lea rax, [rbp-128]
+push rax
+mov rax, 128
+push rax
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v75
+push rax
+pop rax
+mov QWORD PTR [rbp-144], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-152], rax
+L160:
+push QWORD PTR [rbp-144]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-152]
+push QWORD PTR [rbp-144]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L161
+lea rax, [rbp-128]
+push rax
+push QWORD PTR [rbp-152]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-160], rax
+L162:
+push QWORD PTR [rbp-160]
+pop rax
+test rax, rax
+jz L163
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [rbp-136]
+push QWORD PTR [rbp-160]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-160]
+push rax
+push QWORD PTR [rbp-160]
+mov rax, 1
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L162
+L163:
+lea rax, [rbp-152]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-152]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L160
+L161:
+push QWORD PTR [rbp-136]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L164
+lea rax, [rbp-136]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L164:
+push QWORD PTR [rbp-136]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v136:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+add rsp, 16
+pop rbp
+ret
+v137:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1066]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 16
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 4095
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v138:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1065]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [v1008]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L165
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v137
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1065]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L165:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v139:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1065]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1065]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v122
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L166
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v137
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L167
+push QWORD PTR [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L168
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L168:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1065]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L167:
+jmp L169
+L166:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1065]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L169:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v140:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1065]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-40]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L170
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v137
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L171
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L171:
+L170:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v141:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1092]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+mov rax, 56
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v143:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1101]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1102]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L172
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v126
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1095]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v131
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v128
+L172:
+add rsp, 16
+pop rbp
+ret
+v144:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v126
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1099]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1097]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1098]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1096]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L173
+mov rax, 2
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, OFFSET str5
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+L174:
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L175
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L174
+L175:
+push QWORD PTR [rbp-56]
+pop rdi
+call v108
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1096]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1097]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1099]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+L173:
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1098]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v128
+add rsp, 80
+pop rbp
+ret
+v145:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1098]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L176
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v126
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1098]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L177
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1097]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1096]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1097]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1099]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1098]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L177:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v128
+L176:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v146:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v139
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L178
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v145
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L178:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L179
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+L180:
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L181
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-64]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L180
+L181:
+L179:
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L182
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1101]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+L182:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v147:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v136
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-32]
+pop rax
+pop rdi
+pop rsi
+call rax
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1100]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L183
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v126
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1095]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v132
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v128
+L183:
+add rsp, 32
+pop rbp
+ret
+v148:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+L184:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1103]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L185
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v146
+push rax
+pop rax
+test rax, rax
+jz L186
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+jmp L187
+L186:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v126
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1102]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+L188:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1101]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1103]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L189
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1095]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v130
+jmp L188
+L189:
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1102]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v128
+L187:
+jmp L184
+L185:
+add rsp, 48
+pop rbp
+ret
+v149:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L190
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L190:
+push QWORD PTR [rbp-16]
+mov rax, 56
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 1024
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, OFFSET str6
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1092]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v125
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1095]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v129
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1096]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1097]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1098]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1099]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1009]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1100]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1101]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1102]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1103]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L191:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L192
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 65536
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, OFFSET str7
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1064]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1065]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1066]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L191
+L192:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L193:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L194
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+mov rax, OFFSET v148
+push rax
+push QWORD PTR [rbp-72]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v133
+push rax
+pop rax
+test rax, rax
+jz L195
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L196
+L195:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L196:
+jmp L193
+L194:
+L197:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L198
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v141
+push rax
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1066]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L197
+L198:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v150:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1100]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+pop rdi
+call v143
+add rsp, 32
+pop rbp
+ret
+v152:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L199:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1100]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L200
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v146
+push rax
+pop rax
+test rax, rax
+jz L201
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v147
+jmp L202
+L201:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v126
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1102]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+L203:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1100]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1101]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L204
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1095]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v130
+jmp L203
+L204:
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1102]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v128
+L202:
+jmp L199
+L200:
+add rsp, 48
+pop rbp
+ret
+v153:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v152
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v126
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1103]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1095]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v132
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v128
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L205:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L206
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L207
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v134
+L207:
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1066]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L205
+L206:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1092]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1096]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1092]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v154:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L208:
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1171]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L209
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1171]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [v1174]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1173]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rdi
+call v121
+push rax
+mov rax, 255
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L208
+L209:
+add rsp, 40
+pop rbp
+ret
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 224
+call v11
+mov rax, OFFSET v1173
+push rax
+call v55
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1174
+push rax
+mov rax, 16384
+push rax
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET str8
+push rax
+push QWORD PTR [v1174]
+pop rdi
+pop rsi
+call v99
+mov rax, OFFSET str9
+push rax
+call v135
+push rax
+lea rax, [rbp-96]
+push rax
+pop rdi
+pop rsi
+call v149
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-104], rax
+L210:
+push QWORD PTR [rbp-104]
+push QWORD PTR [v1172]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L211
+push QWORD PTR [rbp-104]
+mov rax, OFFSET v154
+push rax
+lea rax, [rbp-96]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v150
+lea rax, [rbp-104]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-104]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L210
+L211:
+lea rax, [rbp-96]
+push rax
+pop rdi
+call v153
+mov rax, 434
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+mov rax, OFFSET str10
+push rax
+pop rax
+mov QWORD PTR [rbp-120], rax
+push QWORD PTR [rbp-112]
+mov rax, 577
+push rax
+push QWORD PTR [rbp-120]
+pop rdi
+pop rsi
+pop rdx
+call v51
+push rax
+pop rax
+mov QWORD PTR [rbp-128], rax
+push QWORD PTR [rbp-128]
+push QWORD PTR [v190]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L212
+push QWORD PTR [v1171]
+pop rax
+mov QWORD PTR [rbp-136], rax
+push QWORD PTR [v1172]
+pop rax
+mov QWORD PTR [rbp-144], rax
+push QWORD PTR [rbp-120]
+push QWORD PTR [rbp-136]
+push QWORD PTR [rbp-144]
+push QWORD PTR [v1187]
+pop rax
+mov QWORD PTR [rbp-152], rax
+pop rax
+mov QWORD PTR [rbp-160], rax
+pop rax
+mov QWORD PTR [rbp-168], rax
+pop rax
+mov QWORD PTR [rbp-176], rax
+lea rax, [rbp-176]
+push rax
+mov rax, OFFSET str11
+push rax
+push QWORD PTR [rbp-128]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-184], rax
+L213:
+push QWORD PTR [rbp-184]
+push QWORD PTR [rbp-144]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L214
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-192], rax
+L215:
+push QWORD PTR [rbp-192]
+push QWORD PTR [rbp-136]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L216
+push QWORD PTR [v1174]
+push QWORD PTR [rbp-184]
+push QWORD PTR [rbp-136]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-200], rax
+push QWORD PTR [rbp-200]
+push QWORD PTR [rbp-200]
+push QWORD PTR [rbp-200]
+pop rax
+mov QWORD PTR [rbp-208], rax
+pop rax
+mov QWORD PTR [rbp-216], rax
+pop rax
+mov QWORD PTR [rbp-224], rax
+lea rax, [rbp-224]
+push rax
+mov rax, OFFSET str12
+push rax
+push QWORD PTR [rbp-128]
+pop rdi
+pop rsi
+pop rdx
+call v90
+push QWORD PTR [rbp-192]
+mov rax, 4
+push rax
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L217
+push QWORD PTR [v9]
+mov rax, OFFSET str13
+push rax
+push QWORD PTR [rbp-128]
+pop rdi
+pop rsi
+pop rdx
+call v90
+L217:
+lea rax, [rbp-192]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L215
+L216:
+push QWORD PTR [v9]
+mov rax, OFFSET str14
+push rax
+push QWORD PTR [rbp-128]
+pop rdi
+pop rsi
+pop rdx
+call v90
+lea rax, [rbp-184]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-184]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L213
+L214:
+push QWORD PTR [rbp-128]
+pop rdi
+call v53
+L212:
+push QWORD PTR [v1174]
+pop rdi
+call v108
+add rsp, 224
+pop rbp
+ret
+.data
+str0: .byte 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 97, 98, 99, 100, 101, 102, 0
+str1: .byte 48, 120, 0
+str2: .byte 48, 98, 0
+str3: .byte 91, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 93, 58, 32, 37, 115, 0
+str4: .byte 109, 101, 109, 111, 114, 121, 95, 105, 110, 105, 116, 58, 32, 115, 105, 122, 101, 32, 99, 108, 97, 115, 115, 101, 115, 32, 100, 111, 32, 110, 111, 116, 32, 101, 110, 100, 32, 97, 116, 32, 77, 69, 77, 79, 82, 89, 95, 83, 77, 65, 76, 76, 95, 77, 65, 88, 10, 0
+str5: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 115, 117, 98, 109, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str6: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 105, 110, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str7: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 105, 110, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str8: .byte 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str9: .byte 102, 97, 105, 108, 101, 100, 32, 116, 111, 32, 115, 116, 97, 114, 116, 32, 116, 104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 111, 111, 108, 10, 0
+str10: .byte 110, 111, 105, 115, 101, 46, 112, 112, 109, 0
+str11: .byte 80, 51, 10, 35, 32, 96, 37, 115, 96, 10, 37, 100, 32, 37, 100, 10, 37, 100, 10, 0
+str12: .byte 32, 37, 100, 32, 37, 100, 32, 37, 100, 32, 0
+str13: .byte 10, 0
+str14: .byte 10, 0, 0, 0, 0, 0, 0, 0
+v7: .quad 16147047056489238405
+v8: .quad 0
+v9: .quad 0
+v156: .byte 0, 0, 0, 0, 0, 0, 0, 0
+v157: .byte 1, 0, 0, 0, 0, 0, 0, 0
+v158: .byte 2, 0, 0, 0, 0, 0, 0, 0
+v159: .byte 3, 0, 0, 0, 0, 0, 0, 0
+v160: .byte 4, 0, 0, 0, 0, 0, 0, 0
+v161: .byte 5, 0, 0, 0, 0, 0, 0, 0
+v162: .byte 6, 0, 0, 0, 0, 0, 0, 0
+v163: .byte 7, 0, 0, 0, 0, 0, 0, 0
+v164: .byte 8, 0, 0, 0, 0, 0, 0, 0
+v165: .byte 9, 0, 0, 0, 0, 0, 0, 0
+v166: .byte 10, 0, 0, 0, 0, 0, 0, 0
+v167: .byte 11, 0, 0, 0, 0, 0, 0, 0
+v168: .byte 12, 0, 0, 0, 0, 0, 0, 0
+v169: .byte 13, 0, 0, 0, 0, 0, 0, 0
+v170: .byte 14, 0, 0, 0, 0, 0, 0, 0
+v171: .byte 15, 0, 0, 0, 0, 0, 0, 0
+v172: .byte 16, 0, 0, 0, 0, 0, 0, 0
+v173: .byte 17, 0, 0, 0, 0, 0, 0, 0
+v174: .byte 18, 0, 0, 0, 0, 0, 0, 0
+v175: .byte 19, 0, 0, 0, 0, 0, 0, 0
+v176: .byte 20, 0, 0, 0, 0, 0, 0, 0
+v177: .byte 21, 0, 0, 0, 0, 0, 0, 0
+v178: .byte 22, 0, 0, 0, 0, 0, 0, 0
+v179: .byte 23, 0, 0, 0, 0, 0, 0, 0
+v180: .byte 24, 0, 0, 0, 0, 0, 0, 0
+v181: .byte 25, 0, 0, 0, 0, 0, 0, 0
+v182: .byte 26, 0, 0, 0, 0, 0, 0, 0
+v183: .byte 27, 0, 0, 0, 0, 0, 0, 0
+v184: .byte 28, 0, 0, 0, 0, 0, 0, 0
+v185: .byte 29, 0, 0, 0, 0, 0, 0, 0
+v186: .byte 30, 0, 0, 0, 0, 0, 0, 0
+v187: .byte 31, 0, 0, 0, 0, 0, 0, 0
+v188: .quad 0
+v189: .quad 1
+v190: .quad 18446744073709551614
+v191: .quad 0
+v192: .quad 1
+v193: .quad 1048576
+v197: .quad 18446744073709551615
+v198: .quad 9223372036854775807
+v199: .long 4294967295, 0
+v200: .long 2147483647, 0
+v201: .word 65535, 0, 0, 0
+v202: .word 32767, 0, 0, 0
+v203: .byte 255, 0, 0, 0, 0, 0, 0, 0
+v204: .byte 127, 0, 0, 0, 0, 0, 0, 0
+v205: .quad 18446744073709551615
+v206: .quad 9223372036854775807
+v207: .long 4294967295, 0
+v208: .long 2147483647, 0
+v209: .word 65535, 0, 0, 0
+v210: .word 32767, 0, 0, 0
+v211: .byte 255, 0, 0, 0, 0, 0, 0, 0
+v212: .byte 127, 0, 0, 0, 0, 0, 0, 0
+v213: .quad 18446744073709551615
+v214: .quad 512
+v215: .quad 0
+v216: .quad 8
+v272: .quad 10
+v278: .quad 10
+v285: .quad 20
+v292: .quad 95
+v316: .quad 1
+v337: .quad 1
+v343: .quad 32
+v357: .quad 0
+v358: .quad 8
+v360: .quad 0
+v361: .quad 1
+v362: .quad 2
+v363: .quad 0
+v364: .quad 1
+v365: .quad 2
+v366: .quad 3
+v367: .quad 4
+v368: .quad 5
+v369: .quad 6
+v370: .quad 7
+v371: .quad 8
+v372: .quad 9
+v373: .quad 11
+v374: .quad 0
+v375: .quad 1
+v376: .quad 2
+v377: .quad 3
+v378: .quad 4
+v379: .quad 5
+v380: .quad 6
+v381: .quad 7
+v382: .quad 8
+v383: .quad 9
+v384: .quad 10
+v385: .quad 11
+v386: .quad 12
+v387: .quad 13
+v388: .quad 14
+v389: .quad 15
+v390: .quad 16
+v391: .quad 17
+v392: .quad 18
+v393: .quad 19
+v394: .quad 20
+v395: .quad 21
+v396: .quad 22
+v397: .quad 23
+v398: .quad 24
+v399: .quad 25
+v400: .quad 26
+v401: .quad 27
+v402: .quad 28
+v403: .quad 29
+v404: .quad 30
+v405: .quad 31
+v406: .quad 32
+v407: .quad 33
+v408: .quad 34
+v409: .quad 35
+v410: .quad 36
+v411: .quad 37
+v412: .quad 38
+v413: .quad 39
+v414: .quad 40
+v415: .quad 41
+v416: .quad 42
+v417: .quad 43
+v418: .quad 44
+v419: .quad 45
+v420: .quad 46
+v421: .quad 47
+v422: .quad 48
+v423: .quad 49
+v424: .quad 50
+v425: .quad 51
+v426: .quad 52
+v427: .quad 53
+v428: .quad 54
+v429: .quad 55
+v430: .quad 56
+v431: .quad 57
+v432: .quad 58
+v433: .quad 59
+v434: .quad 60
+v435: .quad 61
+v436: .quad 62
+v437: .quad 63
+v438: .quad 64
+v439: .quad 65
+v440: .quad 66
+v441: .quad 67
+v442: .quad 68
+v443: .quad 69
+v444: .quad 70
+v445: .quad 71
+v446: .quad 72
+v447: .quad 73
+v448: .quad 74
+v449: .quad 75
+v450: .quad 76
+v451: .quad 77
+v452: .quad 78
+v453: .quad 79
+v454: .quad 80
+v455: .quad 81
+v456: .quad 82
+v457: .quad 83
+v458: .quad 84
+v459: .quad 85
+v460: .quad 86
+v461: .quad 87
+v462: .quad 88
+v463: .quad 89
+v464: .quad 90
+v465: .quad 91
+v466: .quad 92
+v467: .quad 93
+v468: .quad 94
+v469: .quad 95
+v470: .quad 96
+v471: .quad 97
+v472: .quad 98
+v473: .quad 99
+v474: .quad 100
+v475: .quad 101
+v476: .quad 102
+v477: .quad 103
+v478: .quad 104
+v479: .quad 105
+v480: .quad 106
+v481: .quad 107
+v482: .quad 108
+v483: .quad 109
+v484: .quad 110
+v485: .quad 111
+v486: .quad 112
+v487: .quad 113
+v488: .quad 114
+v489: .quad 115
+v490: .quad 116
+v491: .quad 117
+v492: .quad 118
+v493: .quad 119
+v494: .quad 120
+v495: .quad 121
+v496: .quad 122
+v497: .quad 123
+v498: .quad 124
+v499: .quad 125
+v500: .quad 126
+v501: .quad 127
+v502: .quad 128
+v503: .quad 129
+v504: .quad 130
+v505: .quad 131
+v506: .quad 132
+v507: .quad 133
+v508: .quad 134
+v509: .quad 135
+v510: .quad 136
+v511: .quad 137
+v512: .quad 138
+v513: .quad 139
+v514: .quad 140
+v515: .quad 141
+v516: .quad 142
+v517: .quad 143
+v518: .quad 144
+v519: .quad 145
+v520: .quad 146
+v521: .quad 147
+v522: .quad 148
+v523: .quad 149
+v524: .quad 150
+v525: .quad 151
+v526: .quad 152
+v527: .quad 153
+v528: .quad 154
+v529: .quad 155
+v530: .quad 156
+v531: .quad 157
+v532: .quad 158
+v533: .quad 159
+v534: .quad 160
+v535: .quad 161
+v536: .quad 162
+v537: .quad 163
+v538: .quad 164
+v539: .quad 165
+v540: .quad 166
+v541: .quad 167
+v542: .quad 168
+v543: .quad 169
+v544: .quad 170
+v545: .quad 171
+v546: .quad 172
+v547: .quad 173
+v548: .quad 174
+v549: .quad 175
+v550: .quad 176
+v551: .quad 177
+v552: .quad 178
+v553: .quad 179
+v554: .quad 180
+v555: .quad 181
+v556: .quad 182
+v557: .quad 183
+v558: .quad 184
+v559: .quad 185
+v560: .quad 186
+v561: .quad 187
+v562: .quad 188
+v563: .quad 189
+v564: .quad 190
+v565: .quad 191
+v566: .quad 192
+v567: .quad 193
+v568: .quad 194
+v569: .quad 195
+v570: .quad 196
+v571: .quad 197
+v572: .quad 198
+v573: .quad 199
+v574: .quad 200
+v575: .quad 201
+v576: .quad 202
+v577: .quad 203
+v578: .quad 204
+v579: .quad 205
+v580: .quad 206
+v581: .quad 207
+v582: .quad 208
+v583: .quad 209
+v584: .quad 210
+v585: .quad 211
+v586: .quad 212
+v587: .quad 213
+v588: .quad 214
+v589: .quad 215
+v590: .quad 216
+v591: .quad 217
+v592: .quad 218
+v593: .quad 219
+v594: .quad 220
+v595: .quad 221
+v596: .quad 222
+v597: .quad 223
+v598: .quad 224
+v599: .quad 225
+v600: .quad 226
+v601: .quad 227
+v602: .quad 228
+v603: .quad 229
+v604: .quad 230
+v605: .quad 231
+v606: .quad 232
+v607: .quad 233
+v608: .quad 234
+v609: .quad 235
+v610: .quad 236
+v611: .quad 237
+v612: .quad 238
+v613: .quad 239
+v614: .quad 240
+v615: .quad 241
+v616: .quad 242
+v617: .quad 243
+v618: .quad 244
+v619: .quad 245
+v620: .quad 246
+v621: .quad 247
+v622: .quad 248
+v623: .quad 249
+v624: .quad 250
+v625: .quad 251
+v626: .quad 252
+v627: .quad 253
+v628: .quad 254
+v629: .quad 255
+v630: .quad 256
+v631: .quad 257
+v632: .quad 258
+v633: .quad 259
+v634: .quad 260
+v635: .quad 261
+v636: .quad 262
+v637: .quad 263
+v638: .quad 264
+v639: .quad 265
+v640: .quad 266
+v641: .quad 267
+v642: .quad 268
+v643: .quad 269
+v644: .quad 270
+v645: .quad 271
+v646: .quad 272
+v647: .quad 273
+v648: .quad 274
+v649: .quad 275
+v650: .quad 276
+v651: .quad 277
+v652: .quad 278
+v653: .quad 279
+v654: .quad 280
+v655: .quad 281
+v656: .quad 282
+v657: .quad 283
+v658: .quad 284
+v659: .quad 285
+v660: .quad 286
+v661: .quad 287
+v662: .quad 288
+v663: .quad 289
+v664: .quad 290
+v665: .quad 291
+v666: .quad 292
+v667: .quad 293
+v668: .quad 294
+v669: .quad 295
+v670: .quad 296
+v671: .quad 297
+v672: .quad 298
+v673: .quad 299
+v674: .quad 300
+v675: .quad 301
+v676: .quad 302
+v677: .quad 303
+v678: .quad 304
+v679: .quad 305
+v680: .quad 306
+v681: .quad 307
+v682: .quad 308
+v683: .quad 309
+v684: .quad 310
+v685: .quad 311
+v686: .quad 312
+v687: .quad 313
+v688: .quad 0
+v689: .quad 1
+v690: .quad 64
+v691: .quad 512
+v692: .quad 0
+v693: .quad 1
+v694: .quad 2
+v695: .quad 4
+v696: .quad 16777216
+v697: .quad 33554432
+v698: .quad 1
+v699: .quad 2
+v700: .quad 16
+v701: .quad 32
+v702: .quad 32
+v703: .quad 16384
+v704: .quad 131072
+v705: .quad 1
+v706: .quad 2
+v707: .quad 4
+v708: .quad 256
+v709: .quad 512
+v710: .quad 1024
+v711: .quad 2048
+v712: .quad 65536
+v713: .quad 262144
+v714: .quad 1048576
+v715: .quad 2097152
+v716: .quad 0
+v717: .quad 1
+v718: .quad 128
+v719: .quad 1
+v720: .quad 2
+v721: .quad 3
+v722: .quad 4
+v723: .quad 5
+v724: .quad 6
+v725: .quad 10
+v726: .quad 2
+v727: .quad 0
+v728: .quad 0
+v729: .quad 2
+v731: .quad 0
+v733: .quad 0
+v734: .quad 2
+v735: .quad 4
+v736: .quad 8
+v738: .quad 0
+v739: .quad 8
+v740: .quad 16
+v741: .quad 24
+v742: .quad 28
+v743: .quad 32
+v744: .quad 36
+v745: .quad 40
+v746: .quad 48
+v747: .quad 56
+v748: .quad 64
+v749: .quad 72
+v750: .quad 88
+v751: .quad 104
+v752: .quad 120
+v828: .quad 1024
+v829: .quad 4096
+v830: .quad 65536
+v921: .quad 2048
+v922: .quad 4
+v923: .quad 24
+v924: .quad 129
+v925: .quad 65536
+v980: .quad 11400714785074694791
+v981: .quad 14029467366897019727
+v982: .quad 1609587929392839161
+v983: .quad 9650029242287828579
+v984: .quad 2870177450012600261
+v1005: .quad 8388608
+v1006: .quad 3477248
+v1007: .quad 2147483647
+v1008: .quad 4096
+v1009: .quad 64
+v1020: .quad 0
+v1027: .quad 0
+v1037: .quad 0
+v1038: .quad 8
+v1059: .quad 0
+v1060: .quad 8
+v1064: .quad 0
+v1065: .quad 8
+v1066: .quad 16
+v1087: .quad 0
+v1088: .quad 8
+v1089: .quad 16
+v1090: .quad 32
+v1092: .quad 0
+v1093: .quad 8
+v1094: .quad 16
+v1095: .quad 24
+v1096: .quad 32
+v1097: .quad 40
+v1098: .quad 48
+v1099: .quad 56
+v1100: .quad 64
+v1101: .quad 72
+v1102: .quad 80
+v1103: .quad 88
+v1171: .quad 128
+v1172: .quad 128
+v1187: .quad 255
+.bss
+v194: .zero 1048576
+v195: .zero 8
+v196: .zero 8
+v217: .zero 16
+v359: .zero 16
+v730: .zero 16
+v732: .zero 8
+v737: .zero 16
+v753: .zero 144
+v926: .zero 192
+v927: .zero 136
+v928: .zero 192
+v929: .zero 192
+v930: .zero 192
+v931: .zero 8
+v932: .zero 8
+v1021: .zero 8
+v1028: .zero 8
+v1039: .zero 16
+v1061: .zero 16
+v1067: .zero 24
+v1091: .zero 56
+v1104: .zero 96
+v1173: .zero 8
+v1174: .zero 8
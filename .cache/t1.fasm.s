@@ -0,0 +1,9420 @@
+.intel_syntax noprefix
+.text
+.globl _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE PTR [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE PTR [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+strlen_sse2:
+mov rax, rdi
+and rax, -16
+mov rcx, rdi
+and ecx, 15
+pxor xmm0, xmm0
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+shr edx, cl
+test edx, edx
+jnz .head
+.loop:
+add rax, 16
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+test edx, edx
+jz .loop
+bsf edx, edx
+add rax, rdx
+sub rax, rdi
+ret
+.head:
+bsf eax, edx
+ret
+thread_clone:
+mov eax, 56
+syscall
+test rax, rax
+jz .child
+ret
+.child:
+xor ebp, ebp
+pop rax
+pop rdi
+call rax
+mov eax, 60
+xor edi, edi
+syscall
+_start:
+mov rdi, [rsp]
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax
+call main
+mov rax, 231
+mov rdi, 0
+syscall
+ret
+v13:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L0:
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L1
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L0
+L1:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v16:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L2:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L3
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L4
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L5
+L4:
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L6
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L6:
+L5:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L2
+L3:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v17:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L7:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L8
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L7
+L8:
+add rsp, 32
+pop rbp
+ret
+v19:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L9:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L10
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L9
+L10:
+L11:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L12
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L11
+L12:
+add rsp, 40
+pop rbp
+ret
+v22:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v23:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v24:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L13:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L14
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L15
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L15:
+jmp L13
+L14:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v25:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L16
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v276]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+mul rbx
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L16:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L17:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L18
+push QWORD PTR [rbp-8]
+push QWORD PTR [v276]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-56]
+mov rax, OFFSET str0
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v276]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L17
+L18:
+add rsp, 56
+pop rbp
+ret
+v27:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 47
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 58
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v28:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 48
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 49
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v29:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v27
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 96
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 103
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 71
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v32:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 91
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L19
+lea rax, [rbp-8]
+push rax
+mov rax, 32
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L19:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v33:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 10
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L20
+mov rax, 2
+push rax
+mov rax, OFFSET str1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L21
+lea rax, [rbp-32]
+push rax
+mov rax, 16
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L22:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-56]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L23
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+pop rdi
+call v27
+push rax
+pop rax
+test rax, rax
+jz L24
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L25
+L24:
+push QWORD PTR [rbp-72]
+pop rdi
+call v29
+push rax
+pop rax
+test rax, rax
+jz L26
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 10
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 97
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L27
+L26:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v290]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L28
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v195]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L28:
+L27:
+L25:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L22
+L23:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L29
+L21:
+mov rax, 2
+push rax
+mov rax, OFFSET str2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L30
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L31:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L32
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+pop rdi
+call v28
+push rax
+pop rax
+test rax, rax
+jz L33
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L34
+L33:
+push QWORD PTR [rbp-80]
+push QWORD PTR [v290]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L35
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v195]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L35:
+L34:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L31
+L32:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L30:
+L29:
+L20:
+push QWORD PTR [rbp-48]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L36
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L37:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L38
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v290]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L39
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-88]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L39:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L37
+L38:
+L36:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v36:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v38:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD PTR [v314]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v39:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L40
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L41
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v36
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L42
+L41:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L43
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L44
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L45
+L44:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L45:
+L43:
+L42:
+L40:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v40:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L46
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L46:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v41:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L47
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L48
+L47:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L49
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L50
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L51
+L50:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L51:
+L49:
+L48:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v42:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L52
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v335]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L53
+L52:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L54
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v335]
+pop rbx
+pop rax
+mov [rax], rbx
+L54:
+L53:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v44:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L55
+push QWORD PTR [v193]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v194]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L56
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L57
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v193]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+mov rax, OFFSET v193
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L57:
+jmp L58
+L56:
+L58:
+L55:
+add rsp, 16
+pop rbp
+ret
+v49:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v372]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v50:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v373]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+add rsp, 32
+pop rbp
+ret
+v51:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v374]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v52:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v377]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v54:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v603]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v57:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v600]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v59:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+mov [rbp-48], r9
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v381]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 48
+pop rbp
+ret
+v60:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v397]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+syscall
+push rax
+pop rax
+add rsp, 40
+pop rbp
+ret
+v61:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v383]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v62:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v382]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v63:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v431]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v64:
+push rbp
+mov rbp, rsp
+push QWORD PTR [v429]
+pop rax
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v65:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v433]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v67:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 127
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v70:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v455]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v74:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push QWORD PTR [v396]
+pop rax
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+add rsp, 8
+pop rbp
+ret
+v75:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v576]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v76:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v574]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v77:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop r10
+xor r8d, r8d
+call thread_clone
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v78:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [v828]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L59:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L60
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v828]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L59
+L60:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v80:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-160], rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v52
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L61
+lea rax, [rbp-160]
+push rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [v744]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L61:
+push QWORD PTR [rbp-160]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v81:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v828]
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+mov rax, 34
+push rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L62
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+L62:
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L63:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L64
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L65
+push QWORD PTR [v9]
+push QWORD PTR [v703]
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L66
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L67
+L66:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L67:
+L65:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L68
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L69
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L69:
+L68:
+jmp L63
+L64:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L70
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [v9]
+mov rax, 0
+push rax
+push QWORD PTR [v827]
+push QWORD PTR [rbp-32]
+push QWORD PTR [v827]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v827]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L70:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v86:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v195]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L71
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L71:
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L72:
+push QWORD PTR [rbp-80]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L73
+push QWORD PTR [rbp-48]
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L74
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L75
+L74:
+push QWORD PTR [rbp-96]
+mov rax, 92
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L76
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 116
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L77
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v163]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L78
+L77:
+push QWORD PTR [rbp-96]
+mov rax, 98
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L79
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v162]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L80
+L79:
+push QWORD PTR [rbp-96]
+mov rax, 110
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L81
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v164]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L82
+L81:
+push QWORD PTR [rbp-96]
+mov rax, 114
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L83
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v167]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L84
+L83:
+push QWORD PTR [rbp-96]
+mov rax, 102
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L85
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v166]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L86
+L85:
+push QWORD PTR [rbp-96]
+mov rax, 39
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L87
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov rax, 39
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L87:
+L86:
+L84:
+L82:
+L80:
+L78:
+jmp L88
+L76:
+push QWORD PTR [rbp-96]
+mov rax, 37
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L89
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L90
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L91
+L90:
+push QWORD PTR [rbp-96]
+mov rax, 99
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L92
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L93
+L92:
+push QWORD PTR [rbp-96]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L94
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L95
+L94:
+push QWORD PTR [rbp-96]
+mov rax, 105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L96
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L97
+L96:
+push QWORD PTR [rbp-96]
+mov rax, 42
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L98
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L99
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L100
+L99:
+L100:
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L101
+L98:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L101:
+L97:
+L95:
+L93:
+L91:
+jmp L102
+L89:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L102:
+L88:
+L75:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L103
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v38
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L103:
+jmp L72
+L73:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L104
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L104:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 112
+pop rbp
+ret
+v87:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov eax, [v197]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v90:
+push rbp
+mov rbp, rsp
+sub rsp, 1056
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-1048], al
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rax, 1024
+push rax
+lea rax, [rbp-1048]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+mov QWORD PTR [rbp-1056], rax
+push QWORD PTR [rbp-1056]
+lea rax, [rbp-1048]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v50
+add rsp, 1056
+pop rbp
+ret
+v92:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v359]
+pop rdi
+pop rsi
+pop rdx
+call v90
+add rsp, 16
+pop rbp
+ret
+v99:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L105
+lea rax, [rbp-16]
+push rax
+mov rax, OFFSET str3
+push rax
+push QWORD PTR [v360]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, 1
+push rax
+pop rdi
+call v54
+L105:
+add rsp, 16
+pop rbp
+ret
+v102:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 16
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L106:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v921]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L107
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v924
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L108
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L108:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L106
+L107:
+mov rax, OFFSET str4
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v919]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L109:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v922]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L110
+L111:
+mov rax, OFFSET v924
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [v920]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L112
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L111
+L112:
+mov rax, OFFSET v925
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L109
+L110:
+mov rax, OFFSET v929
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v103:
+push rbp
+mov rbp, rsp
+L113:
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+mov rax, OFFSET v930
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L114
+L115:
+mov rax, OFFSET v930
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L116
+call v74
+jmp L115
+L116:
+jmp L113
+L114:
+pop rbp
+ret
+v104:
+push rbp
+mov rbp, rsp
+mov rax, OFFSET v930
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v105:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, OFFSET v925
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 15
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v920]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v106:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+call v103
+push QWORD PTR [v929]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L117
+call v102
+L117:
+push QWORD PTR [rbp-8]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, OFFSET v924
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v926
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L118
+mov rax, OFFSET v926
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L119
+L118:
+mov rax, OFFSET v927
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v928
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L120
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+lea rax, [rbp-48]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-56]
+push QWORD PTR [v923]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v928
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [v923]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L120:
+push QWORD PTR [rbp-48]
+pop rax
+test rax, rax
+jz L121
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v927
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L121:
+L119:
+call v104
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L122
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+call v17
+L122:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v107:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+call v103
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v926
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v926
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+call v104
+add rsp, 24
+pop rbp
+ret
+v108:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L123
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v919]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L124
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v61
+jmp L125
+L124:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v107
+L125:
+L123:
+add rsp, 16
+pop rbp
+ret
+v109:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v919]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L126
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-16]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L127
+L126:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v106
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L127:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L128
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L128:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v110:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v919]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v919]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L129
+push QWORD PTR [v703]
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-40]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L130
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L130:
+jmp L131
+L129:
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v919]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [v919]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L132
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+call v105
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+call v105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L133
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+L133:
+L132:
+L131:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L134
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L135
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L136
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+L136:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-8]
+pop rdi
+call v108
+L135:
+L134:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v112:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L137:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L138
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L137
+L138:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v113:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+mov rax, 4294967295
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 128
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v114:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+mov rax, 129
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v115:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v979]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v116:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L139
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L140
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v112
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L140:
+L141:
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L142
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v113
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v112
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L141
+L142:
+L139:
+add rsp, 16
+pop rbp
+ret
+v118:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L143
+push QWORD PTR [rbp-8]
+push QWORD PTR [v979]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v114
+L143:
+add rsp, 8
+pop rbp
+ret
+v119:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v986]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v120:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v986]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v118
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v113
+L144:
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v112
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L145
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v113
+jmp L144
+L145:
+add rsp, 24
+pop rbp
+ret
+v121:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v114
+add rsp, 16
+pop rbp
+ret
+v122:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [v966]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v114
+add rsp, 16
+pop rbp
+ret
+v123:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8392704
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 131106
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L146
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L147
+L146:
+push QWORD PTR [v690]
+push QWORD PTR [v827]
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+pop rdx
+call v62
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-40]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-80]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v996]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v997]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v996]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v996]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-80]
+push QWORD PTR [v965]
+pop rdi
+pop rsi
+pop rdx
+pop r10
+xor r8d, r8d
+call thread_clone
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L148
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L148:
+L147:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v124:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v996]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+L149:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L150
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v714]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v996]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v996]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L149
+L150:
+mov rax, 8392704
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v997]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v61
+add rsp, 24
+pop rbp
+ret
+v125:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-128], al
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-136], rax
+lea rax, [rbp-128]
+push rax
+mov rax, 128
+push rax
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v75
+push rax
+pop rax
+mov QWORD PTR [rbp-144], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-152], rax
+L151:
+push QWORD PTR [rbp-144]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-152]
+push QWORD PTR [rbp-144]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L152
+lea rax, [rbp-128]
+push rax
+push QWORD PTR [rbp-152]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-160], rax
+L153:
+push QWORD PTR [rbp-160]
+pop rax
+test rax, rax
+jz L154
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [rbp-136]
+push QWORD PTR [rbp-160]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-160]
+push rax
+push QWORD PTR [rbp-160]
+mov rax, 1
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L153
+L154:
+lea rax, [rbp-152]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-152]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L151
+L152:
+push QWORD PTR [rbp-136]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L155
+lea rax, [rbp-136]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L155:
+push QWORD PTR [rbp-136]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v126:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+add rsp, 16
+pop rbp
+ret
+v127:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1025]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 16
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 4095
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v128:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1024]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1023]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [v967]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L156
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1018]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1019]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1024]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L156:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v129:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1024]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1024]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v112
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1023]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L157
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v127
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L158
+push QWORD PTR [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1023]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L159
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L159:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1024]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L158:
+jmp L160
+L157:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1024]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L160:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v130:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1023]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1024]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-40]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L161
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v127
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1023]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L162
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L162:
+L161:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v131:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1051]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+mov rax, 56
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v133:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L163
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v116
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1054]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v121
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v118
+L163:
+add rsp, 16
+pop rbp
+ret
+v134:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v116
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1058]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1056]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1057]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1055]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L164
+mov rax, 2
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, OFFSET str5
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+L165:
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L166
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L165
+L166:
+push QWORD PTR [rbp-56]
+pop rdi
+call v108
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1055]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1056]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1058]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+L164:
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1018]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1019]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1057]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v118
+add rsp, 80
+pop rbp
+ret
+v135:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1057]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L167
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v116
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1057]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L168
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1056]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1055]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1056]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1058]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1057]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L168:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v118
+L167:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v136:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1049]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v129
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L169
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v135
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L169:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L170
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1052]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1047]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+L171:
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L172
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v131
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-64]
+push QWORD PTR [v1049]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v130
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L171
+L172:
+L170:
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L173
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+L173:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v137:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v126
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1018]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1019]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-32]
+pop rax
+pop rdi
+pop rsi
+call rax
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L174
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v116
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1054]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v122
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v118
+L174:
+add rsp, 32
+pop rbp
+ret
+v138:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+L175:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L176
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v136
+push rax
+pop rax
+test rax, rax
+jz L177
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v137
+jmp L178
+L177:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v116
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+L179:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L180
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1054]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v120
+jmp L179
+L180:
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v118
+L178:
+jmp L175
+L176:
+add rsp, 48
+pop rbp
+ret
+v139:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L181
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L181:
+push QWORD PTR [rbp-16]
+mov rax, 56
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 1024
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, OFFSET str6
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1051]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1052]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v115
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1054]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v119
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1055]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1056]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1057]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1058]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v968]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L182:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L183
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v131
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 65536
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, OFFSET str7
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1047]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1049]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1023]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1049]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1024]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1049]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1025]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L182
+L183:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L184:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L185
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v131
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+mov rax, OFFSET v138
+push rax
+push QWORD PTR [rbp-72]
+push QWORD PTR [v1048]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v123
+push rax
+pop rax
+test rax, rax
+jz L186
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1052]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L187
+L186:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L187:
+jmp L184
+L185:
+L188:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L189
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v131
+push rax
+push QWORD PTR [v1049]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1025]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L188
+L189:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v140:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v134
+push QWORD PTR [rbp-8]
+pop rdi
+call v133
+add rsp, 32
+pop rbp
+ret
+v141:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1049]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v128
+push rax
+pop rax
+test rax, rax
+jz L190
+push QWORD PTR [rbp-32]
+pop rdi
+call v133
+jmp L191
+L190:
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1018]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1019]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v137
+L191:
+add rsp, 56
+pop rbp
+ret
+v142:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v131
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L192:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L193
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v136
+push rax
+pop rax
+test rax, rax
+jz L194
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v137
+jmp L195
+L194:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v116
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+L196:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1059]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L197
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1054]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v120
+jmp L196
+L197:
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v118
+L195:
+jmp L192
+L193:
+add rsp, 48
+pop rbp
+ret
+v143:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v142
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v116
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1054]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v122
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1053]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v118
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1052]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L198:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L199
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v131
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L200
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1048]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v124
+L200:
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1049]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1025]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L198
+L199:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1051]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1055]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1051]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1052]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v144:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L201
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-32], rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-48]
+push rax
+mov rax, OFFSET str8
+push rax
+push QWORD PTR [v360]
+pop rdi
+pop rsi
+pop rdx
+call v90
+L201:
+add rsp, 48
+pop rbp
+ret
+v145:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+add rsp, 24
+pop rbp
+ret
+v146:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L202:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1138]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L203
+mov rax, 1
+push rax
+mov rax, OFFSET v1141
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v1143
+push rax
+pop rdi
+call v116
+mov rax, OFFSET v1142
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v1142]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1143
+push rax
+pop rdi
+call v118
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L202
+L203:
+add rsp, 24
+pop rbp
+ret
+v147:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, OFFSET v1143
+push rax
+pop rdi
+call v116
+L204:
+push QWORD PTR [v1145]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L205
+mov rax, OFFSET v1143
+push rax
+mov rax, OFFSET v1144
+push rax
+pop rdi
+pop rsi
+call v120
+jmp L204
+L205:
+mov rax, OFFSET v1145
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1143
+push rax
+pop rdi
+call v118
+add rsp, 8
+pop rbp
+ret
+v148:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+mov rax, 4294967295
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+L206:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [v1140]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L207
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 2
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+mov rax, OFFSET v148
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v141
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L206
+L207:
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L208:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L209
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L208
+L209:
+push QWORD PTR [rbp-48]
+mov rax, OFFSET v1146
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+add rsp, 56
+pop rbp
+ret
+v149:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, OFFSET v1146
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v150:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [v362]
+pop rdi
+pop rsi
+call v57
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 1000
+push rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [v355]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [v356]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1000000
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 24
+pop rbp
+ret
+v151:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+call v150
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+lea rax, [rbp-24]
+push rax
+mov rax, OFFSET str9
+push rax
+pop rdi
+pop rsi
+call v92
+add rsp, 24
+pop rbp
+ret
+v152:
+push rbp
+mov rbp, rsp
+sub rsp, 232
+mov rax, OFFSET str10
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 40
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+mov rax, 40
+push rax
+mov rax, 2
+push rax
+lea rax, [rbp-16]
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 42
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 42
+push rax
+mov rax, 7
+push rax
+mov rax, 41
+push rax
+lea rax, [rbp-16]
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 42
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 42
+push rax
+mov rax, 7
+push rax
+mov rax, 42
+push rax
+lea rax, [rbp-16]
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 7
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 7
+push rax
+mov rax, 9
+push rax
+lea rax, [rbp-16]
+push rax
+pop rdi
+pop rsi
+call v112
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 9
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v144
+mov rax, OFFSET v22
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v23
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+mov rax, 9
+push rax
+mov rax, 1
+push rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rdi
+pop rsi
+call rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+mov rax, 3
+push rax
+mov rax, 10
+push rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+call rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 3
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v144
+mov rax, 1
+push rax
+pop rdi
+call v151
+mov rax, OFFSET v1143
+push rax
+pop rdi
+call v115
+mov rax, OFFSET v1141
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1142
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-104], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+L210:
+push QWORD PTR [rbp-112]
+push QWORD PTR [v1137]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L211
+lea rax, [rbp-104]
+push rax
+push QWORD PTR [rbp-104]
+push QWORD PTR [v9]
+mov rax, OFFSET v146
+push rax
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-112]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v123
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-112]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-112]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L210
+L211:
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-104]
+pop rdi
+pop rsi
+pop rdx
+call v144
+lea rax, [rbp-112]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L212:
+push QWORD PTR [rbp-112]
+push QWORD PTR [v1137]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L213
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-112]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v124
+lea rax, [rbp-112]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-112]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L212
+L213:
+push QWORD PTR [rbp-8]
+mov rax, 8000
+push rax
+push QWORD PTR [v1141]
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 8000
+push rax
+push QWORD PTR [v1142]
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET v1143
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v144
+mov rax, 2
+push rax
+pop rdi
+call v151
+mov rax, OFFSET v1144
+push rax
+pop rdi
+call v119
+mov rax, OFFSET v1145
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [v9]
+mov rax, OFFSET v147
+push rax
+lea rax, [rbp-128]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v123
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v144
+mov rax, OFFSET v1143
+push rax
+pop rdi
+call v116
+mov rax, OFFSET v1145
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1144
+push rax
+pop rdi
+call v121
+mov rax, OFFSET v1143
+push rax
+pop rdi
+call v118
+lea rax, [rbp-128]
+push rax
+pop rdi
+call v124
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+push QWORD PTR [v1145]
+pop rdi
+pop rsi
+pop rdx
+call v144
+mov rax, 3
+push rax
+pop rdi
+call v151
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [v1137]
+lea rax, [rbp-224]
+push rax
+pop rdi
+pop rsi
+call v139
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v144
+mov rax, OFFSET v1146
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [v1139]
+mov rax, OFFSET v148
+push rax
+lea rax, [rbp-224]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v140
+lea rax, [rbp-224]
+push rax
+pop rdi
+call v142
+push QWORD PTR [rbp-8]
+mov rax, 4999950000
+push rax
+push QWORD PTR [v1146]
+pop rdi
+pop rsi
+pop rdx
+call v144
+mov rax, 4
+push rax
+pop rdi
+call v151
+mov rax, OFFSET v1146
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-232], rax
+L214:
+push QWORD PTR [rbp-232]
+mov rax, 1000
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L215
+push QWORD PTR [rbp-232]
+mov rax, OFFSET v149
+push rax
+lea rax, [rbp-224]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v140
+lea rax, [rbp-232]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-232]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L214
+L215:
+mov rax, 5
+push rax
+pop rdi
+call v151
+lea rax, [rbp-224]
+push rax
+pop rdi
+call v143
+mov rax, 6
+push rax
+pop rdi
+call v151
+push QWORD PTR [rbp-8]
+mov rax, 499500
+push rax
+push QWORD PTR [v1146]
+pop rdi
+pop rsi
+pop rdx
+call v144
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+call v125
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v145
+add rsp, 232
+pop rbp
+ret
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+call v152
+push QWORD PTR [v1146]
+push QWORD PTR [v1141]
+pop rax
+mov QWORD PTR [rbp-8], rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+lea rax, [rbp-16]
+push rax
+mov rax, OFFSET str11
+push rax
+pop rdi
+pop rsi
+call v92
+add rsp, 16
+pop rbp
+ret
+.data
+str0: .byte 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 97, 98, 99, 100, 101, 102, 0
+str1: .byte 48, 120, 0
+str2: .byte 48, 98, 0
+str3: .byte 91, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 93, 58, 32, 37, 115, 0
+str4: .byte 109, 101, 109, 111, 114, 121, 95, 105, 110, 105, 116, 58, 32, 115, 105, 122, 101, 32, 99, 108, 97, 115, 115, 101, 115, 32, 100, 111, 32, 110, 111, 116, 32, 101, 110, 100, 32, 97, 116, 32, 77, 69, 77, 79, 82, 89, 95, 83, 77, 65, 76, 76, 95, 77, 65, 88, 10, 0
+str5: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 115, 117, 98, 109, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str6: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 105, 110, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str7: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 105, 110, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str8: .byte 97, 115, 115, 101, 114, 116, 95, 101, 113, 117, 97, 108, 32, 40, 37, 100, 32, 33, 61, 32, 37, 100, 41, 58, 32, 37, 115, 10, 0
+str9: .byte 109, 97, 114, 107, 32, 37, 100, 32, 37, 100, 10, 0
+str10: .byte 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 116, 104, 114, 101, 97, 100, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 116, 104, 114, 101, 97, 100, 40, 41, 0
+str11: .byte 37, 100, 32, 37, 100, 10, 0
+v7: .quad 6977958666136406330
+v8: .quad 0
+v9: .quad 0
+v154: .byte 0
+v155: .byte 1
+v156: .byte 2
+v157: .byte 3
+v158: .byte 4
+v159: .byte 5
+v160: .byte 6
+v161: .byte 7
+v162: .byte 8
+v163: .byte 9
+v164: .byte 10
+v165: .byte 11
+v166: .byte 12
+v167: .byte 13
+v168: .byte 14
+v169: .byte 15
+v170: .byte 16
+v171: .byte 17
+v172: .byte 18
+v173: .byte 19
+v174: .byte 20
+v175: .byte 21
+v176: .byte 22
+v177: .byte 23
+v178: .byte 24
+v179: .byte 25
+v180: .byte 26
+v181: .byte 27
+v182: .byte 28
+v183: .byte 29
+v184: .byte 30
+v185: .byte 31
+v186: .quad 0
+v187: .quad 1
+v188: .quad 18446744073709551614
+v189: .quad 0
+v190: .quad 1
+v191: .quad 1048576
+v195: .quad 18446744073709551615
+v196: .quad 9223372036854775807
+v197: .long 4294967295
+v198: .long 2147483647
+v199: .word 65535
+v200: .word 32767
+v201: .byte 255
+v202: .byte 127
+v203: .quad 18446744073709551615
+v204: .quad 9223372036854775807
+v205: .long 4294967295
+v206: .long 2147483647
+v207: .word 65535
+v208: .word 32767
+v209: .byte 255
+v210: .byte 127
+v211: .quad 18446744073709551615
+v212: .quad 512
+v213: .quad 0
+v214: .quad 8
+v270: .quad 10
+v276: .quad 10
+v283: .quad 20
+v290: .quad 95
+v314: .quad 1
+v335: .quad 1
+v341: .quad 32
+v355: .quad 0
+v356: .quad 8
+v358: .quad 0
+v359: .quad 1
+v360: .quad 2
+v361: .quad 0
+v362: .quad 1
+v363: .quad 2
+v364: .quad 3
+v365: .quad 4
+v366: .quad 5
+v367: .quad 6
+v368: .quad 7
+v369: .quad 8
+v370: .quad 9
+v371: .quad 11
+v372: .quad 0
+v373: .quad 1
+v374: .quad 2
+v375: .quad 3
+v376: .quad 4
+v377: .quad 5
+v378: .quad 6
+v379: .quad 7
+v380: .quad 8
+v381: .quad 9
+v382: .quad 10
+v383: .quad 11
+v384: .quad 12
+v385: .quad 13
+v386: .quad 14
+v387: .quad 15
+v388: .quad 16
+v389: .quad 17
+v390: .quad 18
+v391: .quad 19
+v392: .quad 20
+v393: .quad 21
+v394: .quad 22
+v395: .quad 23
+v396: .quad 24
+v397: .quad 25
+v398: .quad 26
+v399: .quad 27
+v400: .quad 28
+v401: .quad 29
+v402: .quad 30
+v403: .quad 31
+v404: .quad 32
+v405: .quad 33
+v406: .quad 34
+v407: .quad 35
+v408: .quad 36
+v409: .quad 37
+v410: .quad 38
+v411: .quad 39
+v412: .quad 40
+v413: .quad 41
+v414: .quad 42
+v415: .quad 43
+v416: .quad 44
+v417: .quad 45
+v418: .quad 46
+v419: .quad 47
+v420: .quad 48
+v421: .quad 49
+v422: .quad 50
+v423: .quad 51
+v424: .quad 52
+v425: .quad 53
+v426: .quad 54
+v427: .quad 55
+v428: .quad 56
+v429: .quad 57
+v430: .quad 58
+v431: .quad 59
+v432: .quad 60
+v433: .quad 61
+v434: .quad 62
+v435: .quad 63
+v436: .quad 64
+v437: .quad 65
+v438: .quad 66
+v439: .quad 67
+v440: .quad 68
+v441: .quad 69
+v442: .quad 70
+v443: .quad 71
+v444: .quad 72
+v445: .quad 73
+v446: .quad 74
+v447: .quad 75
+v448: .quad 76
+v449: .quad 77
+v450: .quad 78
+v451: .quad 79
+v452: .quad 80
+v453: .quad 81
+v454: .quad 82
+v455: .quad 83
+v456: .quad 84
+v457: .quad 85
+v458: .quad 86
+v459: .quad 87
+v460: .quad 88
+v461: .quad 89
+v462: .quad 90
+v463: .quad 91
+v464: .quad 92
+v465: .quad 93
+v466: .quad 94
+v467: .quad 95
+v468: .quad 96
+v469: .quad 97
+v470: .quad 98
+v471: .quad 99
+v472: .quad 100
+v473: .quad 101
+v474: .quad 102
+v475: .quad 103
+v476: .quad 104
+v477: .quad 105
+v478: .quad 106
+v479: .quad 107
+v480: .quad 108
+v481: .quad 109
+v482: .quad 110
+v483: .quad 111
+v484: .quad 112
+v485: .quad 113
+v486: .quad 114
+v487: .quad 115
+v488: .quad 116
+v489: .quad 117
+v490: .quad 118
+v491: .quad 119
+v492: .quad 120
+v493: .quad 121
+v494: .quad 122
+v495: .quad 123
+v496: .quad 124
+v497: .quad 125
+v498: .quad 126
+v499: .quad 127
+v500: .quad 128
+v501: .quad 129
+v502: .quad 130
+v503: .quad 131
+v504: .quad 132
+v505: .quad 133
+v506: .quad 134
+v507: .quad 135
+v508: .quad 136
+v509: .quad 137
+v510: .quad 138
+v511: .quad 139
+v512: .quad 140
+v513: .quad 141
+v514: .quad 142
+v515: .quad 143
+v516: .quad 144
+v517: .quad 145
+v518: .quad 146
+v519: .quad 147
+v520: .quad 148
+v521: .quad 149
+v522: .quad 150
+v523: .quad 151
+v524: .quad 152
+v525: .quad 153
+v526: .quad 154
+v527: .quad 155
+v528: .quad 156
+v529: .quad 157
+v530: .quad 158
+v531: .quad 159
+v532: .quad 160
+v533: .quad 161
+v534: .quad 162
+v535: .quad 163
+v536: .quad 164
+v537: .quad 165
+v538: .quad 166
+v539: .quad 167
+v540: .quad 168
+v541: .quad 169
+v542: .quad 170
+v543: .quad 171
+v544: .quad 172
+v545: .quad 173
+v546: .quad 174
+v547: .quad 175
+v548: .quad 176
+v549: .quad 177
+v550: .quad 178
+v551: .quad 179
+v552: .quad 180
+v553: .quad 181
+v554: .quad 182
+v555: .quad 183
+v556: .quad 184
+v557: .quad 185
+v558: .quad 186
+v559: .quad 187
+v560: .quad 188
+v561: .quad 189
+v562: .quad 190
+v563: .quad 191
+v564: .quad 192
+v565: .quad 193
+v566: .quad 194
+v567: .quad 195
+v568: .quad 196
+v569: .quad 197
+v570: .quad 198
+v571: .quad 199
+v572: .quad 200
+v573: .quad 201
+v574: .quad 202
+v575: .quad 203
+v576: .quad 204
+v577: .quad 205
+v578: .quad 206
+v579: .quad 207
+v580: .quad 208
+v581: .quad 209
+v582: .quad 210
+v583: .quad 211
+v584: .quad 212
+v585: .quad 213
+v586: .quad 214
+v587: .quad 215
+v588: .quad 216
+v589: .quad 217
+v590: .quad 218
+v591: .quad 219
+v592: .quad 220
+v593: .quad 221
+v594: .quad 222
+v595: .quad 223
+v596: .quad 224
+v597: .quad 225
+v598: .quad 226
+v599: .quad 227
+v600: .quad 228
+v601: .quad 229
+v602: .quad 230
+v603: .quad 231
+v604: .quad 232
+v605: .quad 233
+v606: .quad 234
+v607: .quad 235
+v608: .quad 236
+v609: .quad 237
+v610: .quad 238
+v611: .quad 239
+v612: .quad 240
+v613: .quad 241
+v614: .quad 242
+v615: .quad 243
+v616: .quad 244
+v617: .quad 245
+v618: .quad 246
+v619: .quad 247
+v620: .quad 248
+v621: .quad 249
+v622: .quad 250
+v623: .quad 251
+v624: .quad 252
+v625: .quad 253
+v626: .quad 254
+v627: .quad 255
+v628: .quad 256
+v629: .quad 257
+v630: .quad 258
+v631: .quad 259
+v632: .quad 260
+v633: .quad 261
+v634: .quad 262
+v635: .quad 263
+v636: .quad 264
+v637: .quad 265
+v638: .quad 266
+v639: .quad 267
+v640: .quad 268
+v641: .quad 269
+v642: .quad 270
+v643: .quad 271
+v644: .quad 272
+v645: .quad 273
+v646: .quad 274
+v647: .quad 275
+v648: .quad 276
+v649: .quad 277
+v650: .quad 278
+v651: .quad 279
+v652: .quad 280
+v653: .quad 281
+v654: .quad 282
+v655: .quad 283
+v656: .quad 284
+v657: .quad 285
+v658: .quad 286
+v659: .quad 287
+v660: .quad 288
+v661: .quad 289
+v662: .quad 290
+v663: .quad 291
+v664: .quad 292
+v665: .quad 293
+v666: .quad 294
+v667: .quad 295
+v668: .quad 296
+v669: .quad 297
+v670: .quad 298
+v671: .quad 299
+v672: .quad 300
+v673: .quad 301
+v674: .quad 302
+v675: .quad 303
+v676: .quad 304
+v677: .quad 305
+v678: .quad 306
+v679: .quad 307
+v680: .quad 308
+v681: .quad 309
+v682: .quad 310
+v683: .quad 311
+v684: .quad 312
+v685: .quad 313
+v686: .quad 0
+v687: .quad 1
+v688: .quad 64
+v689: .quad 512
+v690: .quad 0
+v691: .quad 1
+v692: .quad 2
+v693: .quad 4
+v694: .quad 16777216
+v695: .quad 33554432
+v696: .quad 1
+v697: .quad 2
+v698: .quad 16
+v699: .quad 32
+v700: .quad 32
+v701: .quad 16384
+v702: .quad 131072
+v703: .quad 1
+v704: .quad 2
+v705: .quad 4
+v706: .quad 256
+v707: .quad 512
+v708: .quad 1024
+v709: .quad 2048
+v710: .quad 65536
+v711: .quad 262144
+v712: .quad 1048576
+v713: .quad 2097152
+v714: .quad 0
+v715: .quad 1
+v716: .quad 128
+v717: .quad 1
+v718: .quad 2
+v719: .quad 3
+v720: .quad 4
+v721: .quad 5
+v722: .quad 6
+v723: .quad 10
+v724: .quad 2
+v725: .quad 0
+v726: .quad 0
+v727: .quad 2
+v729: .quad 0
+v731: .quad 0
+v732: .quad 2
+v733: .quad 4
+v734: .quad 8
+v736: .quad 0
+v737: .quad 8
+v738: .quad 16
+v739: .quad 24
+v740: .quad 28
+v741: .quad 32
+v742: .quad 36
+v743: .quad 40
+v744: .quad 48
+v745: .quad 56
+v746: .quad 64
+v747: .quad 72
+v748: .quad 88
+v749: .quad 104
+v750: .quad 120
+v826: .quad 1024
+v827: .quad 4096
+v828: .quad 65536
+v919: .quad 2048
+v920: .quad 4
+v921: .quad 24
+v922: .quad 129
+v923: .quad 65536
+v964: .quad 8388608
+v965: .quad 3477248
+v966: .quad 2147483647
+v967: .quad 4096
+v968: .quad 64
+v979: .quad 0
+v986: .quad 0
+v996: .quad 0
+v997: .quad 8
+v1018: .quad 0
+v1019: .quad 8
+v1023: .quad 0
+v1024: .quad 8
+v1025: .quad 16
+v1046: .quad 0
+v1047: .quad 8
+v1048: .quad 16
+v1049: .quad 32
+v1051: .quad 0
+v1052: .quad 8
+v1053: .quad 16
+v1054: .quad 24
+v1055: .quad 32
+v1056: .quad 40
+v1057: .quad 48
+v1058: .quad 56
+v1059: .quad 64
+v1060: .quad 72
+v1061: .quad 80
+v1062: .quad 88
+v1137: .quad 4
+v1138: .quad 2000
+v1139: .quad 100000
+v1140: .quad 256
+.bss
+v192: .zero 1048576
+v193: .zero 8
+v194: .zero 8
+v215: .zero 16
+v357: .zero 16
+v728: .zero 16
+v730: .zero 4
+v735: .zero 16
+v751: .zero 144
+v924: .zero 192
+v925: .zero 129
+v926: .zero 192
+v927: .zero 192
+v928: .zero 192
+v929: .zero 8
+v930: .zero 8
+v980: .zero 8
+v987: .zero 8
+v998: .zero 16
+v1020: .zero 16
+v1026: .zero 24
+v1050: .zero 56
+v1063: .zero 96
+v1141: .zero 8
+v1142: .zero 8
+v1143: .zero 8
+v1144: .zero 8
+v1145: .zero 8
+v1146: .zero 8
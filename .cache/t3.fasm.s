@@ -0,0 +1,20841 @@
+.intel_syntax noprefix
+.text
+.globl _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE PTR [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE PTR [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+strlen_sse2:
+mov rax, rdi
+and rax, -16
+mov rcx, rdi
+and ecx, 15
+pxor xmm0, xmm0
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+shr edx, cl
+test edx, edx
+jnz .head
+.loop:
+add rax, 16
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+test edx, edx
+jz .loop
+bsf edx, edx
+add rax, rdx
+sub rax, rdi
+ret
+.head:
+bsf eax, edx
+ret
+thread_clone:
+mov eax, 56
+syscall
+test rax, rax
+jz .child
+ret
+.child:
+xor ebp, ebp
+pop rax
+pop rdi
+call rax
+mov eax, 60
+xor edi, edi
+syscall
+_start:
+mov rdi, [rsp]
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax
+call main
+mov rax, 231
+mov rdi, 0
+syscall
+ret
+v12:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L0
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L1
+L0:
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L1:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v13:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L2:
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L3
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L2
+L3:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v14:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L4:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L5
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L4
+L5:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v15:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L6:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L7
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L8
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L9
+L8:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L10
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L10:
+L9:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L6
+L7:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v16:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L11:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L12
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L13
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L14
+L13:
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L15
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L15:
+L14:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L11
+L12:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v17:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L16:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L17
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L16
+L17:
+add rsp, 32
+pop rbp
+ret
+v18:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-16]
+mov rax, 255
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 72340172838076673
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v17
+push QWORD PTR [rbp-40]
+pop rax
+mov QWORD PTR [rbp-48], rax
+L18:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L19
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L18
+L19:
+add rsp, 48
+pop rbp
+ret
+v19:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L20:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L21
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L20
+L21:
+L22:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L23
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L22
+L23:
+add rsp, 40
+pop rbp
+ret
+v20:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+add rsp, 24
+pop rbp
+ret
+v21:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L24:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L25
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L26
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L26:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L24
+L25:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v22:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v23:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v24:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L27:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L28
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L29
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L29:
+jmp L27
+L28:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v25:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L30
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v356]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+mul rbx
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L30:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L31:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L32
+push QWORD PTR [rbp-8]
+push QWORD PTR [v356]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-56]
+mov rax, OFFSET str0
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v356]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L31
+L32:
+add rsp, 56
+pop rbp
+ret
+v27:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 47
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 58
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v28:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 48
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 49
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v29:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v27
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 96
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 103
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 71
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v32:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+mov rax, 91
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L33
+lea rax, [rbp-8]
+push rax
+mov rax, 32
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L33:
+push QWORD PTR [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v33:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 10
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L34
+mov rax, 2
+push rax
+mov rax, OFFSET str1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L35
+lea rax, [rbp-32]
+push rax
+mov rax, 16
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L36:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-56]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L37
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+pop rdi
+call v27
+push rax
+pop rax
+test rax, rax
+jz L38
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L39
+L38:
+push QWORD PTR [rbp-72]
+pop rdi
+call v29
+push rax
+pop rax
+test rax, rax
+jz L40
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 10
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 97
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L41
+L40:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v370]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L42
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v275]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L42:
+L41:
+L39:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L36
+L37:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L43
+L35:
+mov rax, 2
+push rax
+mov rax, OFFSET str2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L44
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L45:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-64]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L46
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+pop rdi
+call v28
+push rax
+pop rax
+test rax, rax
+jz L47
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L48
+L47:
+push QWORD PTR [rbp-80]
+push QWORD PTR [v370]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L49
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v275]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L49:
+L48:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L45
+L46:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L44:
+L43:
+L34:
+push QWORD PTR [rbp-48]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L50
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L51:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L52
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v370]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L53
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-88]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L53:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L51
+L52:
+L50:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v34:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v33
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v36:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v38:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD PTR [v394]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v39:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L54
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L55
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v36
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L56
+L55:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L57
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L58
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L59
+L58:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L59:
+L57:
+L56:
+L54:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v40:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L60
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L60:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v41:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L61
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L62
+L61:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L63
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L64
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L65
+L64:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L65:
+L63:
+L62:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v42:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L66
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v415]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L67
+L66:
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L68
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v415]
+pop rbx
+pop rax
+mov [rax], rbx
+L68:
+L67:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v44:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L69
+push QWORD PTR [v273]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v274]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L70
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L71
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v273]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+mov rax, OFFSET v273
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v273]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L71:
+jmp L72
+L70:
+L72:
+L69:
+add rsp, 16
+pop rbp
+ret
+v49:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v452]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v50:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v453]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+add rsp, 32
+pop rbp
+ret
+v51:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v454]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v52:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v457]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v54:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v683]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v57:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v680]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v59:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+mov [rbp-48], r9
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v461]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 48
+pop rbp
+ret
+v60:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v477]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+syscall
+push rax
+pop rax
+add rsp, 40
+pop rbp
+ret
+v61:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v463]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v62:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v462]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v63:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v511]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v64:
+push rbp
+mov rbp, rsp
+push QWORD PTR [v509]
+pop rax
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v65:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v513]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v67:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 127
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v70:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v535]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v74:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push QWORD PTR [v476]
+pop rax
+syscall
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+add rsp, 8
+pop rbp
+ret
+v75:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v656]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v76:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v654]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v77:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop r10
+xor r8d, r8d
+call thread_clone
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v78:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [v908]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L73:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L74
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v908]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L73
+L74:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v80:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-160], rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v52
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L75
+lea rax, [rbp-160]
+push rax
+lea rax, [rbp-152]
+push rax
+push QWORD PTR [v824]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L75:
+push QWORD PTR [rbp-160]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v81:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v908]
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+mov rax, 34
+push rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L76
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+L76:
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L77:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L78
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L79
+push QWORD PTR [v9]
+push QWORD PTR [v783]
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L80
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L81
+L80:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L81:
+L79:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L82
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L83
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L83:
+L82:
+jmp L77
+L78:
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L84
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [v9]
+mov rax, 0
+push rax
+push QWORD PTR [v907]
+push QWORD PTR [rbp-32]
+push QWORD PTR [v907]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v907]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L84:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v86:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v275]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L85
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L85:
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L86:
+push QWORD PTR [rbp-80]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L87
+push QWORD PTR [rbp-48]
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L88
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L89
+L88:
+push QWORD PTR [rbp-96]
+mov rax, 92
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L90
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 116
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L91
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v241]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L92
+L91:
+push QWORD PTR [rbp-96]
+mov rax, 98
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L93
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v240]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L94
+L93:
+push QWORD PTR [rbp-96]
+mov rax, 110
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L95
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v242]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L96
+L95:
+push QWORD PTR [rbp-96]
+mov rax, 114
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L97
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v245]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L98
+L97:
+push QWORD PTR [rbp-96]
+mov rax, 102
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L99
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov al, [v244]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L100
+L99:
+push QWORD PTR [rbp-96]
+mov rax, 39
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L101
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+mov rax, 39
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L101:
+L100:
+L98:
+L96:
+L94:
+L92:
+jmp L102
+L90:
+push QWORD PTR [rbp-96]
+mov rax, 37
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L103
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L104
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L105
+L104:
+push QWORD PTR [rbp-96]
+mov rax, 99
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L106
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L107
+L106:
+push QWORD PTR [rbp-96]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L108
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L109
+L108:
+push QWORD PTR [rbp-96]
+mov rax, 105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L110
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L111
+L110:
+push QWORD PTR [rbp-96]
+mov rax, 42
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L112
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L113
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L114
+L113:
+L114:
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L115
+L112:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L115:
+L111:
+L109:
+L107:
+L105:
+jmp L116
+L103:
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L116:
+L102:
+L89:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L117
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v38
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L117:
+jmp L86
+L87:
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L118
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L118:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 112
+pop rbp
+ret
+v87:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov eax, [v277]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v90:
+push rbp
+mov rbp, rsp
+sub rsp, 1056
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-1048], al
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rax, 1024
+push rax
+lea rax, [rbp-1048]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+mov QWORD PTR [rbp-1056], rax
+push QWORD PTR [rbp-1056]
+lea rax, [rbp-1048]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v50
+add rsp, 1056
+pop rbp
+ret
+v92:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v439]
+pop rdi
+pop rsi
+pop rdx
+call v90
+add rsp, 16
+pop rbp
+ret
+v99:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L119
+lea rax, [rbp-16]
+push rax
+mov rax, OFFSET str3
+push rax
+push QWORD PTR [v440]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, 1
+push rax
+pop rdi
+call v54
+L119:
+add rsp, 16
+pop rbp
+ret
+v102:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 16
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L120:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1001]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L121
+lea rax, [rbp-8]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1004
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L122
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L122:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L120
+L121:
+mov rax, OFFSET str4
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v999]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L123:
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1002]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L124
+L125:
+mov rax, OFFSET v1004
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1000]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L126
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L125
+L126:
+mov rax, OFFSET v1005
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L123
+L124:
+mov rax, OFFSET v1009
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v103:
+push rbp
+mov rbp, rsp
+L127:
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+mov rax, OFFSET v1010
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L128
+L129:
+mov rax, OFFSET v1010
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L130
+call v74
+jmp L129
+L130:
+jmp L127
+L128:
+pop rbp
+ret
+v104:
+push rbp
+mov rbp, rsp
+mov rax, OFFSET v1010
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v105:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, OFFSET v1005
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 15
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1000]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v106:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+call v103
+push QWORD PTR [v1009]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L131
+call v102
+L131:
+push QWORD PTR [rbp-8]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, OFFSET v1004
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v1006
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L132
+mov rax, OFFSET v1006
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L133
+L132:
+mov rax, OFFSET v1007
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v1008
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L134
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+lea rax, [rbp-48]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1003]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1008
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1003]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L134:
+push QWORD PTR [rbp-48]
+pop rax
+test rax, rax
+jz L135
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1007
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L135:
+L133:
+call v104
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L136
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+call v17
+L136:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v107:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+call v103
+push QWORD PTR [rbp-8]
+mov rax, OFFSET v1006
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1006
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+call v104
+add rsp, 24
+pop rbp
+ret
+v108:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L137
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v999]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L138
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v61
+jmp L139
+L138:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v107
+L139:
+L137:
+add rsp, 16
+pop rbp
+ret
+v109:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v999]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L140
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-16]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L141
+L140:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+call v106
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L141:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L142
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L142:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v110:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v999]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v999]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L143
+push QWORD PTR [v783]
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v9]
+push QWORD PTR [rbp-40]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L144
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L144:
+jmp L145
+L143:
+mov rax, 8
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v999]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [v999]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L146
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+call v105
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+call v105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L147
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+L147:
+L146:
+L145:
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L148
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L149
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L150
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+L150:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-8]
+pop rdi
+call v108
+L149:
+L148:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v111:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L151
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L152
+L151:
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v110
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L152:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v112:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1047]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 16
+pop rbp
+ret
+v113:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v114:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L153
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L154
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v1044]
+pop rbx
+pop rax
+mov [rax], rbx
+L154:
+L155:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L156
+lea rax, [rbp-24]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L155
+L156:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1047]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, OFFSET str5
+push rax
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+L153:
+add rsp, 32
+pop rbp
+ret
+v115:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1047]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v116:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v117:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 8
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v112
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1063]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 16
+pop rbp
+ret
+v118:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L157:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L158
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v115
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L157
+L158:
+push QWORD PTR [rbp-16]
+pop rdi
+call v113
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v119:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+L159:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1059]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L160
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v114
+push QWORD PTR [v1060]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1063]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, OFFSET str6
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v115
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L159
+L160:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 40
+pop rbp
+ret
+v120:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+mov rax, 8
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1059]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rax, 255
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1063]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 32
+pop rbp
+ret
+v121:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v1059]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v122:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1091]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 16
+pop rbp
+ret
+v123:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L161
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [v1080]
+pop rbx
+pop rax
+mov [rax], rbx
+L161:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L162
+push QWORD PTR [rbp-24]
+mov rax, 2
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L163
+lea rax, [rbp-24]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L163:
+L162:
+L164:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L165
+lea rax, [rbp-24]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L164
+L165:
+mov rax, 24
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, OFFSET str7
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-40]
+push QWORD PTR [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-40]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1091]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1091]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 40
+pop rbp
+ret
+v124:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1091]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1091]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+pop rdi
+call v108
+add rsp, 16
+pop rbp
+ret
+v125:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 24
+pop rbp
+ret
+v126:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, OFFSET str8
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L166
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v125
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rbx
+pop rax
+mov [rax], rbx
+L166:
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L167
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v123
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L167:
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v125
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L168
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L168:
+push QWORD PTR [rbp-32]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 80
+pop rbp
+ret
+v127:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v1081]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v128:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L169
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L169:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1095]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v129:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+L170:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L171
+push QWORD PTR [rbp-8]
+pop rdi
+call v124
+jmp L170
+L171:
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L172
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L172:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1095]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v130:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L173
+L174:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L175
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+pop rdi
+call v124
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L174
+L175:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L173:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 16
+pop rbp
+ret
+v131:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+L176:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L177
+push QWORD PTR [rbp-8]
+pop rdi
+call v124
+jmp L176
+L177:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v132:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v133:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v132
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v134:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 1
+push rax
+mov rax, 1026
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v906]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [v906]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1084]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v136:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 5381
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+pop rax
+test rax, rax
+jz L178
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L179:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L180
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-24]
+mov rax, 5
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L179
+L180:
+L178:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v139:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v140:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1162]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+mov rax, 31
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 33
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v141:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+call v140
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v1164]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v142:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rax
+mov QWORD PTR [rbp-16], rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 33
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v1162]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 29
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD PTR [v1163]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-16]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v143:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+mov rax, 32
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L181
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v1165]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L182
+L181:
+mov rax, 6983438078262162902
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [v1162]
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 7046029288634856825
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L183:
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L184
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L183
+L184:
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v139
+push rax
+mov rax, 7
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v139
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 12
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+call v139
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 18
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v139
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-32]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L182:
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L185:
+push QWORD PTR [rbp-24]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L186
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+call v140
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 27
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 37
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v1164]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L185
+L186:
+push QWORD PTR [rbp-24]
+mov rax, 4
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L187
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+push QWORD PTR [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 23
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 41
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v1162]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD PTR [v1163]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 4
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L187:
+L188:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L189
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [v1165]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 11
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 53
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD PTR [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L188
+L189:
+push QWORD PTR [rbp-32]
+pop rdi
+call v142
+push rax
+pop rax
+add rsp, 72
+pop rbp
+ret
+v144:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v143
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v145:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v142
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v146:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1194]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 24
+push rax
+mov rax, 8
+push rax
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v12
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1197]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v143
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v147:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1194]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v148:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v267]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L190
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L191:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L192
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L193
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1188]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+L193:
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L191
+L192:
+L190:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v149:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v150:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 32
+pop rbp
+ret
+v151:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v266]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L194
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v145
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L195
+L194:
+mov rax, OFFSET v143
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1197]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rax
+pop rdi
+pop rsi
+call rax
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L195:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L196
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L196:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v152:
+push rbp
+mov rbp, rsp
+sub rsp, 104
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [v291]
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+pop rax
+test rax, rax
+jz L197
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v267]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+L198:
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L199
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-104], rax
+push QWORD PTR [rbp-104]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-96]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v150
+push rax
+push QWORD PTR [rbp-80]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L200
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L201
+L200:
+push QWORD PTR [rbp-104]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L202
+push QWORD PTR [rbp-56]
+pop rax
+test rax, rax
+jz L203
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-96]
+push QWORD PTR [v1189]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L204
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-96]
+push QWORD PTR [v1188]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v21
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L205
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L205:
+L204:
+jmp L206
+L203:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-96]
+push QWORD PTR [v1188]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L207
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L207:
+L206:
+L202:
+L201:
+lea rax, [rbp-72]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L198
+L199:
+L197:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 104
+pop rbp
+ret
+v153:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1194]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+L208:
+push QWORD PTR [rbp-72]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L209
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L210
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L211
+L210:
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v150
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L212
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L213
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L213:
+lea rax, [rbp-64]
+push rax
+push QWORD PTR [rbp-88]
+pop rbx
+pop rax
+mov [rax], rbx
+L212:
+L211:
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L214
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L214:
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-56]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+push QWORD PTR [rbp-64]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L208
+L209:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v154:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L215
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [v1186]
+pop rbx
+pop rax
+mov [rax], rbx
+L215:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1194]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, OFFSET str9
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+L216:
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L217
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L218
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v153
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+L218:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L216
+L217:
+push QWORD PTR [rbp-16]
+pop rdi
+call v108
+add rsp, 80
+pop rbp
+ret
+v155:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v151
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v152
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v291]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L219
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L220
+L219:
+mov rax, 4
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 3
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L221
+push QWORD PTR [rbp-8]
+pop rdi
+call v154
+L221:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1194]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rax
+pop rcx
+rep stosb
+push QWORD PTR [rbp-64]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-64]
+push QWORD PTR [v1188]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v267]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L222
+push QWORD PTR [rbp-24]
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+mov rax, OFFSET str10
+push rax
+push QWORD PTR [rbp-72]
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-72]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-64]
+push QWORD PTR [v1188]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-64]
+push QWORD PTR [v1189]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+L222:
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v153
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L220:
+push QWORD PTR [rbp-56]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L223
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+L223:
+push QWORD PTR [rbp-80]
+pop rax
+add rsp, 80
+pop rbp
+ret
+v156:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v151
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v152
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [v291]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L224
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L224:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v157:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v151
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v152
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [v291]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+pop rax
+test rax, rax
+jz L225
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [v267]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L226
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1188]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+L226:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1194]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+L227:
+push QWORD PTR [rbp-72]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L228
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-88]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v150
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L229
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L230
+L229:
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-88]
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L230:
+jmp L227
+L228:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L225:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v158:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v155
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v159:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v156
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v160:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v157
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v161:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v155
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v162:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v156
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v163:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v157
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v164:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+L231:
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L232
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L233
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L233:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L231
+L232:
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v165:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+L234:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L235
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L234
+L235:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v166:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+mov rax, 4294967295
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 128
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v167:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+mov rax, 129
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v168:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1315]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v169:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L236
+push QWORD PTR [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L237
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v165
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L237:
+L238:
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L239
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v166
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v165
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L238
+L239:
+L236:
+add rsp, 16
+pop rbp
+ret
+v171:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L240
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1315]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v167
+L240:
+add rsp, 8
+pop rbp
+ret
+v172:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1322]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v173:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1322]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+pop rdi
+call v171
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v166
+L241:
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v165
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L242
+mov rax, 2
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v166
+jmp L241
+L242:
+add rsp, 24
+pop rbp
+ret
+v174:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v167
+add rsp, 16
+pop rbp
+ret
+v175:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [v1302]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v167
+add rsp, 16
+pop rbp
+ret
+v176:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 8392704
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 131106
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L243
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L244
+L243:
+push QWORD PTR [v770]
+push QWORD PTR [v907]
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+pop rdx
+call v62
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-40]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-80]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1332]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1333]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1332]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1332]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1301]
+pop rdi
+pop rsi
+pop rdx
+pop r10
+xor r8d, r8d
+call thread_clone
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+push QWORD PTR [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L245
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L245:
+L244:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v177:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1332]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+L246:
+push QWORD PTR [rbp-16]
+pop rax
+test rax, rax
+jz L247
+push QWORD PTR [v9]
+push QWORD PTR [rbp-16]
+push QWORD PTR [v794]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1332]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1332]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L246
+L247:
+mov rax, 8392704
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1333]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v61
+add rsp, 24
+pop rbp
+ret
+v178:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-128], al
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-136], rax
+lea rax, [rbp-128]
+push rax
+mov rax, 128
+push rax
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v75
+push rax
+pop rax
+mov QWORD PTR [rbp-144], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-152], rax
+L248:
+push QWORD PTR [rbp-144]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD PTR [rbp-152]
+push QWORD PTR [rbp-144]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L249
+lea rax, [rbp-128]
+push rax
+push QWORD PTR [rbp-152]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-160], rax
+L250:
+push QWORD PTR [rbp-160]
+pop rax
+test rax, rax
+jz L251
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [rbp-136]
+push QWORD PTR [rbp-160]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-160]
+push rax
+push QWORD PTR [rbp-160]
+mov rax, 1
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L250
+L251:
+lea rax, [rbp-152]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-152]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L248
+L249:
+push QWORD PTR [rbp-136]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L252
+lea rax, [rbp-136]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L252:
+push QWORD PTR [rbp-136]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v179:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+add rsp, 16
+pop rbp
+ret
+v180:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1361]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 16
+push rax
+push QWORD PTR [rbp-16]
+mov rax, 4095
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v181:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [v1303]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L253
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v180
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1354]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [v1355]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L253:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v182:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v165
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L254
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v180
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L255
+push QWORD PTR [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L256
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L256:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L255:
+jmp L257
+L254:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L257:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v183:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-40]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L258
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v180
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L259
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L259:
+L258:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v184:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-16]
+mov rax, 56
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v186:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L260
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v174
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L260:
+add rsp, 16
+pop rbp
+ret
+v187:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L261
+mov rax, 2
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, OFFSET str11
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+L262:
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L263
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L262
+L263:
+push QWORD PTR [rbp-56]
+pop rdi
+call v108
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+L261:
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1354]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-80]
+push QWORD PTR [v1355]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+add rsp, 80
+pop rbp
+ret
+v188:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L264
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L265
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L265:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L264:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v189:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1382]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1385]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v182
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L266
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v188
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L266:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L267
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1383]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+L268:
+push QWORD PTR [rbp-56]
+push QWORD PTR [rbp-40]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L269
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-64]
+push QWORD PTR [v1385]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v183
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L268
+L269:
+L267:
+push QWORD PTR [rbp-32]
+pop rax
+test rax, rax
+jz L270
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-72], rax
+L270:
+push QWORD PTR [rbp-32]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v190:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1382]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v179
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1354]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1355]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-32]
+pop rax
+pop rdi
+pop rsi
+call rax
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L271
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v175
+push QWORD PTR [rbp-24]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L271:
+add rsp, 32
+pop rbp
+ret
+v191:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1382]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+L272:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1398]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L273
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v189
+push rax
+pop rax
+test rax, rax
+jz L274
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v190
+jmp L275
+L274:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+L276:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1398]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L277
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v173
+jmp L276
+L277:
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L275:
+jmp L272
+L273:
+add rsp, 48
+pop rbp
+ret
+v192:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L278
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L278:
+push QWORD PTR [rbp-16]
+mov rax, 56
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 1024
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, OFFSET str12
+push rax
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v168
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v172
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1304]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1398]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L279:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L280
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+mov rax, 65536
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, OFFSET str13
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v99
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1382]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1383]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1385]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1385]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-56]
+push QWORD PTR [v1385]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1361]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L279
+L280:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L281:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD PTR [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L282
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-72]
+mov rax, OFFSET v191
+push rax
+push QWORD PTR [rbp-72]
+push QWORD PTR [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v176
+push rax
+pop rax
+test rax, rax
+jz L283
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L284
+L283:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L284:
+jmp L281
+L282:
+L285:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L286
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+push QWORD PTR [v1385]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1361]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L285
+L286:
+push QWORD PTR [rbp-24]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v193:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v187
+push QWORD PTR [rbp-8]
+pop rdi
+call v186
+add rsp, 32
+pop rbp
+ret
+v194:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1382]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1385]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v181
+push rax
+pop rax
+test rax, rax
+jz L287
+push QWORD PTR [rbp-32]
+pop rdi
+call v186
+jmp L288
+L287:
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1354]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1355]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v190
+L288:
+add rsp, 56
+pop rbp
+ret
+v195:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L289:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L290
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v189
+push rax
+pop rax
+test rax, rax
+jz L291
+lea rax, [rbp-32]
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+pop rsi
+call v190
+jmp L292
+L291:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+mov rax, 1
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+L293:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L294
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v173
+jmp L293
+L294:
+mov rax, 18446744073709551615
+push rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L292:
+jmp L289
+L290:
+add rsp, 48
+pop rbp
+ret
+v196:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+pop rdi
+call v195
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1398]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v175
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L295:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L296
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-24]
+pop rax
+test rax, rax
+jz L297
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v177
+L297:
+push QWORD PTR [rbp-32]
+push QWORD PTR [v1385]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v1361]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L295
+L296:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v197:
+push rbp
+mov rbp, rsp
+mov rax, OFFSET v1466
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1467
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1468
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v198:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, OFFSET v1466
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v1466]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L298
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-32], rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-48]
+push rax
+mov rax, OFFSET str14
+push rax
+push QWORD PTR [v440]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, OFFSET v1468
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v1468]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L299
+L298:
+mov rax, OFFSET v1467
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v1467]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L299:
+add rsp, 48
+pop rbp
+ret
+v199:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, OFFSET v1466
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v1466]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L300
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+mov QWORD PTR [rbp-32], rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-48]
+push rax
+mov rax, OFFSET str15
+push rax
+push QWORD PTR [v440]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, OFFSET v1468
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v1468]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L301
+L300:
+mov rax, OFFSET v1467
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v1467]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L301:
+add rsp, 48
+pop rbp
+ret
+v200:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, OFFSET str16
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [rbp-8]
+mov rax, 5
+push rax
+mov rax, 5
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+mov rax, 2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 6
+push rax
+mov rax, 6
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4
+push rax
+mov rax, 4
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 1
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 8
+pop rbp
+ret
+v201:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov rax, OFFSET str17
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov DWORD PTR [rbp-24], eax
+push QWORD PTR [v9]
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4
+push rax
+mov rax, 4
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4
+push rax
+mov rax, 4
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 16
+push rax
+mov rax, 16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 16
+push rax
+mov rax, 16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 16
+push rax
+mov rax, 16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 48
+pop rbp
+ret
+v202:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [v275]
+push QWORD PTR [rbp-16]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+not rax
+push rax
+push QWORD PTR [rbp-16]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v203:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, OFFSET str18
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+mov rax, 2
+push rax
+pop rdi
+call v202
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 12
+push rax
+mov rax, 4
+push rax
+pop rdi
+call v202
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 240
+push rax
+mov rax, 8
+push rax
+pop rdi
+call v202
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 131072
+push rax
+mov rax, 131072
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 1
+push rax
+pop rax
+not rax
+push rax
+pop rax
+not rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 3
+push rax
+mov rax, 18446744073709551612
+push rax
+pop rax
+not rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 5
+push rax
+mov rax, 5
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 3
+push rax
+mov rax, 3
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 8
+pop rbp
+ret
+v204:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+mov rax, 7
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v205:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v206:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v207:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+mov rax, 3
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L302
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L303
+L302:
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+call v207
+push rax
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+call v207
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L303:
+push QWORD PTR [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v208:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, OFFSET str19
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+mov rax, 3
+push rax
+pop rdi
+call v204
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 9
+push rax
+mov rax, 3
+push rax
+pop rdi
+call v205
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 6
+push rax
+mov rax, 3
+push rax
+pop rdi
+call v206
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 43
+push rax
+mov rax, 3
+push rax
+pop rdi
+call v206
+push rax
+pop rdi
+call v205
+push rax
+pop rdi
+call v204
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 233
+push rax
+mov rax, 12
+push rax
+pop rdi
+call v207
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 8
+pop rbp
+ret
+v209:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov rax, OFFSET str20
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [rbp-8]
+mov rax, 20
+push rax
+mov rax, 20
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [v1499]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [v1500]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [v1496]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [v1497]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 20
+push rax
+mov rax, 20
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 20
+push rax
+mov rax, 20
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 20
+push rax
+mov rax, 20
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 40
+push rax
+mov rax, 40
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 40
+push rax
+mov rax, 40
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 12
+push rax
+mov rax, 12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 12
+push rax
+mov rax, 12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 12
+push rax
+mov rax, 12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 24
+push rax
+mov rax, 24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 24
+push rax
+mov rax, 24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 112
+pop rbp
+ret
+v210:
+push rbp
+mov rbp, rsp
+sub rsp, 936
+mov rax, OFFSET str21
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-264], rax
+push QWORD PTR [rbp-8]
+mov rax, 256
+push rax
+mov rax, 256
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov DWORD PTR [rbp-392], eax
+push QWORD PTR [rbp-8]
+mov rax, 128
+push rax
+mov rax, 128
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov WORD PTR [rbp-456], ax
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rax, 64
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-488], al
+push QWORD PTR [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 384
+push rax
+mov rax, 384
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-904], rax
+push QWORD PTR [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1
+push rax
+mov rax, 2
+push rax
+mov rax, 3
+push rax
+mov rax, 4
+push rax
+pop rax
+mov QWORD PTR [rbp-912], rax
+pop rax
+mov QWORD PTR [rbp-920], rax
+pop rax
+mov QWORD PTR [rbp-928], rax
+pop rax
+mov QWORD PTR [rbp-936], rax
+push QWORD PTR [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 936
+pop rbp
+ret
+v211:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, OFFSET str22
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [v1523]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4
+push rax
+push QWORD PTR [v1524]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+push QWORD PTR [v1525]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4
+push rax
+push QWORD PTR [v1526]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4
+push rax
+push QWORD PTR [v1527]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4
+push rax
+push QWORD PTR [v1528]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 128
+push rax
+push QWORD PTR [v1529]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+push QWORD PTR [v1530]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [v1531]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+push QWORD PTR [v1532]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+push QWORD PTR [v1533]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [v1534]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+push QWORD PTR [v1535]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [v1536]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 18446744073709551614
+push rax
+push QWORD PTR [v1537]
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 8
+pop rbp
+ret
+v212:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [v1538]
+push QWORD PTR [rbp-8]
+pop rdi
+pop rax
+mov rcx, 256
+rep stosb
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+L304:
+push QWORD PTR [rbp-24]
+mov rax, 256
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L305
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L304
+L305:
+add rsp, 24
+pop rbp
+ret
+v213:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [v1538]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [v1538]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v21
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L306
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L306:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v214:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [v1538]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [v1538]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L307:
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L308
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L309
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L309:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L307
+L308:
+push QWORD PTR [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v215:
+push rbp
+mov rbp, rsp
+sub rsp, 592
+mov rax, OFFSET str23
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-264], al
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-520], al
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 1
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+mov eax, [rsi+0]
+mov [rdi+0], eax
+mov ax, [rsi+4]
+mov [rdi+4], ax
+mov al, [rsi+6]
+mov [rdi+6], al
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 7
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+mov rax, [rsi+0]
+mov [rdi+0], rax
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 8
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+mov rax, [rsi+16]
+mov [rdi+16], rax
+mov eax, [rsi+24]
+mov [rdi+24], eax
+mov ax, [rsi+28]
+mov [rdi+28], ax
+mov al, [rsi+30]
+mov [rdi+30], al
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 31
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+movdqu xmm0, [rsi+16]
+movdqu [rdi+16], xmm0
+movdqu xmm0, [rsi+32]
+movdqu [rdi+32], xmm0
+movdqu xmm0, [rsi+48]
+movdqu [rdi+48], xmm0
+movdqu xmm0, [rsi+64]
+movdqu [rdi+64], xmm0
+movdqu xmm0, [rsi+80]
+movdqu [rdi+80], xmm0
+mov eax, [rsi+96]
+mov [rdi+96], eax
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+push QWORD PTR [v1539]
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+mov rcx, 200
+rep movsb
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 200
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 45
+push rax
+pop rax
+mov QWORD PTR [rbp-528], rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+push QWORD PTR [rbp-528]
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+push QWORD PTR [rbp-528]
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 321
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+mov [rdi+0], al
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 65
+push rax
+mov rax, 1
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 120
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+movzx eax, al
+mov rdx, 72340172838076673
+imul rax, rdx
+movq xmm0, rax
+punpcklqdq xmm0, xmm0
+movdqu [rdi+0], xmm0
+mov [rdi+16], eax
+mov [rdi+20], ax
+mov [rdi+22], al
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 120
+push rax
+mov rax, 23
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 0
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+movzx eax, al
+mov rdx, 72340172838076673
+imul rax, rdx
+movq xmm0, rax
+punpcklqdq xmm0, xmm0
+movdqu [rdi+0], xmm0
+movdqu [rdi+16], xmm0
+movdqu [rdi+32], xmm0
+movdqu [rdi+48], xmm0
+movdqu [rdi+64], xmm0
+movdqu [rdi+80], xmm0
+mov [rdi+96], eax
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [v1539]
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 121
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+mov rcx, 180
+rep stosb
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 121
+push rax
+mov rax, 180
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 77
+push rax
+pop rax
+mov QWORD PTR [rbp-536], rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+push QWORD PTR [rbp-536]
+mov rax, 122
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+pop rcx
+rep stosb
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 122
+push rax
+push QWORD PTR [rbp-536]
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, OFFSET v19
+push rax
+pop rax
+mov QWORD PTR [rbp-544], rax
+mov rax, OFFSET v18
+push rax
+pop rax
+mov QWORD PTR [rbp-552], rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 37
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-544]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+call rax
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 37
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 29
+push rax
+mov rax, 119
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-552]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+call rax
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 119
+push rax
+mov rax, 29
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 97
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rax
+mov rcx, 256
+rep stosb
+lea rax, [rbp-520]
+push rax
+mov rax, 40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-560], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-568], rax
+L310:
+push QWORD PTR [rbp-560]
+mov rax, 40
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L311
+lea rax, [rbp-520]
+push rax
+push QWORD PTR [rbp-560]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call strlen_sse2
+push rax
+mov rax, 40
+push rax
+push QWORD PTR [rbp-560]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L312
+lea rax, [rbp-568]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-568]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L312:
+lea rax, [rbp-560]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-560]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L310
+L311:
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-568]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET str24
+push rax
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 3
+push rax
+pop rax
+mov QWORD PTR [rbp-576], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD PTR [rbp-584], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD PTR [rbp-584]
+push QWORD PTR [rbp-576]
+mov rax, 4096
+push rax
+push QWORD PTR [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD PTR [rbp-592], rax
+mov rax, 97
+push rax
+push QWORD PTR [rbp-592]
+pop rdi
+pop rax
+mov rcx, 4095
+rep stosb
+push QWORD PTR [rbp-592]
+mov rax, 4095
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD PTR [rbp-8]
+mov rax, 5
+push rax
+push QWORD PTR [rbp-592]
+mov rax, 4090
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-592]
+mov rax, 4095
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 4096
+push rax
+push QWORD PTR [rbp-592]
+pop rdi
+pop rsi
+call v61
+add rsp, 592
+pop rbp
+ret
+v216:
+push rbp
+mov rbp, rsp
+sub rsp, 96
+mov rax, OFFSET str25
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+mov rax, 2
+push rax
+pop rdi
+pop rsi
+call v12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+mov rax, 16
+push rax
+pop rdi
+pop rsi
+call v12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 64
+push rax
+mov rax, 32
+push rax
+mov rax, 33
+push rax
+pop rdi
+pop rsi
+call v12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+pop rdi
+pop rsi
+call v12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 13
+push rax
+mov rax, OFFSET str26
+push rax
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+mov rax, OFFSET str27
+push rax
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, OFFSET str28
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+mov rax, 13
+push rax
+push QWORD PTR [rbp-16]
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+mov rax, 10
+push rax
+mov rax, OFFSET str29
+push rax
+pop rdi
+pop rsi
+call v14
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 3
+push rax
+mov rax, 10
+push rax
+mov rax, OFFSET str30
+push rax
+pop rdi
+pop rsi
+call v14
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET str31
+push rax
+mov rax, OFFSET str32
+push rax
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET str33
+push rax
+mov rax, OFFSET str34
+push rax
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET str35
+push rax
+mov rax, OFFSET str36
+push rax
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET str37
+push rax
+mov rax, OFFSET str38
+push rax
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 3
+push rax
+mov rax, OFFSET str39
+push rax
+mov rax, OFFSET str40
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 100
+push rax
+mov rax, OFFSET str41
+push rax
+mov rax, OFFSET str42
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 3
+push rax
+mov rax, OFFSET str43
+push rax
+mov rax, OFFSET str44
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 100
+push rax
+mov rax, OFFSET str45
+push rax
+mov rax, OFFSET str46
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+mov rax, OFFSET str47
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET str48
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-32]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v20
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, OFFSET str49
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+mov rax, OFFSET str50
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-40]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+call v20
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-80], al
+mov rax, 97
+push rax
+lea rax, [rbp-80]
+push rax
+pop rdi
+pop rax
+movzx eax, al
+mov rdx, 72340172838076673
+imul rax, rdx
+movq xmm0, rax
+punpcklqdq xmm0, xmm0
+movdqu [rdi+0], xmm0
+movdqu [rdi+16], xmm0
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-96], rax
+L313:
+push QWORD PTR [rbp-88]
+push QWORD PTR [v1574]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L314
+lea rax, [rbp-80]
+push rax
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rax, 97
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L315
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L315:
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-88]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L313
+L314:
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 7
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+mov rax, 77
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 3
+push rax
+mov rax, 777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4
+push rax
+mov rax, 7777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 5
+push rax
+mov rax, 77777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 6
+push rax
+mov rax, 777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 7
+push rax
+mov rax, 7777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+mov rax, 77777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 9
+push rax
+mov rax, 777777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 10
+push rax
+mov rax, 7777777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 11
+push rax
+mov rax, 81209347389
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 7
+push rax
+mov rax, OFFSET str51
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 77
+push rax
+mov rax, OFFSET str52
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 777
+push rax
+mov rax, OFFSET str53
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 7777
+push rax
+mov rax, OFFSET str54
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 77777
+push rax
+mov rax, OFFSET str55
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 777777
+push rax
+mov rax, OFFSET str56
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 7777777
+push rax
+mov rax, OFFSET str57
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 77777777
+push rax
+mov rax, OFFSET str58
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 777777777
+push rax
+mov rax, OFFSET str59
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 7777777777
+push rax
+mov rax, OFFSET str60
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 81209347389
+push rax
+mov rax, OFFSET str61
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 96
+pop rbp
+ret
+v217:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov rax, OFFSET str62
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 24
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-16]
+mov rax, 42
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 42
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-16]
+pop rdi
+call v108
+mov rax, 20
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-16]
+push QWORD PTR [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-24]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 20
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-24]
+pop rdi
+call v108
+push QWORD PTR [rbp-32]
+pop rdi
+call v108
+mov rax, 100
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-40]
+mov rax, 7
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 104
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+call v110
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-40]
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1000
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+call v110
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-8]
+mov rax, 7
+push rax
+push QWORD PTR [rbp-56]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-56]
+mov rax, 992
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 100000
+push rax
+push QWORD PTR [rbp-56]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+push QWORD PTR [rbp-8]
+mov rax, 7
+push rax
+push QWORD PTR [rbp-64]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-64]
+mov rax, 99992
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 8
+push rax
+push QWORD PTR [rbp-64]
+pop rdi
+pop rsi
+call v110
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-8]
+mov rax, 7
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-72]
+pop rdi
+call v108
+add rsp, 72
+pop rbp
+ret
+v218:
+push rbp
+mov rbp, rsp
+sub rsp, 104
+mov rax, OFFSET str63
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 8
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v112
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v116
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v114
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1044]
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v116
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+L316:
+push QWORD PTR [rbp-40]
+push QWORD PTR [v1587]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L317
+push QWORD PTR [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v114
+push QWORD PTR [rbp-40]
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v115
+push rax
+push QWORD PTR [rbp-40]
+mov rax, 3
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L316
+L317:
+push QWORD PTR [rbp-8]
+mov rax, 1024
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v116
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L318:
+push QWORD PTR [rbp-40]
+push QWORD PTR [v1587]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L319
+push QWORD PTR [rbp-40]
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v115
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-40]
+mov rax, 3
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L320
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L320:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L318
+L319:
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v113
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v116
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 8
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v117
+mov rax, 1
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v119
+mov rax, 0
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v120
+push rax
+pop rax
+mov QWORD PTR [rbp-96], rax
+push QWORD PTR [rbp-96]
+mov rax, 42
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [v1592]
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v119
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1592]
+lea rax, [rbp-88]
+push rax
+pop rdi
+call v121
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1
+push rax
+pop rax
+mov QWORD PTR [rbp-104], rax
+L321:
+push QWORD PTR [rbp-104]
+push QWORD PTR [v1592]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L322
+push QWORD PTR [rbp-104]
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v120
+push rax
+push QWORD PTR [rbp-104]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-104]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-104]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L321
+L322:
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v120
+push rax
+push QWORD PTR [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 42
+push rax
+push QWORD PTR [rbp-96]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1023
+push rax
+mov rax, 1023
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v120
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-88]
+push rax
+pop rdi
+call v118
+add rsp, 104
+pop rbp
+ret
+v219:
+push rbp
+mov rbp, rsp
+sub rsp, 296
+mov rax, OFFSET str64
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 256
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+call v122
+mov rax, 1
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+mov QWORD PTR [rbp-64], rax
+mov rax, 8
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 7
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1081]
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-64]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 64
+push rax
+mov rax, 1
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-80]
+mov rax, 63
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1000
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-88]
+pop rdi
+pop rax
+mov rcx, 1000
+rep stosb
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1091]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1256
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-56]
+push rax
+pop rdi
+call v131
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD PTR [v1091]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 128
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v122
+mov rax, OFFSET str65
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v133
+push rax
+pop rax
+mov QWORD PTR [rbp-144], rax
+lea rax, [rbp-168]
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v128
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-176], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-184], rax
+L323:
+push QWORD PTR [rbp-184]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L324
+mov rax, 64
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD PTR [rbp-192], rax
+lea rax, [rbp-184]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-184]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L323
+L324:
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD PTR [rbp-200], rax
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+push QWORD PTR [rbp-200]
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-168]
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v129
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-176]
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 6400
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET str66
+push rax
+push QWORD PTR [rbp-144]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, OFFSET str67
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v133
+push rax
+pop rax
+mov QWORD PTR [rbp-208], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-144]
+mov rax, 6
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD PTR [rbp-208]
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-184]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L325:
+push QWORD PTR [rbp-184]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L326
+mov rax, 64
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD PTR [rbp-216], rax
+lea rax, [rbp-184]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-184]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L325
+L326:
+lea rax, [rbp-136]
+push rax
+pop rdi
+call v130
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-136]
+push rax
+push QWORD PTR [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-136]
+push rax
+pop rdi
+call v131
+mov rax, 0
+push rax
+lea rax, [rbp-264]
+push rax
+pop rdi
+pop rsi
+call v122
+mov rax, 42
+push rax
+mov rax, OFFSET str68
+push rax
+pop rax
+mov QWORD PTR [rbp-272], rax
+pop rax
+mov QWORD PTR [rbp-280], rax
+lea rax, [rbp-280]
+push rax
+mov rax, OFFSET str69
+push rax
+lea rax, [rbp-264]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v134
+push rax
+pop rax
+mov QWORD PTR [rbp-288], rax
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET str70
+push rax
+push QWORD PTR [rbp-288]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-264]
+push rax
+push QWORD PTR [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 16
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 2
+push rax
+mov rax, OFFSET str71
+push rax
+lea rax, [rbp-264]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v132
+push rax
+pop rax
+mov QWORD PTR [rbp-296], rax
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, OFFSET str72
+push rax
+push QWORD PTR [rbp-296]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+pop rdi
+call v131
+add rsp, 296
+pop rbp
+ret
+v220:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, OFFSET str73
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+push QWORD PTR [rbp-8]
+mov rax, 17241709254077376921
+push rax
+mov rax, 0
+push rax
+mov rax, OFFSET str74
+push rax
+pop rdi
+pop rsi
+call v143
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 15154266338359012955
+push rax
+mov rax, OFFSET str75
+push rax
+pop rdi
+call v144
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 4952883123889572249
+push rax
+mov rax, OFFSET str76
+push rax
+pop rdi
+call v144
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 18144624926692707313
+push rax
+mov rax, OFFSET str77
+push rax
+pop rdi
+call v144
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 12914696790927413826
+push rax
+mov rax, OFFSET str78
+push rax
+pop rdi
+call v144
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, OFFSET str79
+push rax
+pop rdi
+call v144
+push rax
+mov rax, 3
+push rax
+mov rax, OFFSET str80
+push rax
+pop rdi
+pop rsi
+call v143
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+pop rdi
+call v145
+push rax
+mov rax, 1
+push rax
+pop rdi
+call v145
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+add rsp, 8
+pop rbp
+ret
+v221:
+push rbp
+mov rbp, rsp
+sub rsp, 240
+mov rax, OFFSET str81
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+mov rax, 8
+push rax
+push QWORD PTR [v266]
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v146
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 1
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-72], rax
+L327:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v1616]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L328
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+mov QWORD PTR [rbp-80], rax
+lea rax, [rbp-80]
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v158
+push rax
+pop rax
+mov QWORD PTR [rbp-88], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L327
+L328:
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1616]
+lea rax, [rbp-64]
+push rax
+pop rdi
+call v149
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-96], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L329:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v1616]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L330
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+pop rax
+mov QWORD PTR [rbp-104], rax
+push QWORD PTR [rbp-104]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L331
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L332
+L331:
+push QWORD PTR [rbp-104]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD PTR [rbp-72]
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L333
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L333:
+L332:
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+pop rax
+test rax, rax
+jz L334
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L334:
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L329
+L330:
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 7
+push rax
+pop rax
+mov QWORD PTR [rbp-112], rax
+lea rax, [rbp-112]
+push rax
+mov rax, 32
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v158
+push rax
+mov rax, 8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-8]
+mov rax, 8
+push rax
+mov rax, 32
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+push QWORD PTR [v1616]
+lea rax, [rbp-64]
+push rax
+pop rdi
+call v149
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-96]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L335:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v1616]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L336
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v160
+push rax
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L337
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L337:
+lea rax, [rbp-72]
+push rax
+mov rax, 2
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L335
+L336:
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v160
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 500
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+call v149
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-96]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L338:
+push QWORD PTR [rbp-72]
+push QWORD PTR [v1616]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L339
+push QWORD PTR [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+mov QWORD PTR [rbp-120], rax
+push QWORD PTR [rbp-120]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-72]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L340
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L340:
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L338
+L339:
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-128], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-136], rax
+lea rax, [rbp-128]
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v164
+push rax
+pop rax
+mov QWORD PTR [rbp-144], rax
+L341:
+push QWORD PTR [rbp-144]
+pop rax
+test rax, rax
+jz L342
+lea rax, [rbp-136]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-136]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-144]
+push rax
+lea rax, [rbp-128]
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v164
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L341
+L342:
+push QWORD PTR [rbp-8]
+mov rax, 500
+push rax
+push QWORD PTR [rbp-136]
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-64]
+push rax
+pop rdi
+call v148
+mov rax, 4
+push rax
+push QWORD PTR [v267]
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v146
+mov rax, 0
+push rax
+pop rax
+mov BYTE PTR [rbp-216], al
+mov rax, OFFSET str82
+push rax
+lea rax, [rbp-216]
+push rax
+pop rdi
+pop rsi
+mov eax, [rsi+0]
+mov [rdi+0], eax
+mov al, [rsi+4]
+mov [rdi+4], al
+mov rax, 1
+push rax
+pop rax
+mov DWORD PTR [rbp-224], eax
+lea rax, [rbp-224]
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-216]
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v161
+push rax
+pop rax
+mov QWORD PTR [rbp-232], rax
+mov rax, OFFSET str83
+push rax
+lea rax, [rbp-216]
+push rax
+pop rdi
+pop rsi
+mov eax, [rsi+0]
+mov [rdi+0], eax
+mov al, [rsi+4]
+mov [rdi+4], al
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-216]
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 5
+push rax
+mov rax, OFFSET str84
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 4
+push rax
+mov rax, OFFSET str85
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [v9]
+mov rax, 3
+push rax
+mov rax, OFFSET str86
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v161
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], ebx
+push QWORD PTR [v9]
+mov rax, 0
+push rax
+mov rax, OFFSET str87
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v161
+push rax
+mov rax, 3
+push rax
+pop rbx
+pop rax
+mov [rax], ebx
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+mov rax, 3
+push rax
+mov rax, OFFSET str88
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 3
+push rax
+mov rax, 0
+push rax
+mov rax, OFFSET str89
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 1
+push rax
+mov rax, 5
+push rax
+mov rax, OFFSET str90
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v163
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 0
+push rax
+mov rax, 5
+push rax
+mov rax, OFFSET str91
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-8]
+mov rax, 2
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+call v149
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-200]
+push rax
+pop rdi
+call v148
+mov rax, 0
+push rax
+push QWORD PTR [v267]
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v146
+lea rax, [rbp-200]
+push rax
+push QWORD PTR [v1197]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, OFFSET v136
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [v9]
+mov rax, 4
+push rax
+mov rax, OFFSET str92
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v161
+push rax
+pop rax
+mov QWORD PTR [rbp-240], rax
+push QWORD PTR [rbp-8]
+push QWORD PTR [rbp-240]
+mov rax, 4
+push rax
+mov rax, OFFSET str93
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-200]
+push rax
+pop rdi
+call v148
+add rsp, 240
+pop rbp
+ret
+v222:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+L343:
+push QWORD PTR [rbp-16]
+push QWORD PTR [v1633]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L344
+mov rax, 1
+push rax
+mov rax, OFFSET v1636
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, OFFSET v1638
+push rax
+pop rdi
+call v169
+mov rax, OFFSET v1637
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [v1637]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1638
+push rax
+pop rdi
+call v171
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L343
+L344:
+add rsp, 24
+pop rbp
+ret
+v223:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, OFFSET v1638
+push rax
+pop rdi
+call v169
+L345:
+push QWORD PTR [v1640]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L346
+mov rax, OFFSET v1638
+push rax
+mov rax, OFFSET v1639
+push rax
+pop rdi
+pop rsi
+call v173
+jmp L345
+L346:
+mov rax, OFFSET v1640
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1638
+push rax
+pop rdi
+call v171
+add rsp, 8
+pop rbp
+ret
+v224:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+push QWORD PTR [rbp-16]
+mov rax, 4294967295
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD PTR [rbp-32], rax
+L347:
+push QWORD PTR [rbp-32]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD PTR [v1635]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L348
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 2
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-24]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD PTR [rbp-40]
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+mov rax, OFFSET v224
+push rax
+push QWORD PTR [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v194
+lea rax, [rbp-24]
+push rax
+push QWORD PTR [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L347
+L348:
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+L349:
+push QWORD PTR [rbp-24]
+push QWORD PTR [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L350
+lea rax, [rbp-48]
+push rax
+push QWORD PTR [rbp-48]
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L349
+L350:
+push QWORD PTR [rbp-48]
+mov rax, OFFSET v1641
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-56], rax
+add rsp, 56
+pop rbp
+ret
+v225:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD PTR [rbp-16]
+mov rax, OFFSET v1641
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD PTR [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v226:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [v442]
+pop rdi
+pop rsi
+call v57
+push rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+mov rax, 1000
+push rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [v435]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-16]
+push rax
+push QWORD PTR [v436]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1000000
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 24
+pop rbp
+ret
+v227:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD PTR [rbp-8]
+call v226
+push rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+lea rax, [rbp-24]
+push rax
+mov rax, OFFSET str94
+push rax
+pop rdi
+pop rsi
+call v92
+add rsp, 24
+pop rbp
+ret
+v228:
+push rbp
+mov rbp, rsp
+sub rsp, 256
+mov rax, OFFSET v1636
+push rax
+mov rax, OFFSET v1638
+push rax
+mov rax, OFFSET v1641
+push rax
+pop rax
+mov QWORD PTR [rbp-8], rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+lea rax, [rbp-24]
+push rax
+mov rax, OFFSET str95
+push rax
+pop rdi
+pop rsi
+call v92
+mov rax, OFFSET str96
+push rax
+pop rax
+mov QWORD PTR [rbp-32], rax
+mov rax, 40
+push rax
+pop rax
+mov QWORD PTR [rbp-40], rax
+push QWORD PTR [rbp-32]
+mov rax, 40
+push rax
+mov rax, 2
+push rax
+lea rax, [rbp-40]
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 42
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 42
+push rax
+mov rax, 7
+push rax
+mov rax, 41
+push rax
+lea rax, [rbp-40]
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 42
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 42
+push rax
+mov rax, 7
+push rax
+mov rax, 42
+push rax
+lea rax, [rbp-40]
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 7
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 7
+push rax
+mov rax, 9
+push rax
+lea rax, [rbp-40]
+push rax
+pop rdi
+pop rsi
+call v165
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 9
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, OFFSET v22
+push rax
+pop rax
+mov QWORD PTR [rbp-48], rax
+mov rax, OFFSET v23
+push rax
+pop rax
+mov QWORD PTR [rbp-56], rax
+push QWORD PTR [rbp-32]
+mov rax, 9
+push rax
+mov rax, 1
+push rax
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-48]
+pop rax
+pop rdi
+pop rsi
+call rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 10
+push rax
+mov rax, 3
+push rax
+mov rax, 10
+push rax
+lea rax, [rbp-40]
+push rax
+push QWORD PTR [rbp-56]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+call rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 3
+push rax
+push QWORD PTR [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1
+push rax
+pop rdi
+call v227
+mov rax, OFFSET v1638
+push rax
+pop rdi
+call v168
+mov rax, OFFSET v1636
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1637
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-128], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-136], rax
+L351:
+push QWORD PTR [rbp-136]
+push QWORD PTR [v1632]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L352
+lea rax, [rbp-128]
+push rax
+push QWORD PTR [rbp-128]
+push QWORD PTR [v9]
+mov rax, OFFSET v222
+push rax
+lea rax, [rbp-120]
+push rax
+push QWORD PTR [rbp-136]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v176
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-136]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-136]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L351
+L352:
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+push QWORD PTR [rbp-128]
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-136]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L353:
+push QWORD PTR [rbp-136]
+push QWORD PTR [v1632]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L354
+lea rax, [rbp-120]
+push rax
+push QWORD PTR [rbp-136]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v177
+lea rax, [rbp-136]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-136]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L353
+L354:
+push QWORD PTR [rbp-32]
+mov rax, 8000
+push rax
+push QWORD PTR [v1636]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 8000
+push rax
+push QWORD PTR [v1637]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+mov rax, OFFSET v1638
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 2
+push rax
+pop rdi
+call v227
+mov rax, OFFSET v1639
+push rax
+pop rdi
+call v172
+mov rax, OFFSET v1640
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+push QWORD PTR [v9]
+mov rax, OFFSET v223
+push rax
+lea rax, [rbp-152]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v176
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, OFFSET v1638
+push rax
+pop rdi
+call v169
+mov rax, OFFSET v1640
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, OFFSET v1639
+push rax
+pop rdi
+call v174
+mov rax, OFFSET v1638
+push rax
+pop rdi
+call v171
+lea rax, [rbp-152]
+push rax
+pop rdi
+call v177
+push QWORD PTR [rbp-32]
+mov rax, 2
+push rax
+push QWORD PTR [v1640]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 3
+push rax
+pop rdi
+call v227
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+push QWORD PTR [v1632]
+lea rax, [rbp-248]
+push rax
+pop rdi
+pop rsi
+call v192
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, OFFSET v1641
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD PTR [v1634]
+mov rax, OFFSET v224
+push rax
+lea rax, [rbp-248]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v193
+lea rax, [rbp-248]
+push rax
+pop rdi
+call v195
+push QWORD PTR [rbp-32]
+mov rax, 4999950000
+push rax
+push QWORD PTR [v1641]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 4
+push rax
+pop rdi
+call v227
+mov rax, OFFSET v1641
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD PTR [rbp-256], rax
+L355:
+push QWORD PTR [rbp-256]
+mov rax, 1000
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L356
+push QWORD PTR [rbp-256]
+mov rax, OFFSET v225
+push rax
+lea rax, [rbp-248]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v193
+lea rax, [rbp-256]
+push rax
+mov rax, 1
+push rax
+push QWORD PTR [rbp-256]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L355
+L356:
+mov rax, 5
+push rax
+pop rdi
+call v227
+lea rax, [rbp-248]
+push rax
+pop rdi
+call v196
+mov rax, 6
+push rax
+pop rdi
+call v227
+push QWORD PTR [rbp-32]
+mov rax, 499500
+push rax
+push QWORD PTR [v1641]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD PTR [rbp-32]
+mov rax, 0
+push rax
+call v178
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+add rsp, 256
+pop rbp
+ret
+v229:
+push rbp
+mov rbp, rsp
+push QWORD PTR [v9]
+mov rax, OFFSET str97
+push rax
+pop rdi
+pop rsi
+call v92
+call v200
+call v201
+call v203
+call v208
+call v209
+call v210
+call v211
+call v215
+call v216
+call v217
+call v218
+call v219
+call v220
+call v221
+call v228
+pop rbp
+ret
+v230:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+push QWORD PTR [v1467]
+push QWORD PTR [v1468]
+push QWORD PTR [v1466]
+pop rax
+mov QWORD PTR [rbp-8], rax
+pop rax
+mov QWORD PTR [rbp-16], rax
+pop rax
+mov QWORD PTR [rbp-24], rax
+lea rax, [rbp-24]
+push rax
+mov rax, OFFSET str98
+push rax
+pop rdi
+pop rsi
+call v92
+add rsp, 24
+pop rbp
+ret
+main:
+push rbp
+mov rbp, rsp
+call v197
+call v229
+call v230
+pop rbp
+ret
+.data
+str0: .byte 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 97, 98, 99, 100, 101, 102, 0
+str1: .byte 48, 120, 0
+str2: .byte 48, 98, 0
+str3: .byte 91, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 93, 58, 32, 37, 115, 0
+str4: .byte 109, 101, 109, 111, 114, 121, 95, 105, 110, 105, 116, 58, 32, 115, 105, 122, 101, 32, 99, 108, 97, 115, 115, 101, 115, 32, 100, 111, 32, 110, 111, 116, 32, 101, 110, 100, 32, 97, 116, 32, 77, 69, 77, 79, 82, 89, 95, 83, 77, 65, 76, 76, 95, 77, 65, 88, 10, 0
+str5: .byte 118, 101, 99, 116, 111, 114, 95, 114, 101, 115, 101, 114, 118, 101, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str6: .byte 115, 116, 97, 98, 108, 101, 95, 118, 101, 99, 116, 111, 114, 95, 114, 101, 115, 101, 114, 118, 101, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str7: .byte 97, 114, 101, 110, 97, 95, 99, 104, 117, 110, 107, 95, 112, 117, 115, 104, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str8: .byte 97, 114, 101, 110, 97, 95, 97, 108, 108, 111, 99, 95, 97, 108, 105, 103, 110, 101, 100, 58, 32, 97, 108, 105, 103, 110, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 112, 111, 119, 101, 114, 32, 111, 102, 32, 116, 119, 111, 10, 0
+str9: .byte 104, 97, 115, 104, 109, 97, 112, 95, 103, 114, 111, 119, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str10: .byte 104, 97, 115, 104, 109, 97, 112, 95, 105, 110, 115, 101, 114, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str11: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 115, 117, 98, 109, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str12: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 105, 110, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str13: .byte 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 105, 110, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str14: .byte 97, 115, 115, 101, 114, 116, 95, 101, 113, 117, 97, 108, 32, 40, 37, 100, 32, 33, 61, 32, 37, 100, 41, 58, 32, 37, 115, 10, 0
+str15: .byte 97, 115, 115, 101, 114, 116, 95, 110, 111, 116, 95, 101, 113, 117, 97, 108, 32, 102, 97, 105, 108, 101, 100, 32, 40, 37, 100, 32, 61, 61, 32, 37, 100, 41, 58, 32, 37, 115, 10, 0
+str16: .byte 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 97, 114, 105, 116, 104, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 97, 114, 105, 116, 104, 40, 41, 0
+str17: .byte 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 115, 116, 114, 117, 99, 116, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 115, 116, 114, 117, 99, 116, 40, 41, 0
+str18: .byte 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 98, 105, 116, 119, 105, 115, 101, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 98, 105, 116, 119, 105, 115, 101, 40, 41, 0
+str19: .byte 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 102, 117, 110, 99, 116, 105, 111, 110, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 0
+str20: .byte 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 115, 116, 114, 117, 99, 116, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 115, 116, 114, 117, 99, 116, 40, 41, 0
+str21: .byte 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 97, 114, 114, 97, 121, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 97, 114, 114, 97, 121, 40, 41, 0
+str22: .byte 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 99, 111, 110, 115, 116, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 99, 111, 110, 115, 116, 40, 41, 0
+str23: .byte 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 105, 110, 116, 114, 105, 110, 115, 105, 99, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 105, 110, 116, 114, 105, 110, 115, 105, 99, 40, 41, 0
+str24: .byte 0
+str25: .byte 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 99, 111, 109, 109, 111, 110, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 99, 111, 109, 109, 111, 110, 40, 41, 0
+str26: .byte 104, 101, 108, 108, 111, 44, 32, 119, 111, 114, 108, 100, 33, 0
+str27: .byte 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0
+str28: .byte 104, 101, 108, 108, 111, 44, 32, 119, 111, 114, 108, 100, 33, 0
+str29: .byte 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 0
+str30: .byte 97, 97, 97, 0
+str31: .byte 104, 101, 108, 108, 111, 0
+str32: .byte 104, 101, 108, 108, 111, 0
+str33: .byte 104, 101, 108, 108, 111, 0
+str34: .byte 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str35: .byte 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str36: .byte 104, 101, 108, 108, 111, 0
+str37: .byte 0
+str38: .byte 104, 101, 108, 108, 111, 0
+str39: .byte 104, 101, 108, 108, 111, 0
+str40: .byte 104, 101, 108, 108, 111, 0
+str41: .byte 104, 101, 108, 108, 111, 0
+str42: .byte 104, 101, 108, 108, 111, 0
+str43: .byte 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str44: .byte 104, 101, 108, 108, 111, 0
+str45: .byte 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str46: .byte 104, 101, 108, 108, 111, 0
+str47: .byte 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str48: .byte 72, 69, 76, 76, 79, 0
+str49: .byte 72, 69, 76, 76, 79, 0
+str50: .byte 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str51: .byte 55, 0
+str52: .byte 55, 55, 0
+str53: .byte 55, 55, 55, 0
+str54: .byte 55, 55, 55, 55, 0
+str55: .byte 55, 55, 55, 55, 55, 0
+str56: .byte 55, 55, 55, 55, 55, 55, 0
+str57: .byte 55, 55, 55, 55, 55, 55, 55, 0
+str58: .byte 55, 55, 55, 55, 55, 55, 55, 55, 0
+str59: .byte 55, 55, 55, 55, 55, 55, 55, 55, 55, 0
+str60: .byte 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 0
+str61: .byte 56, 49, 50, 48, 57, 51, 52, 55, 51, 56, 57, 0
+str62: .byte 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 109, 101, 109, 111, 114, 121, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 109, 101, 109, 111, 114, 121, 40, 41, 0
+str63: .byte 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 118, 101, 99, 116, 111, 114, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 118, 101, 99, 116, 111, 114, 40, 41, 0
+str64: .byte 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 97, 114, 101, 110, 97, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 97, 114, 101, 110, 97, 40, 41, 0
+str65: .byte 102, 105, 114, 115, 116, 0
+str66: .byte 102, 105, 114, 115, 116, 0
+str67: .byte 115, 101, 99, 111, 110, 100, 0
+str68: .byte 115, 116, 114, 0
+str69: .byte 37, 100, 32, 37, 115, 0
+str70: .byte 52, 50, 32, 115, 116, 114, 0
+str71: .byte 97, 98, 99, 0
+str72: .byte 97, 98, 0
+str73: .byte 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 104, 97, 115, 104, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 104, 97, 115, 104, 40, 41, 0
+str74: .byte 0
+str75: .byte 97, 0
+str76: .byte 97, 98, 99, 0
+str77: .byte 78, 111, 98, 111, 100, 121, 32, 105, 110, 115, 112, 101, 99, 116, 115, 32, 116, 104, 101, 32, 115, 112, 97, 109, 109, 105, 115, 104, 32, 114, 101, 112, 101, 116, 105, 116, 105, 111, 110, 0
+str78: .byte 104, 101, 108, 108, 111, 44, 32, 119, 111, 114, 108, 100, 0
+str79: .byte 97, 98, 99, 0
+str80: .byte 97, 98, 99, 100, 101, 102, 0
+str81: .byte 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 104, 97, 115, 104, 109, 97, 112, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 104, 97, 115, 104, 109, 97, 112, 40, 41, 0
+str82: .byte 97, 108, 112, 104, 97, 0
+str83: .byte 111, 109, 101, 103, 97, 0
+str84: .byte 97, 108, 112, 104, 97, 0
+str85: .byte 97, 108, 112, 104, 97, 0
+str86: .byte 97, 108, 112, 0
+str87: .byte 0
+str88: .byte 97, 108, 112, 0
+str89: .byte 0
+str90: .byte 97, 108, 112, 104, 97, 0
+str91: .byte 97, 108, 112, 104, 97, 0
+str92: .byte 98, 101, 116, 97, 0
+str93: .byte 98, 101, 116, 97, 0
+str94: .byte 109, 97, 114, 107, 32, 37, 100, 32, 37, 100, 10, 0
+str95: .byte 97, 100, 100, 114, 32, 37, 100, 32, 37, 100, 32, 37, 100, 10, 0
+str96: .byte 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 116, 104, 114, 101, 97, 100, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 116, 104, 114, 101, 97, 100, 40, 41, 0
+str97: .byte 114, 117, 110, 110, 105, 110, 103, 32, 116, 101, 115, 116, 115, 46, 46, 46, 10, 0
+str98: .byte 116, 101, 115, 116, 115, 32, 99, 111, 109, 112, 108, 101, 116, 101, 58, 32, 37, 100, 32, 112, 97, 115, 115, 101, 100, 44, 32, 37, 100, 32, 102, 97, 105, 108, 101, 100, 44, 32, 37, 100, 32, 116, 111, 116, 97, 108, 10, 0
+align 8
+v7: .quad 17235080952167423836
+align 8
+v8: .quad 0
+align 8
+v9: .quad 0
+align 8
+v232: .byte 0
+align 8
+v233: .byte 1
+align 8
+v234: .byte 2
+align 8
+v235: .byte 3
+align 8
+v236: .byte 4
+align 8
+v237: .byte 5
+align 8
+v238: .byte 6
+align 8
+v239: .byte 7
+align 8
+v240: .byte 8
+align 8
+v241: .byte 9
+align 8
+v242: .byte 10
+align 8
+v243: .byte 11
+align 8
+v244: .byte 12
+align 8
+v245: .byte 13
+align 8
+v246: .byte 14
+align 8
+v247: .byte 15
+align 8
+v248: .byte 16
+align 8
+v249: .byte 17
+align 8
+v250: .byte 18
+align 8
+v251: .byte 19
+align 8
+v252: .byte 20
+align 8
+v253: .byte 21
+align 8
+v254: .byte 22
+align 8
+v255: .byte 23
+align 8
+v256: .byte 24
+align 8
+v257: .byte 25
+align 8
+v258: .byte 26
+align 8
+v259: .byte 27
+align 8
+v260: .byte 28
+align 8
+v261: .byte 29
+align 8
+v262: .byte 30
+align 8
+v263: .byte 31
+align 8
+v264: .quad 0
+align 8
+v265: .quad 1
+align 8
+v266: .quad 0
+align 8
+v267: .quad 1
+align 8
+v268: .quad 18446744073709551614
+align 8
+v269: .quad 0
+align 8
+v270: .quad 1
+align 8
+v271: .quad 1048576
+align 8
+v275: .quad 18446744073709551615
+align 8
+v276: .quad 9223372036854775807
+align 8
+v277: .long 4294967295
+align 8
+v278: .long 2147483647
+align 8
+v279: .word 65535
+align 8
+v280: .word 32767
+align 8
+v281: .byte 255
+align 8
+v282: .byte 127
+align 8
+v283: .quad 18446744073709551615
+align 8
+v284: .quad 9223372036854775807
+align 8
+v285: .long 4294967295
+align 8
+v286: .long 2147483647
+align 8
+v287: .word 65535
+align 8
+v288: .word 32767
+align 8
+v289: .byte 255
+align 8
+v290: .byte 127
+align 8
+v291: .quad 18446744073709551615
+align 8
+v292: .quad 512
+align 8
+v293: .quad 0
+align 8
+v294: .quad 8
+align 8
+v350: .quad 10
+align 8
+v356: .quad 10
+align 8
+v363: .quad 20
+align 8
+v370: .quad 95
+align 8
+v394: .quad 1
+align 8
+v415: .quad 1
+align 8
+v421: .quad 32
+align 8
+v435: .quad 0
+align 8
+v436: .quad 8
+align 8
+v438: .quad 0
+align 8
+v439: .quad 1
+align 8
+v440: .quad 2
+align 8
+v441: .quad 0
+align 8
+v442: .quad 1
+align 8
+v443: .quad 2
+align 8
+v444: .quad 3
+align 8
+v445: .quad 4
+align 8
+v446: .quad 5
+align 8
+v447: .quad 6
+align 8
+v448: .quad 7
+align 8
+v449: .quad 8
+align 8
+v450: .quad 9
+align 8
+v451: .quad 11
+align 8
+v452: .quad 0
+align 8
+v453: .quad 1
+align 8
+v454: .quad 2
+align 8
+v455: .quad 3
+align 8
+v456: .quad 4
+align 8
+v457: .quad 5
+align 8
+v458: .quad 6
+align 8
+v459: .quad 7
+align 8
+v460: .quad 8
+align 8
+v461: .quad 9
+align 8
+v462: .quad 10
+align 8
+v463: .quad 11
+align 8
+v464: .quad 12
+align 8
+v465: .quad 13
+align 8
+v466: .quad 14
+align 8
+v467: .quad 15
+align 8
+v468: .quad 16
+align 8
+v469: .quad 17
+align 8
+v470: .quad 18
+align 8
+v471: .quad 19
+align 8
+v472: .quad 20
+align 8
+v473: .quad 21
+align 8
+v474: .quad 22
+align 8
+v475: .quad 23
+align 8
+v476: .quad 24
+align 8
+v477: .quad 25
+align 8
+v478: .quad 26
+align 8
+v479: .quad 27
+align 8
+v480: .quad 28
+align 8
+v481: .quad 29
+align 8
+v482: .quad 30
+align 8
+v483: .quad 31
+align 8
+v484: .quad 32
+align 8
+v485: .quad 33
+align 8
+v486: .quad 34
+align 8
+v487: .quad 35
+align 8
+v488: .quad 36
+align 8
+v489: .quad 37
+align 8
+v490: .quad 38
+align 8
+v491: .quad 39
+align 8
+v492: .quad 40
+align 8
+v493: .quad 41
+align 8
+v494: .quad 42
+align 8
+v495: .quad 43
+align 8
+v496: .quad 44
+align 8
+v497: .quad 45
+align 8
+v498: .quad 46
+align 8
+v499: .quad 47
+align 8
+v500: .quad 48
+align 8
+v501: .quad 49
+align 8
+v502: .quad 50
+align 8
+v503: .quad 51
+align 8
+v504: .quad 52
+align 8
+v505: .quad 53
+align 8
+v506: .quad 54
+align 8
+v507: .quad 55
+align 8
+v508: .quad 56
+align 8
+v509: .quad 57
+align 8
+v510: .quad 58
+align 8
+v511: .quad 59
+align 8
+v512: .quad 60
+align 8
+v513: .quad 61
+align 8
+v514: .quad 62
+align 8
+v515: .quad 63
+align 8
+v516: .quad 64
+align 8
+v517: .quad 65
+align 8
+v518: .quad 66
+align 8
+v519: .quad 67
+align 8
+v520: .quad 68
+align 8
+v521: .quad 69
+align 8
+v522: .quad 70
+align 8
+v523: .quad 71
+align 8
+v524: .quad 72
+align 8
+v525: .quad 73
+align 8
+v526: .quad 74
+align 8
+v527: .quad 75
+align 8
+v528: .quad 76
+align 8
+v529: .quad 77
+align 8
+v530: .quad 78
+align 8
+v531: .quad 79
+align 8
+v532: .quad 80
+align 8
+v533: .quad 81
+align 8
+v534: .quad 82
+align 8
+v535: .quad 83
+align 8
+v536: .quad 84
+align 8
+v537: .quad 85
+align 8
+v538: .quad 86
+align 8
+v539: .quad 87
+align 8
+v540: .quad 88
+align 8
+v541: .quad 89
+align 8
+v542: .quad 90
+align 8
+v543: .quad 91
+align 8
+v544: .quad 92
+align 8
+v545: .quad 93
+align 8
+v546: .quad 94
+align 8
+v547: .quad 95
+align 8
+v548: .quad 96
+align 8
+v549: .quad 97
+align 8
+v550: .quad 98
+align 8
+v551: .quad 99
+align 8
+v552: .quad 100
+align 8
+v553: .quad 101
+align 8
+v554: .quad 102
+align 8
+v555: .quad 103
+align 8
+v556: .quad 104
+align 8
+v557: .quad 105
+align 8
+v558: .quad 106
+align 8
+v559: .quad 107
+align 8
+v560: .quad 108
+align 8
+v561: .quad 109
+align 8
+v562: .quad 110
+align 8
+v563: .quad 111
+align 8
+v564: .quad 112
+align 8
+v565: .quad 113
+align 8
+v566: .quad 114
+align 8
+v567: .quad 115
+align 8
+v568: .quad 116
+align 8
+v569: .quad 117
+align 8
+v570: .quad 118
+align 8
+v571: .quad 119
+align 8
+v572: .quad 120
+align 8
+v573: .quad 121
+align 8
+v574: .quad 122
+align 8
+v575: .quad 123
+align 8
+v576: .quad 124
+align 8
+v577: .quad 125
+align 8
+v578: .quad 126
+align 8
+v579: .quad 127
+align 8
+v580: .quad 128
+align 8
+v581: .quad 129
+align 8
+v582: .quad 130
+align 8
+v583: .quad 131
+align 8
+v584: .quad 132
+align 8
+v585: .quad 133
+align 8
+v586: .quad 134
+align 8
+v587: .quad 135
+align 8
+v588: .quad 136
+align 8
+v589: .quad 137
+align 8
+v590: .quad 138
+align 8
+v591: .quad 139
+align 8
+v592: .quad 140
+align 8
+v593: .quad 141
+align 8
+v594: .quad 142
+align 8
+v595: .quad 143
+align 8
+v596: .quad 144
+align 8
+v597: .quad 145
+align 8
+v598: .quad 146
+align 8
+v599: .quad 147
+align 8
+v600: .quad 148
+align 8
+v601: .quad 149
+align 8
+v602: .quad 150
+align 8
+v603: .quad 151
+align 8
+v604: .quad 152
+align 8
+v605: .quad 153
+align 8
+v606: .quad 154
+align 8
+v607: .quad 155
+align 8
+v608: .quad 156
+align 8
+v609: .quad 157
+align 8
+v610: .quad 158
+align 8
+v611: .quad 159
+align 8
+v612: .quad 160
+align 8
+v613: .quad 161
+align 8
+v614: .quad 162
+align 8
+v615: .quad 163
+align 8
+v616: .quad 164
+align 8
+v617: .quad 165
+align 8
+v618: .quad 166
+align 8
+v619: .quad 167
+align 8
+v620: .quad 168
+align 8
+v621: .quad 169
+align 8
+v622: .quad 170
+align 8
+v623: .quad 171
+align 8
+v624: .quad 172
+align 8
+v625: .quad 173
+align 8
+v626: .quad 174
+align 8
+v627: .quad 175
+align 8
+v628: .quad 176
+align 8
+v629: .quad 177
+align 8
+v630: .quad 178
+align 8
+v631: .quad 179
+align 8
+v632: .quad 180
+align 8
+v633: .quad 181
+align 8
+v634: .quad 182
+align 8
+v635: .quad 183
+align 8
+v636: .quad 184
+align 8
+v637: .quad 185
+align 8
+v638: .quad 186
+align 8
+v639: .quad 187
+align 8
+v640: .quad 188
+align 8
+v641: .quad 189
+align 8
+v642: .quad 190
+align 8
+v643: .quad 191
+align 8
+v644: .quad 192
+align 8
+v645: .quad 193
+align 8
+v646: .quad 194
+align 8
+v647: .quad 195
+align 8
+v648: .quad 196
+align 8
+v649: .quad 197
+align 8
+v650: .quad 198
+align 8
+v651: .quad 199
+align 8
+v652: .quad 200
+align 8
+v653: .quad 201
+align 8
+v654: .quad 202
+align 8
+v655: .quad 203
+align 8
+v656: .quad 204
+align 8
+v657: .quad 205
+align 8
+v658: .quad 206
+align 8
+v659: .quad 207
+align 8
+v660: .quad 208
+align 8
+v661: .quad 209
+align 8
+v662: .quad 210
+align 8
+v663: .quad 211
+align 8
+v664: .quad 212
+align 8
+v665: .quad 213
+align 8
+v666: .quad 214
+align 8
+v667: .quad 215
+align 8
+v668: .quad 216
+align 8
+v669: .quad 217
+align 8
+v670: .quad 218
+align 8
+v671: .quad 219
+align 8
+v672: .quad 220
+align 8
+v673: .quad 221
+align 8
+v674: .quad 222
+align 8
+v675: .quad 223
+align 8
+v676: .quad 224
+align 8
+v677: .quad 225
+align 8
+v678: .quad 226
+align 8
+v679: .quad 227
+align 8
+v680: .quad 228
+align 8
+v681: .quad 229
+align 8
+v682: .quad 230
+align 8
+v683: .quad 231
+align 8
+v684: .quad 232
+align 8
+v685: .quad 233
+align 8
+v686: .quad 234
+align 8
+v687: .quad 235
+align 8
+v688: .quad 236
+align 8
+v689: .quad 237
+align 8
+v690: .quad 238
+align 8
+v691: .quad 239
+align 8
+v692: .quad 240
+align 8
+v693: .quad 241
+align 8
+v694: .quad 242
+align 8
+v695: .quad 243
+align 8
+v696: .quad 244
+align 8
+v697: .quad 245
+align 8
+v698: .quad 246
+align 8
+v699: .quad 247
+align 8
+v700: .quad 248
+align 8
+v701: .quad 249
+align 8
+v702: .quad 250
+align 8
+v703: .quad 251
+align 8
+v704: .quad 252
+align 8
+v705: .quad 253
+align 8
+v706: .quad 254
+align 8
+v707: .quad 255
+align 8
+v708: .quad 256
+align 8
+v709: .quad 257
+align 8
+v710: .quad 258
+align 8
+v711: .quad 259
+align 8
+v712: .quad 260
+align 8
+v713: .quad 261
+align 8
+v714: .quad 262
+align 8
+v715: .quad 263
+align 8
+v716: .quad 264
+align 8
+v717: .quad 265
+align 8
+v718: .quad 266
+align 8
+v719: .quad 267
+align 8
+v720: .quad 268
+align 8
+v721: .quad 269
+align 8
+v722: .quad 270
+align 8
+v723: .quad 271
+align 8
+v724: .quad 272
+align 8
+v725: .quad 273
+align 8
+v726: .quad 274
+align 8
+v727: .quad 275
+align 8
+v728: .quad 276
+align 8
+v729: .quad 277
+align 8
+v730: .quad 278
+align 8
+v731: .quad 279
+align 8
+v732: .quad 280
+align 8
+v733: .quad 281
+align 8
+v734: .quad 282
+align 8
+v735: .quad 283
+align 8
+v736: .quad 284
+align 8
+v737: .quad 285
+align 8
+v738: .quad 286
+align 8
+v739: .quad 287
+align 8
+v740: .quad 288
+align 8
+v741: .quad 289
+align 8
+v742: .quad 290
+align 8
+v743: .quad 291
+align 8
+v744: .quad 292
+align 8
+v745: .quad 293
+align 8
+v746: .quad 294
+align 8
+v747: .quad 295
+align 8
+v748: .quad 296
+align 8
+v749: .quad 297
+align 8
+v750: .quad 298
+align 8
+v751: .quad 299
+align 8
+v752: .quad 300
+align 8
+v753: .quad 301
+align 8
+v754: .quad 302
+align 8
+v755: .quad 303
+align 8
+v756: .quad 304
+align 8
+v757: .quad 305
+align 8
+v758: .quad 306
+align 8
+v759: .quad 307
+align 8
+v760: .quad 308
+align 8
+v761: .quad 309
+align 8
+v762: .quad 310
+align 8
+v763: .quad 311
+align 8
+v764: .quad 312
+align 8
+v765: .quad 313
+align 8
+v766: .quad 0
+align 8
+v767: .quad 1
+align 8
+v768: .quad 64
+align 8
+v769: .quad 512
+align 8
+v770: .quad 0
+align 8
+v771: .quad 1
+align 8
+v772: .quad 2
+align 8
+v773: .quad 4
+align 8
+v774: .quad 16777216
+align 8
+v775: .quad 33554432
+align 8
+v776: .quad 1
+align 8
+v777: .quad 2
+align 8
+v778: .quad 16
+align 8
+v779: .quad 32
+align 8
+v780: .quad 32
+align 8
+v781: .quad 16384
+align 8
+v782: .quad 131072
+align 8
+v783: .quad 1
+align 8
+v784: .quad 2
+align 8
+v785: .quad 4
+align 8
+v786: .quad 256
+align 8
+v787: .quad 512
+align 8
+v788: .quad 1024
+align 8
+v789: .quad 2048
+align 8
+v790: .quad 65536
+align 8
+v791: .quad 262144
+align 8
+v792: .quad 1048576
+align 8
+v793: .quad 2097152
+align 8
+v794: .quad 0
+align 8
+v795: .quad 1
+align 8
+v796: .quad 128
+align 8
+v797: .quad 1
+align 8
+v798: .quad 2
+align 8
+v799: .quad 3
+align 8
+v800: .quad 4
+align 8
+v801: .quad 5
+align 8
+v802: .quad 6
+align 8
+v803: .quad 10
+align 8
+v804: .quad 2
+align 8
+v805: .quad 0
+align 8
+v806: .quad 0
+align 8
+v807: .quad 2
+align 8
+v809: .quad 0
+align 8
+v811: .quad 0
+align 8
+v812: .quad 2
+align 8
+v813: .quad 4
+align 8
+v814: .quad 8
+align 8
+v816: .quad 0
+align 8
+v817: .quad 8
+align 8
+v818: .quad 16
+align 8
+v819: .quad 24
+align 8
+v820: .quad 28
+align 8
+v821: .quad 32
+align 8
+v822: .quad 36
+align 8
+v823: .quad 40
+align 8
+v824: .quad 48
+align 8
+v825: .quad 56
+align 8
+v826: .quad 64
+align 8
+v827: .quad 72
+align 8
+v828: .quad 88
+align 8
+v829: .quad 104
+align 8
+v830: .quad 120
+align 8
+v906: .quad 1024
+align 8
+v907: .quad 4096
+align 8
+v908: .quad 65536
+align 8
+v999: .quad 2048
+align 8
+v1000: .quad 4
+align 8
+v1001: .quad 24
+align 8
+v1002: .quad 129
+align 8
+v1003: .quad 65536
+align 8
+v1044: .quad 16
+align 8
+v1045: .quad 0
+align 8
+v1046: .quad 8
+align 8
+v1047: .quad 16
+align 8
+v1059: .quad 8
+align 8
+v1060: .quad 256
+align 8
+v1061: .quad 0
+align 8
+v1062: .quad 24
+align 8
+v1063: .quad 32
+align 8
+v1080: .quad 65536
+align 8
+v1081: .quad 8
+align 8
+v1082: .quad 0
+align 8
+v1083: .quad 8
+align 8
+v1084: .quad 16
+align 8
+v1086: .quad 0
+align 8
+v1087: .quad 8
+align 8
+v1088: .quad 16
+align 8
+v1089: .quad 24
+align 8
+v1090: .quad 32
+align 8
+v1091: .quad 40
+align 8
+v1093: .quad 0
+align 8
+v1094: .quad 8
+align 8
+v1095: .quad 16
+align 8
+v1161: .quad 11400714785074694791
+align 8
+v1162: .quad 14029467366897019727
+align 8
+v1163: .quad 1609587929392839161
+align 8
+v1164: .quad 9650029242287828579
+align 8
+v1165: .quad 2870177450012600261
+align 8
+v1186: .quad 16
+align 8
+v1187: .quad 0
+align 8
+v1188: .quad 8
+align 8
+v1189: .quad 16
+align 8
+v1191: .quad 0
+align 8
+v1192: .quad 8
+align 8
+v1193: .quad 16
+align 8
+v1194: .quad 24
+align 8
+v1195: .quad 32
+align 8
+v1196: .quad 40
+align 8
+v1197: .quad 48
+align 8
+v1300: .quad 8388608
+align 8
+v1301: .quad 3477248
+align 8
+v1302: .quad 2147483647
+align 8
+v1303: .quad 4096
+align 8
+v1304: .quad 64
+align 8
+v1315: .quad 0
+align 8
+v1322: .quad 0
+align 8
+v1332: .quad 0
+align 8
+v1333: .quad 8
+align 8
+v1354: .quad 0
+align 8
+v1355: .quad 8
+align 8
+v1359: .quad 0
+align 8
+v1360: .quad 8
+align 8
+v1361: .quad 16
+align 8
+v1382: .quad 0
+align 8
+v1383: .quad 8
+align 8
+v1384: .quad 16
+align 8
+v1385: .quad 32
+align 8
+v1387: .quad 0
+align 8
+v1388: .quad 8
+align 8
+v1389: .quad 16
+align 8
+v1390: .quad 24
+align 8
+v1391: .quad 32
+align 8
+v1392: .quad 40
+align 8
+v1393: .quad 48
+align 8
+v1394: .quad 56
+align 8
+v1395: .quad 64
+align 8
+v1396: .quad 72
+align 8
+v1397: .quad 80
+align 8
+v1398: .quad 88
+align 8
+v1481: .quad 0
+align 8
+v1482: .quad 8
+align 8
+v1496: .quad 0
+align 8
+v1497: .quad 8
+align 8
+v1499: .quad 0
+align 8
+v1500: .quad 8
+align 8
+v1507: .quad 32
+align 8
+v1509: .quad 32
+align 8
+v1511: .quad 32
+align 8
+v1513: .quad 32
+align 8
+v1515: .quad 0
+align 8
+v1516: .quad 8
+align 8
+v1518: .quad 32
+align 8
+v1523: .quad 0
+align 8
+v1524: .quad 4
+align 8
+v1525: .quad 2
+align 8
+v1526: .quad 4
+align 8
+v1527: .quad 4
+align 8
+v1528: .quad 4
+align 8
+v1529: .quad 128
+align 8
+v1530: .quad 1
+align 8
+v1531: .quad 0
+align 8
+v1532: .quad 1
+align 8
+v1533: .quad 1
+align 8
+v1534: .quad 0
+align 8
+v1535: .quad 8
+align 8
+v1536: .quad 0
+align 8
+v1537: .quad 18446744073709551614
+align 8
+v1538: .quad 238
+align 8
+v1539: .quad 100
+align 8
+v1574: .quad 32
+align 8
+v1587: .quad 1000
+align 8
+v1592: .quad 1024
+align 8
+v1616: .quad 1000
+align 8
+v1632: .quad 4
+align 8
+v1633: .quad 2000
+align 8
+v1634: .quad 100000
+align 8
+v1635: .quad 256
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+align 8
+.bss
+v272: .zero 1048576
+v273: .zero 8
+v274: .zero 8
+v295: .zero 16
+v437: .zero 16
+v808: .zero 16
+v810: .zero 4
+v815: .zero 16
+v831: .zero 144
+v1004: .zero 192
+v1005: .zero 129
+v1006: .zero 192
+v1007: .zero 192
+v1008: .zero 192
+v1009: .zero 8
+v1010: .zero 8
+v1048: .zero 24
+v1064: .zero 40
+v1085: .zero 24
+v1092: .zero 48
+v1096: .zero 24
+v1190: .zero 24
+v1198: .zero 56
+v1316: .zero 8
+v1323: .zero 8
+v1334: .zero 16
+v1356: .zero 16
+v1362: .zero 24
+v1386: .zero 56
+v1399: .zero 96
+v1466: .zero 8
+v1467: .zero 8
+v1468: .zero 8
+v1636: .zero 8
+v1637: .zero 8
+v1638: .zero 8
+v1639: .zero 8
+v1640: .zero 8
+v1641: .zero 8
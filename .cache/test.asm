@@ -0,0 +1,20132 @@
+bits 64
+section .text
+global _start
+print:
+mov r9, -3689348814741910323
+sub rsp, 40
+mov BYTE [rsp+31], 10
+lea rcx, [rsp+30]
+.L2:
+mov rax, rdi
+lea r8, [rsp+32]
+mul r9
+mov rax, rdi
+sub r8, rcx
+shr rdx, 3
+lea rsi, [rdx+rdx*4]
+add rsi, rsi
+sub rax, rsi
+add eax, 48
+mov BYTE [rcx], al
+mov rax, rdi
+mov rdi, rdx
+mov rdx, rcx
+sub rcx, 1
+cmp rax, 9
+ja .L2
+lea rax, [rsp+32]
+mov edi, 1
+sub rdx, rax
+xor eax, eax
+lea rsi, [rsp+32+rdx]
+mov rdx, r8
+mov rax, 1
+syscall
+add rsp, 40
+ret
+strlen_sse2:
+mov rax, rdi
+and rax, -16
+mov rcx, rdi
+and ecx, 15
+pxor xmm0, xmm0
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+shr edx, cl
+test edx, edx
+jnz .head
+.loop:
+add rax, 16
+movdqa xmm1, [rax]
+pcmpeqb xmm1, xmm0
+pmovmskb edx, xmm1
+test edx, edx
+jz .loop
+bsf edx, edx
+add rax, rdx
+sub rax, rdi
+ret
+.head:
+bsf eax, edx
+ret
+thread_clone:
+mov eax, 56
+syscall
+test rax, rax
+jz .child
+ret
+.child:
+xor ebp, ebp
+pop rax
+pop rdi
+call rax
+mov eax, 60
+xor edi, edi
+syscall
+v12:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, 0
+push rax
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L0
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L1
+L0:
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L1:
+push QWORD [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v13:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+L2:
+mov rax, 0
+push rax
+push QWORD [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L3
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L2
+L3:
+push QWORD [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v14:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+L4:
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+mov rax, 0
+push rax
+push QWORD [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L5
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L4
+L5:
+push QWORD [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v15:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+L6:
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L7
+push QWORD [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-40]
+push QWORD [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L8
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L9
+L8:
+push QWORD [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L10
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L10:
+L9:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L6
+L7:
+push QWORD [rbp-24]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v16:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+L11:
+push QWORD [rbp-40]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L12
+push QWORD [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-64], rax
+push QWORD [rbp-56]
+push QWORD [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L13
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L14
+L13:
+push QWORD [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L15
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L15:
+L14:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L11
+L12:
+push QWORD [rbp-32]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v17:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+L16:
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L17
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L16
+L17:
+add rsp, 32
+pop rbp
+ret
+v18:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-16]
+mov rax, 255
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 72340172838076673
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v17
+push QWORD [rbp-40]
+pop rax
+mov QWORD [rbp-48], rax
+L18:
+push QWORD [rbp-48]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L19
+push QWORD [rbp-8]
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L18
+L19:
+add rsp, 48
+pop rbp
+ret
+v19:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+mov rax, 7
+push rax
+pop rax
+not rax
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+L20:
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L21
+push QWORD [rbp-8]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L20
+L21:
+L22:
+push QWORD [rbp-40]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L23
+push QWORD [rbp-8]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L22
+L23:
+add rsp, 40
+pop rbp
+ret
+v20:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+add rsp, 24
+pop rbp
+ret
+v21:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+L24:
+push QWORD [rbp-40]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L25
+push QWORD [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD [rbp-16]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L26
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L26:
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L24
+L25:
+push QWORD [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v22:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v23:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v24:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+L27:
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L28
+lea rax, [rbp-8]
+push rax
+push QWORD [rbp-8]
+mov rax, 10
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L29
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L29:
+jmp L27
+L28:
+push QWORD [rbp-16]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v25:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-8]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L30
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+push QWORD [rbp-8]
+push QWORD [v354]
+push QWORD [rbp-48]
+pop rax
+pop rbx
+mul rbx
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L30:
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L31:
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L32
+push QWORD [rbp-8]
+push QWORD [v354]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-16]
+push QWORD [rbp-56]
+mov rax, str0
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-8]
+push rax
+push QWORD [rbp-8]
+push QWORD [v354]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L31
+L32:
+add rsp, 56
+pop rbp
+ret
+v27:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+mov rax, 47
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD [rbp-8]
+mov rax, 58
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v28:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+mov rax, 48
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD [rbp-8]
+mov rax, 49
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v29:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+pop rdi
+call v27
+push rax
+push QWORD [rbp-8]
+mov rax, 96
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD [rbp-8]
+mov rax, 103
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD [rbp-8]
+mov rax, 71
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v32:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+mov rax, 64
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD [rbp-8]
+mov rax, 91
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L33
+lea rax, [rbp-8]
+push rax
+mov rax, 32
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L33:
+push QWORD [rbp-8]
+pop rax
+add rsp, 8
+pop rbp
+ret
+v33:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, 10
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+push QWORD [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L34
+mov rax, 2
+push rax
+mov rax, str1
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L35
+lea rax, [rbp-32]
+push rax
+mov rax, 16
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L36:
+push QWORD [rbp-40]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD [rbp-56]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L37
+push QWORD [rbp-8]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+push QWORD [rbp-72]
+pop rdi
+call v27
+push rax
+pop rax
+test rax, rax
+jz L38
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [rbp-72]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L39
+L38:
+push QWORD [rbp-72]
+pop rdi
+call v29
+push rax
+pop rax
+test rax, rax
+jz L40
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 10
+push rax
+push QWORD [rbp-72]
+mov rax, 97
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L41
+L40:
+push QWORD [rbp-72]
+push QWORD [v368]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L42
+lea rax, [rbp-24]
+push rax
+push QWORD [v273]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L42:
+L41:
+L39:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L36
+L37:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L43
+L35:
+mov rax, 2
+push rax
+mov rax, str2
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L44
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L45:
+push QWORD [rbp-40]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD [rbp-64]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L46
+push QWORD [rbp-8]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rdi
+call v32
+push rax
+pop rax
+mov QWORD [rbp-80], rax
+push QWORD [rbp-80]
+pop rdi
+call v28
+push rax
+pop rax
+test rax, rax
+jz L47
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [rbp-80]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L48
+L47:
+push QWORD [rbp-80]
+push QWORD [v368]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L49
+lea rax, [rbp-24]
+push rax
+push QWORD [v273]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L49:
+L48:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L45
+L46:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L44:
+L43:
+L34:
+push QWORD [rbp-48]
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L50
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L51:
+push QWORD [rbp-40]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L52
+push QWORD [rbp-8]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-88], rax
+push QWORD [rbp-88]
+push QWORD [v368]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L53
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [rbp-88]
+mov rax, 48
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L53:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L51
+L52:
+L50:
+push QWORD [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v34:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v33
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v36:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v38:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD [v392]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v39:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L54
+push QWORD [rbp-16]
+push QWORD [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L55
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v36
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L56
+L55:
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L57
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-32]
+push QWORD [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L58
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L59
+L58:
+push QWORD [rbp-48]
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L59:
+L57:
+L56:
+L54:
+push QWORD [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v40:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+pop rax
+test rax, rax
+jz L60
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-24]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L60:
+push QWORD [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v41:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+pop rdi
+call v24
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-16]
+push QWORD [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L61
+push QWORD [rbp-40]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L62
+L61:
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L63
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-40]
+push QWORD [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L64
+push QWORD [rbp-40]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L65
+L64:
+push QWORD [rbp-48]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v25
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L65:
+L63:
+L62:
+push QWORD [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v42:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-16]
+push QWORD [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L66
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD [v413]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L67
+L66:
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L68
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+lea rax, [rbp-32]
+push rax
+push QWORD [v413]
+pop rbx
+pop rax
+mov [rax], rbx
+L68:
+L67:
+push QWORD [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v44:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L69
+push QWORD [v271]
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v272]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L70
+push QWORD [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L71
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v271]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+mov rax, v271
+push rax
+push QWORD [rbp-16]
+push QWORD [v271]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L71:
+jmp L72
+L70:
+L72:
+L69:
+add rsp, 16
+pop rbp
+ret
+v49:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v450]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v50:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v451]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+add rsp, 32
+pop rbp
+ret
+v51:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v452]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v52:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v455]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v54:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v681]
+pop rax
+pop rdi
+syscall
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+add rsp, 16
+pop rbp
+ret
+v59:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+mov [rbp-48], r9
+push QWORD [rbp-48]
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v459]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 48
+pop rbp
+ret
+v60:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov [rbp-40], r8
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v475]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+syscall
+push rax
+pop rax
+add rsp, 40
+pop rbp
+ret
+v61:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v461]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v62:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v460]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v63:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v509]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v64:
+push rbp
+mov rbp, rsp
+push QWORD [v507]
+pop rax
+syscall
+push rax
+pop rax
+pop rbp
+ret
+v65:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v511]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v67:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD [rbp-8]
+mov rax, 127
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v70:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v533]
+pop rax
+pop rdi
+pop rsi
+syscall
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v74:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+push QWORD [v474]
+pop rax
+syscall
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+add rsp, 8
+pop rbp
+ret
+v75:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v654]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+syscall
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v76:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+push QWORD [v9]
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v652]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+pop r10
+pop r8
+pop r9
+syscall
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v77:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop r10
+xor r8d, r8d
+call thread_clone
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v78:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [v906]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+L73:
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L74
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [v906]
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L73
+L74:
+push QWORD [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v80:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-160], rax
+lea rax, [rbp-152]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v52
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L75
+lea rax, [rbp-160]
+push rax
+lea rax, [rbp-152]
+push rax
+push QWORD [v822]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L75:
+push QWORD [rbp-160]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v81:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v906]
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+mov rax, 34
+push rax
+mov rax, 3
+push rax
+push QWORD [rbp-24]
+push QWORD [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L76
+lea rax, [rbp-40]
+push rax
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+L76:
+mov rax, 1
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+L77:
+push QWORD [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L78
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L79
+push QWORD [v9]
+push QWORD [v781]
+push QWORD [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-56]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L80
+push QWORD [rbp-24]
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-40]
+push rax
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L81
+L80:
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L81:
+L79:
+push QWORD [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L82
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v49
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-48]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L83
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L83:
+L82:
+jmp L77
+L78:
+push QWORD [rbp-40]
+pop rax
+test rax, rax
+jz L84
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD [v9]
+mov rax, 0
+push rax
+push QWORD [v905]
+push QWORD [rbp-32]
+push QWORD [v905]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v905]
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+L84:
+push QWORD [rbp-16]
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-40]
+pop rax
+add rsp, 64
+pop rbp
+ret
+v86:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-8]
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-16]
+push QWORD [v273]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L85
+lea rax, [rbp-56]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L85:
+push QWORD [rbp-24]
+pop rax
+mov QWORD [rbp-64], rax
+push QWORD [rbp-32]
+pop rax
+mov QWORD [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-80], rax
+L86:
+push QWORD [rbp-80]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L87
+push QWORD [rbp-48]
+pop rax
+mov QWORD [rbp-88], rax
+push QWORD [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-96], rax
+push QWORD [rbp-96]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L88
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-96]
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L89
+L88:
+push QWORD [rbp-96]
+mov rax, 92
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L90
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD [rbp-96]
+mov rax, 116
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L91
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+mov al, [v239]
+push rax
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L92
+L91:
+push QWORD [rbp-96]
+mov rax, 98
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L93
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+mov al, [v238]
+push rax
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L94
+L93:
+push QWORD [rbp-96]
+mov rax, 110
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L95
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+mov al, [v240]
+push rax
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L96
+L95:
+push QWORD [rbp-96]
+mov rax, 114
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L97
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+mov al, [v243]
+push rax
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L98
+L97:
+push QWORD [rbp-96]
+mov rax, 102
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L99
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+mov al, [v242]
+push rax
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L100
+L99:
+push QWORD [rbp-96]
+mov rax, 39
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L101
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+mov rax, 39
+push rax
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L101:
+L100:
+L98:
+L96:
+L94:
+L92:
+jmp L102
+L90:
+push QWORD [rbp-96]
+mov rax, 37
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L103
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L104
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L105
+L104:
+push QWORD [rbp-96]
+mov rax, 99
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L106
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-72]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L107
+L106:
+push QWORD [rbp-96]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L108
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L109
+L108:
+push QWORD [rbp-96]
+mov rax, 105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L110
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v41
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L111
+L110:
+push QWORD [rbp-96]
+mov rax, 42
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L112
+push QWORD [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-104], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-96]
+push rax
+push QWORD [rbp-64]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD [rbp-96]
+mov rax, 115
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L113
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-104]
+push QWORD [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v39
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L114
+L113:
+L114:
+lea rax, [rbp-72]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L115
+L112:
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-96]
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L115:
+L111:
+L109:
+L107:
+L105:
+jmp L116
+L103:
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-96]
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v42
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L116:
+L102:
+L89:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-88]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-56]
+push QWORD [v9]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L117
+mov rax, 0
+push rax
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+call v38
+push rax
+pop rax
+mov QWORD [rbp-112], rax
+lea rax, [rbp-80]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L117:
+jmp L86
+L87:
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-8]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L118
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L118:
+push QWORD [rbp-40]
+pop rax
+add rsp, 112
+pop rbp
+ret
+v87:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+mov eax, [v275]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v90:
+push rbp
+mov rbp, rsp
+sub rsp, 1056
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov BYTE [rbp-1048], al
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+mov rax, 1024
+push rax
+lea rax, [rbp-1048]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+mov QWORD [rbp-1056], rax
+push QWORD [rbp-1056]
+lea rax, [rbp-1048]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v50
+add rsp, 1056
+pop rbp
+ret
+v92:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v437]
+pop rdi
+pop rsi
+pop rdx
+call v90
+add rsp, 16
+pop rbp
+ret
+v99:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD [rbp-8]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L119
+lea rax, [rbp-16]
+push rax
+mov rax, str3
+push rax
+push QWORD [v438]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, 1
+push rax
+pop rdi
+call v54
+L119:
+add rsp, 16
+pop rbp
+ret
+v102:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 16
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+L120:
+push QWORD [rbp-24]
+push QWORD [v999]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L121
+lea rax, [rbp-8]
+push rax
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1002
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L122
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L122:
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L120
+L121:
+mov rax, str4
+push rax
+push QWORD [rbp-8]
+push QWORD [v997]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L123:
+push QWORD [rbp-24]
+push QWORD [v1000]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L124
+L125:
+mov rax, v1002
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-24]
+push QWORD [v998]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L126
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L125
+L126:
+mov rax, v1003
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L123
+L124:
+mov rax, v1007
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v103:
+push rbp
+mov rbp, rsp
+L127:
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+mov rax, v1008
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L128
+L129:
+mov rax, v1008
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L130
+call v74
+jmp L129
+L130:
+jmp L127
+L128:
+pop rbp
+ret
+v104:
+push rbp
+mov rbp, rsp
+mov rax, v1008
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v105:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, v1003
+push rax
+push QWORD [rbp-8]
+mov rax, 15
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v998]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v106:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+call v103
+push QWORD [v1007]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L131
+call v102
+L131:
+push QWORD [rbp-8]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+mov rax, v1002
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, v1004
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-32]
+pop rax
+test rax, rax
+jz L132
+mov rax, v1004
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L133
+L132:
+mov rax, v1005
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-48]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, v1006
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L134
+mov rax, 3
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD [rbp-64]
+push QWORD [rbp-56]
+push QWORD [v1001]
+push QWORD [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+push QWORD [rbp-72]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L135
+lea rax, [rbp-48]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L136
+L135:
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1006
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-48]
+push QWORD [v1001]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L136:
+L134:
+push QWORD [rbp-48]
+pop rax
+test rax, rax
+jz L137
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1005
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-48]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L137:
+L133:
+call v104
+push QWORD [rbp-40]
+pop rax
+test rax, rax
+jz L138
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+push QWORD [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+call v17
+L138:
+push QWORD [rbp-32]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v107:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+pop rdi
+call v105
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+call v103
+push QWORD [rbp-8]
+mov rax, v1004
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1004
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+call v104
+add rsp, 24
+pop rbp
+ret
+v108:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+pop rax
+test rax, rax
+jz L139
+mov rax, 8
+push rax
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-16]
+push QWORD [v997]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L140
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v61
+jmp L141
+L140:
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v107
+L141:
+L139:
+add rsp, 16
+pop rbp
+ret
+v109:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-16], rax
+mov rax, 8
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-24]
+push QWORD [v997]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L142
+mov rax, 3
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+lea rax, [rbp-16]
+push rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L143
+lea rax, [rbp-16]
+push rax
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+L143:
+jmp L144
+L142:
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-24]
+pop rdi
+call v106
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L144:
+push QWORD [rbp-16]
+pop rax
+test rax, rax
+jz L145
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L145:
+push QWORD [rbp-16]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v110:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 8
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v997]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v997]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L146
+push QWORD [v781]
+pop rax
+mov QWORD [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD [v9]
+push QWORD [rbp-40]
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 8
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+call v60
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-24]
+pop rax
+test rax, rax
+jz L147
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L147:
+jmp L148
+L146:
+mov rax, 8
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-48]
+push QWORD [v997]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD [rbp-56]
+push QWORD [v997]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L149
+push QWORD [rbp-16]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+push QWORD [rbp-48]
+pop rdi
+call v105
+push rax
+push QWORD [rbp-56]
+pop rdi
+call v105
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L150
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+L150:
+L149:
+L148:
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L151
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-16]
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-24]
+pop rax
+test rax, rax
+jz L152
+push QWORD [rbp-32]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L153
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+L153:
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-8]
+pop rdi
+call v108
+L152:
+L151:
+push QWORD [rbp-24]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v111:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L154
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-16]
+pop rdi
+call v109
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L155
+L154:
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v110
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L155:
+push QWORD [rbp-24]
+pop rax
+add rsp, 24
+pop rbp
+ret
+v112:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1044]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 16
+pop rbp
+ret
+v113:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1044]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD [rbp-8]
+push QWORD [v1044]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v114:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L156
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L157
+lea rax, [rbp-24]
+push rax
+push QWORD [v1043]
+pop rbx
+pop rax
+mov [rax], rbx
+L157:
+L158:
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L159
+lea rax, [rbp-24]
+push rax
+mov rax, 2
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L158
+L159:
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+push QWORD [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [rbp-8]
+push QWORD [v1044]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, str5
+push rax
+push QWORD [rbp-32]
+pop rdi
+pop rsi
+call v99
+push QWORD [rbp-8]
+push QWORD [v1044]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+L156:
+add rsp, 32
+pop rbp
+ret
+v115:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1044]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v1046]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v116:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1045]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v117:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 8
+push rax
+push QWORD [rbp-8]
+push QWORD [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v112
+push QWORD [rbp-8]
+push QWORD [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 16
+pop rbp
+ret
+v118:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+L160:
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+push QWORD [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L161
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+call v115
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L160
+L161:
+push QWORD [rbp-16]
+pop rdi
+call v113
+push QWORD [rbp-8]
+push QWORD [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v119:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+push QWORD [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+L162:
+push QWORD [rbp-16]
+push QWORD [rbp-32]
+push QWORD [v1058]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L163
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+call v114
+push QWORD [v1059]
+push QWORD [rbp-8]
+push QWORD [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+mov rax, str6
+push rax
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+call v99
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+call v115
+push rax
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L162
+L163:
+push QWORD [rbp-8]
+push QWORD [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 40
+pop rbp
+ret
+v120:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1060]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v1044]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-24]
+mov rax, 8
+push rax
+push QWORD [rbp-16]
+push QWORD [v1058]
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+push QWORD [rbp-16]
+mov rax, 255
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1062]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 32
+pop rbp
+ret
+v121:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1061]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [v1058]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v122:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 16
+pop rbp
+ret
+v123:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1086]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L164
+lea rax, [rbp-24]
+push rax
+push QWORD [v1079]
+pop rbx
+pop rax
+mov [rax], rbx
+L164:
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+pop rax
+test rax, rax
+jz L165
+push QWORD [rbp-24]
+mov rax, 2
+push rax
+push QWORD [rbp-32]
+push QWORD [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L166
+lea rax, [rbp-24]
+push rax
+mov rax, 2
+push rax
+push QWORD [rbp-32]
+push QWORD [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L166:
+L165:
+L167:
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L168
+lea rax, [rbp-24]
+push rax
+mov rax, 2
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L167
+L168:
+mov rax, 24
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+mov rax, str7
+push rax
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+call v99
+push QWORD [rbp-40]
+push QWORD [v1081]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-40]
+push QWORD [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-40]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+push QWORD [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 40
+pop rbp
+ret
+v124:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+push QWORD [v1081]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-16]
+push QWORD [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-16]
+pop rdi
+call v108
+add rsp, 16
+pop rbp
+ret
+v125:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 24
+pop rbp
+ret
+v126:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, str8
+push rax
+mov rax, 0
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rdi
+pop rsi
+call v99
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-32]
+pop rax
+test rax, rax
+jz L169
+push QWORD [rbp-32]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v125
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+push QWORD [v1082]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rbx
+pop rax
+mov [rax], rbx
+L169:
+push QWORD [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L170
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v123
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L170:
+push QWORD [rbp-32]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-64], rax
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v125
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+push QWORD [rbp-32]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-64]
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-80], rax
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-80]
+push QWORD [rbp-8]
+push QWORD [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L171
+push QWORD [rbp-8]
+push QWORD [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L171:
+push QWORD [rbp-32]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 80
+pop rbp
+ret
+v127:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v1080]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v128:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-16]
+push QWORD [v1092]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-16]
+push QWORD [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-24]
+pop rax
+test rax, rax
+jz L172
+push QWORD [rbp-16]
+push QWORD [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L172:
+push QWORD [rbp-16]
+push QWORD [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v129:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+push QWORD [v1092]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+L173:
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L174
+push QWORD [rbp-8]
+pop rdi
+call v124
+jmp L173
+L174:
+push QWORD [rbp-24]
+pop rax
+test rax, rax
+jz L175
+push QWORD [rbp-24]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+push QWORD [v1093]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L175:
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+push QWORD [v1094]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v130:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-16]
+pop rax
+test rax, rax
+jz L176
+L177:
+push QWORD [rbp-16]
+push QWORD [v1081]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L178
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+push QWORD [v1081]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+pop rdi
+call v124
+push QWORD [rbp-16]
+push QWORD [v1081]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L177
+L178:
+push QWORD [rbp-16]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L176:
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 16
+pop rbp
+ret
+v131:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+L179:
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L180
+push QWORD [rbp-8]
+pop rdi
+call v124
+jmp L179
+L180:
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v132:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-32]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD [rbp-32]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v133:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v132
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v134:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 1
+push rax
+mov rax, 1026
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [v904]
+push QWORD [rbp-32]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v86
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [v904]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-8]
+push QWORD [v1085]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-56]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-56]
+push QWORD [v1083]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-48]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-48]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-32]
+pop rax
+add rsp, 56
+pop rbp
+ret
+v136:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 5381
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+pop rax
+test rax, rax
+jz L181
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+L182:
+push QWORD [rbp-32]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L183
+push QWORD [rbp-8]
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-40]
+push QWORD [rbp-24]
+push QWORD [rbp-24]
+mov rax, 5
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-8]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L182
+L183:
+L181:
+push QWORD [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v139:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD [rbp-8]
+mov rax, 64
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v140:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+push QWORD [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-24]
+mov rax, 31
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD [rbp-24]
+mov rax, 33
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD [v1160]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v141:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+call v140
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD [v1160]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [v1163]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v142:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+pop rax
+mov QWORD [rbp-16], rax
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-16]
+mov rax, 33
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-16]
+mov rax, 29
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+push QWORD [v1162]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-16]
+push QWORD [rbp-16]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v143:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-16]
+mov rax, 32
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L184
+lea rax, [rbp-32]
+push rax
+push QWORD [v1164]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L185
+L184:
+mov rax, 6983438078262162902
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [v1161]
+pop rax
+mov QWORD [rbp-48], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+mov rax, 7046029288634856825
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+L186:
+push QWORD [rbp-24]
+mov rax, 32
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L187
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-72], rax
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-72]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-56]
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+push QWORD [rbp-72]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-64]
+pop rdi
+pop rsi
+call v140
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+mov rax, 32
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L186
+L187:
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+call v139
+push rax
+mov rax, 7
+push rax
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+call v139
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 12
+push rax
+push QWORD [rbp-56]
+pop rdi
+pop rsi
+call v139
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 18
+push rax
+push QWORD [rbp-64]
+pop rdi
+pop rsi
+call v139
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-32]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-56]
+push QWORD [rbp-32]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-64]
+push QWORD [rbp-32]
+pop rdi
+pop rsi
+call v141
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L185:
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L188:
+push QWORD [rbp-24]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L189
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+call v140
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-32]
+mov rax, 27
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD [rbp-32]
+mov rax, 37
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD [v1160]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [v1163]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L188
+L189:
+push QWORD [rbp-24]
+mov rax, 4
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L190
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+push QWORD [v1160]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-32]
+mov rax, 23
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD [rbp-32]
+mov rax, 41
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD [v1161]
+pop rax
+pop rbx
+mul rbx
+push rax
+push QWORD [v1162]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+mov rax, 4
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L190:
+L191:
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L192
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD [v1164]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+xor rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-32]
+mov rax, 11
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD [rbp-32]
+mov rax, 53
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+push QWORD [v1160]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L191
+L192:
+push QWORD [rbp-32]
+pop rdi
+call v142
+push rax
+pop rax
+add rsp, 72
+pop rbp
+ret
+v144:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v143
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v145:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1160]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v142
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v146:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-8]
+push QWORD [v1190]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 24
+push rax
+mov rax, 8
+push rax
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+call v12
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1194]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, v143
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v147:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1190]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v148:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [v265]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L193
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+L194:
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L195
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-24]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L196
+push QWORD [rbp-24]
+push QWORD [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+L196:
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L194
+L195:
+L193:
+push QWORD [rbp-8]
+push QWORD [v1190]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD [rbp-8]
+push QWORD [v1190]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 24
+pop rbp
+ret
+v149:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v150:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-32]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+add rsp, 32
+pop rbp
+ret
+v151:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-8]
+push QWORD [v1195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [v264]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L197
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-16]
+pop rdi
+call v145
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L198
+L197:
+mov rax, v143
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-8]
+push QWORD [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-40]
+pop rax
+pop rdi
+pop rsi
+call rax
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L198:
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L199
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L199:
+push QWORD [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v152:
+push rbp
+mov rbp, rsp
+sub rsp, 104
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD [v289]
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-48]
+pop rax
+test rax, rax
+jz L200
+push QWORD [rbp-8]
+push QWORD [v1195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [v265]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-64], rax
+push QWORD [rbp-16]
+push QWORD [rbp-64]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-72], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-80], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-88], rax
+L201:
+push QWORD [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L202
+push QWORD [rbp-72]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-96], rax
+push QWORD [rbp-96]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-104], rax
+push QWORD [rbp-104]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD [rbp-72]
+push QWORD [rbp-96]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v150
+push rax
+push QWORD [rbp-80]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L203
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L204
+L203:
+push QWORD [rbp-104]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L205
+push QWORD [rbp-56]
+pop rax
+test rax, rax
+jz L206
+push QWORD [rbp-32]
+push QWORD [rbp-96]
+push QWORD [v1188]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L207
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-96]
+push QWORD [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v21
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L208
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L208:
+L207:
+jmp L209
+L206:
+push QWORD [rbp-24]
+push QWORD [rbp-96]
+push QWORD [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L210
+lea rax, [rbp-40]
+push rax
+push QWORD [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L210:
+L209:
+L205:
+L204:
+lea rax, [rbp-72]
+push rax
+push QWORD [rbp-72]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-64]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-80]
+push rax
+push QWORD [rbp-80]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L201
+L202:
+L200:
+push QWORD [rbp-40]
+pop rax
+add rsp, 104
+pop rbp
+ret
+v153:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-8]
+push QWORD [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-16]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+L211:
+push QWORD [rbp-72]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L212
+push QWORD [rbp-56]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-80], rax
+push QWORD [rbp-80]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L213
+push QWORD [rbp-40]
+push QWORD [rbp-16]
+push QWORD [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L214
+L213:
+push QWORD [rbp-56]
+push QWORD [rbp-80]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v150
+push rax
+pop rax
+mov QWORD [rbp-88], rax
+push QWORD [rbp-88]
+push QWORD [rbp-64]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L215
+push QWORD [rbp-40]
+push QWORD [rbp-80]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-40]
+push QWORD [rbp-16]
+push QWORD [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-40]
+push QWORD [rbp-48]
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L216
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L216:
+lea rax, [rbp-64]
+push rax
+push QWORD [rbp-88]
+pop rbx
+pop rax
+mov [rax], rbx
+L215:
+L214:
+push QWORD [rbp-72]
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L217
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L217:
+lea rax, [rbp-56]
+push rax
+push QWORD [rbp-56]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-64]
+push rax
+push QWORD [rbp-64]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L211
+L212:
+push QWORD [rbp-24]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v154:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1190]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, 2
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L218
+lea rax, [rbp-32]
+push rax
+push QWORD [v1185]
+pop rbx
+pop rax
+mov [rax], rbx
+L218:
+push QWORD [rbp-8]
+push QWORD [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-32]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-40]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+mov rax, str9
+push rax
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+call v99
+push QWORD [rbp-8]
+push QWORD [v1190]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+L219:
+push QWORD [rbp-64]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L220
+push QWORD [rbp-16]
+push QWORD [rbp-64]
+push QWORD [rbp-40]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-72], rax
+push QWORD [rbp-72]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L221
+push QWORD [rbp-40]
+push QWORD [rbp-72]
+push QWORD [rbp-56]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-56]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v153
+push rax
+pop rax
+mov QWORD [rbp-80], rax
+L221:
+lea rax, [rbp-64]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-64]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L219
+L220:
+push QWORD [rbp-16]
+pop rdi
+call v108
+add rsp, 80
+pop rbp
+ret
+v155:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v151
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-40]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v152
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-48]
+push QWORD [v289]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L222
+lea rax, [rbp-56]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L223
+L222:
+mov rax, 4
+push rax
+push QWORD [rbp-8]
+push QWORD [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 3
+push rax
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L224
+push QWORD [rbp-8]
+pop rdi
+call v154
+L224:
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+push QWORD [rbp-8]
+push QWORD [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+push QWORD [rbp-64]
+pop rdi
+pop rax
+pop rcx
+rep stosb
+push QWORD [rbp-64]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-64]
+push QWORD [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [v265]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L225
+push QWORD [rbp-24]
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+mov rax, str10
+push rax
+push QWORD [rbp-72]
+pop rdi
+pop rsi
+call v99
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-72]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-64]
+push QWORD [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-72]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-64]
+push QWORD [v1188]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+L225:
+lea rax, [rbp-56]
+push rax
+push QWORD [rbp-64]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v153
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+push QWORD [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L223:
+push QWORD [rbp-56]
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-80], rax
+push QWORD [rbp-32]
+pop rax
+test rax, rax
+jz L226
+push QWORD [rbp-8]
+push QWORD [v1194]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-32]
+push QWORD [rbp-80]
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+L226:
+push QWORD [rbp-80]
+pop rax
+add rsp, 80
+pop rbp
+ret
+v156:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v151
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v152
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-40]
+push QWORD [v289]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L227
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-40]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+mov rax, 24
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L227:
+push QWORD [rbp-32]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v157:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v151
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v152
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+push QWORD [v289]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-40]
+pop rax
+test rax, rax
+jz L228
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-8]
+push QWORD [v1195]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [v265]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L229
+push QWORD [rbp-48]
+push QWORD [v1187]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+L229:
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-8]
+push QWORD [v1193]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-64], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+L230:
+push QWORD [rbp-72]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L231
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-56]
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-80], rax
+push QWORD [rbp-80]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-88], rax
+push QWORD [rbp-88]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD [rbp-80]
+push QWORD [rbp-88]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v150
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L232
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L233
+L232:
+push QWORD [rbp-64]
+push QWORD [rbp-88]
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-80]
+pop rbx
+pop rax
+mov [rax], rbx
+L233:
+jmp L230
+L231:
+push QWORD [rbp-8]
+push QWORD [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1192]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L228:
+push QWORD [rbp-40]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v158:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v155
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v159:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v156
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v160:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v157
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v161:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v155
+push rax
+pop rax
+add rsp, 32
+pop rbp
+ret
+v162:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v156
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v163:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v157
+push rax
+pop rax
+add rsp, 24
+pop rbp
+ret
+v164:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+push QWORD [v1191]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-16]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+L234:
+push QWORD [rbp-40]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L235
+push QWORD [rbp-40]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v147
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-48]
+push QWORD [v1186]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L236
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+L236:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L234
+L235:
+push QWORD [rbp-16]
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-24]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v165:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+L237:
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L238
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L237
+L238:
+push QWORD [rbp-24]
+pop rax
+add rsp, 32
+pop rbp
+ret
+v166:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v9]
+push QWORD [rbp-16]
+mov rax, 4294967295
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 128
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v167:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v9]
+push QWORD [rbp-16]
+mov rax, 129
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v168:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1314]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v169:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+push QWORD [rbp-8]
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L239
+push QWORD [rbp-16]
+mov rax, 2
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L240
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v165
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L240:
+L241:
+push QWORD [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L242
+mov rax, 2
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v166
+lea rax, [rbp-16]
+push rax
+mov rax, 2
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v165
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L241
+L242:
+L239:
+add rsp, 16
+pop rbp
+ret
+v171:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, 18446744073709551615
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L243
+push QWORD [rbp-8]
+push QWORD [v1314]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v167
+L243:
+add rsp, 8
+pop rbp
+ret
+v172:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1321]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 8
+pop rbp
+ret
+v173:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1321]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-16]
+pop rdi
+call v171
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v166
+L244:
+mov rax, 2
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+call v165
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L245
+mov rax, 2
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+call v166
+jmp L244
+L245:
+add rsp, 24
+pop rbp
+ret
+v174:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v167
+add rsp, 16
+pop rbp
+ret
+v175:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [v1301]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v167
+add rsp, 16
+pop rbp
+ret
+v176:
+push rbp
+mov rbp, rsp
+sub rsp, 88
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 8392704
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+mov rax, 3
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+mov rax, 131106
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD [rbp-56]
+push QWORD [rbp-48]
+push QWORD [rbp-40]
+push QWORD [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+push QWORD [rbp-64]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L246
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L247
+L246:
+push QWORD [v768]
+push QWORD [v905]
+push QWORD [rbp-64]
+pop rdi
+pop rsi
+pop rdx
+call v62
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+push QWORD [rbp-64]
+push QWORD [rbp-40]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-80], rax
+push QWORD [rbp-80]
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-80]
+mov rax, 8
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1331]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1332]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1331]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1331]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-80]
+push QWORD [v1300]
+pop rdi
+pop rsi
+pop rdx
+pop r10
+xor r8d, r8d
+call thread_clone
+push rax
+pop rax
+mov QWORD [rbp-88], rax
+push QWORD [rbp-88]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L248
+push QWORD [rbp-40]
+push QWORD [rbp-64]
+pop rdi
+pop rsi
+call v61
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L248:
+L247:
+push QWORD [rbp-32]
+pop rax
+add rsp, 88
+pop rbp
+ret
+v177:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1331]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+L249:
+push QWORD [rbp-16]
+pop rax
+test rax, rax
+jz L250
+push QWORD [v9]
+push QWORD [rbp-16]
+push QWORD [v792]
+push QWORD [rbp-8]
+push QWORD [v1331]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v76
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-8]
+push QWORD [v1331]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L249
+L250:
+mov rax, 8392704
+push rax
+push QWORD [rbp-8]
+push QWORD [v1332]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+call v61
+add rsp, 24
+pop rbp
+ret
+v178:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov rax, 0
+push rax
+pop rax
+mov BYTE [rbp-128], al
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-136], rax
+lea rax, [rbp-128]
+push rax
+mov rax, 128
+push rax
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v75
+push rax
+pop rax
+mov QWORD [rbp-144], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-152], rax
+L251:
+push QWORD [rbp-144]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+push QWORD [rbp-152]
+push QWORD [rbp-144]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L252
+lea rax, [rbp-128]
+push rax
+push QWORD [rbp-152]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-160], rax
+L253:
+push QWORD [rbp-160]
+pop rax
+test rax, rax
+jz L254
+lea rax, [rbp-136]
+push rax
+push QWORD [rbp-136]
+push QWORD [rbp-160]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-160]
+push rax
+push QWORD [rbp-160]
+mov rax, 1
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L253
+L254:
+lea rax, [rbp-152]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-152]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L251
+L252:
+push QWORD [rbp-136]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L255
+lea rax, [rbp-136]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L255:
+push QWORD [rbp-136]
+pop rax
+add rsp, 160
+pop rbp
+ret
+v179:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+add rsp, 16
+pop rbp
+ret
+v180:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 16
+push rax
+push QWORD [rbp-16]
+mov rax, 4095
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v181:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-8]
+push QWORD [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-40]
+push QWORD [rbp-8]
+push QWORD [v1358]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD [v1302]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L256
+push QWORD [rbp-40]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v180
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-48]
+push QWORD [v1353]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-48]
+push QWORD [v1354]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L256:
+push QWORD [rbp-32]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v182:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+push QWORD [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+push QWORD [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v165
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-8]
+push QWORD [v1358]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-48]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+cmp rax, 0
+sete al
+movzx rax, al
+push rax
+pop rax
+test rax, rax
+jz L257
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v180
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-48]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L258
+push QWORD [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-48]
+push QWORD [rbp-8]
+push QWORD [v1358]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+push QWORD [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L259
+lea rax, [rbp-24]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L259:
+push QWORD [rbp-8]
+push QWORD [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L258:
+jmp L260
+L257:
+push QWORD [rbp-8]
+push QWORD [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L260:
+push QWORD [rbp-24]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v183:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+push QWORD [v1358]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-8]
+push QWORD [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-32]
+push QWORD [rbp-40]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L261
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v180
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+push QWORD [rbp-8]
+push QWORD [v1358]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L262
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L262:
+L261:
+push QWORD [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v184:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1386]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-16]
+mov rax, 56
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 16
+pop rbp
+ret
+v186:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+push QWORD [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-8]
+push QWORD [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L263
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD [rbp-8]
+push QWORD [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v174
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L263:
+add rsp, 16
+pop rbp
+ret
+v187:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD [rbp-8]
+push QWORD [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-8]
+push QWORD [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-8]
+push QWORD [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-8]
+push QWORD [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-48]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L264
+mov rax, 2
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+mov rax, str11
+push rax
+push QWORD [rbp-64]
+pop rdi
+pop rsi
+call v99
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+L265:
+push QWORD [rbp-72]
+push QWORD [rbp-48]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L266
+push QWORD [rbp-56]
+push QWORD [rbp-40]
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-64]
+push QWORD [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L265
+L266:
+push QWORD [rbp-56]
+pop rdi
+call v108
+lea rax, [rbp-56]
+push rax
+push QWORD [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-32]
+push rax
+mov rax, 2
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-56]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+L264:
+push QWORD [rbp-56]
+push QWORD [rbp-40]
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-80], rax
+push QWORD [rbp-80]
+push QWORD [v1353]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-80]
+push QWORD [v1354]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-48]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+add rsp, 80
+pop rbp
+ret
+v188:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+push QWORD [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L267
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD [rbp-8]
+push QWORD [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+pop rax
+test rax, rax
+jz L268
+push QWORD [rbp-8]
+push QWORD [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-8]
+push QWORD [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-40]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+push QWORD [rbp-8]
+push QWORD [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L268:
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L267:
+push QWORD [rbp-24]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v189:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1381]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v182
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L269
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+call v188
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L269:
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L270
+push QWORD [rbp-24]
+push QWORD [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-8]
+push QWORD [v1382]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+mov rax, 1
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+L271:
+push QWORD [rbp-56]
+push QWORD [rbp-40]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L272
+push QWORD [rbp-48]
+push QWORD [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-40]
+xor rdx, rdx
+pop rbx
+pop rax
+div rbx
+push rdx
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-16]
+push QWORD [rbp-64]
+push QWORD [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v183
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-56]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L271
+L272:
+L270:
+push QWORD [rbp-32]
+pop rax
+test rax, rax
+jz L273
+mov rax, 18446744073709551615
+push rax
+push QWORD [rbp-24]
+push QWORD [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-72], rax
+L273:
+push QWORD [rbp-32]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v190:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-8]
+push QWORD [v1381]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, v179
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-16]
+push QWORD [v1353]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-16]
+push QWORD [v1354]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-8]
+push QWORD [rbp-32]
+pop rax
+pop rdi
+pop rsi
+call rax
+mov rax, 18446744073709551615
+push rax
+push QWORD [rbp-24]
+push QWORD [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L274
+push QWORD [rbp-24]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD [rbp-24]
+push QWORD [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v175
+push QWORD [rbp-24]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L274:
+add rsp, 32
+pop rbp
+ret
+v191:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [v1381]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+L275:
+push QWORD [rbp-16]
+push QWORD [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L276
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v189
+push rax
+pop rax
+test rax, rax
+jz L277
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v190
+jmp L278
+L277:
+push QWORD [rbp-16]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+mov rax, 1
+push rax
+push QWORD [rbp-16]
+push QWORD [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+L279:
+push QWORD [rbp-16]
+push QWORD [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD [rbp-16]
+push QWORD [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L280
+push QWORD [rbp-16]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+push QWORD [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v173
+jmp L279
+L280:
+mov rax, 18446744073709551615
+push rax
+push QWORD [rbp-16]
+push QWORD [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-16]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L278:
+jmp L275
+L276:
+add rsp, 48
+pop rbp
+ret
+v192:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-16]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L281
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L281:
+push QWORD [rbp-16]
+mov rax, 56
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 1024
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+mov rax, str12
+push rax
+push QWORD [rbp-32]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD [rbp-40]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v99
+push QWORD [rbp-8]
+push QWORD [v1386]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-32]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v168
+push QWORD [rbp-8]
+push QWORD [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v172
+push QWORD [rbp-8]
+push QWORD [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1391]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1392]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1393]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v1303]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+L282:
+push QWORD [rbp-48]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L283
+push QWORD [rbp-48]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+mov rax, 65536
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+mov rax, str13
+push rax
+push QWORD [rbp-64]
+pop rdi
+pop rsi
+call v99
+push QWORD [rbp-56]
+push QWORD [v1381]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-56]
+push QWORD [v1382]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-56]
+push QWORD [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v1358]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-56]
+push QWORD [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v1359]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-56]
+push QWORD [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-64]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L282
+L283:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L284:
+push QWORD [rbp-48]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+push QWORD [rbp-24]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L285
+push QWORD [rbp-48]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+push QWORD [rbp-72]
+mov rax, v191
+push rax
+push QWORD [rbp-72]
+push QWORD [v1383]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v176
+push rax
+pop rax
+test rax, rax
+jz L286
+push QWORD [rbp-8]
+push QWORD [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-48]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L287
+L286:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L287:
+jmp L284
+L285:
+L288:
+push QWORD [rbp-48]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L289
+push QWORD [rbp-48]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+push QWORD [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L288
+L289:
+push QWORD [rbp-24]
+pop rax
+add rsp, 72
+pop rbp
+ret
+v193:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+push QWORD [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v187
+push QWORD [rbp-8]
+pop rdi
+call v186
+add rsp, 32
+pop rbp
+ret
+v194:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+push QWORD [rbp-8]
+push QWORD [v1381]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+mov rax, 1
+push rax
+push QWORD [rbp-32]
+push QWORD [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v181
+push rax
+pop rax
+test rax, rax
+jz L290
+push QWORD [rbp-32]
+pop rdi
+call v186
+jmp L291
+L290:
+lea rax, [rbp-56]
+push rax
+push QWORD [v1353]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-16]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD [v1354]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-24]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-56]
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v190
+L291:
+add rsp, 56
+pop rbp
+ret
+v195:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+L292:
+push QWORD [rbp-8]
+push QWORD [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+test rax, rax
+jz L293
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+call v189
+push rax
+pop rax
+test rax, rax
+jz L294
+lea rax, [rbp-32]
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+call v190
+jmp L295
+L294:
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+mov rax, 1
+push rax
+push QWORD [rbp-8]
+push QWORD [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+L296:
+push QWORD [rbp-8]
+push QWORD [v1394]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+push QWORD [rbp-8]
+push QWORD [v1395]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+test rax, rax
+jz L297
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-8]
+push QWORD [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+call v173
+jmp L296
+L297:
+mov rax, 18446744073709551615
+push rax
+push QWORD [rbp-8]
+push QWORD [v1396]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+L295:
+jmp L292
+L293:
+add rsp, 48
+pop rbp
+ret
+v196:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+pop rdi
+call v195
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v169
+push QWORD [rbp-8]
+push QWORD [v1397]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1389]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v175
+push QWORD [rbp-8]
+push QWORD [v1388]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v171
+push QWORD [rbp-8]
+push QWORD [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+L298:
+push QWORD [rbp-24]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L299
+push QWORD [rbp-24]
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+call v184
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-24]
+pop rax
+test rax, rax
+jz L300
+push QWORD [rbp-32]
+push QWORD [v1383]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v177
+L300:
+push QWORD [rbp-32]
+push QWORD [v1384]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v1360]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L298
+L299:
+push QWORD [rbp-8]
+push QWORD [v1386]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD [rbp-8]
+push QWORD [v1390]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+call v108
+push QWORD [rbp-8]
+push QWORD [v1386]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [v9]
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [v1387]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+add rsp, 32
+pop rbp
+ret
+v197:
+push rbp
+mov rbp, rsp
+mov rax, v1465
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1466
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1467
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+pop rbp
+ret
+v198:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, v1465
+push rax
+mov rax, 1
+push rax
+push QWORD [v1465]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L301
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+pop rax
+mov QWORD [rbp-32], rax
+pop rax
+mov QWORD [rbp-40], rax
+pop rax
+mov QWORD [rbp-48], rax
+lea rax, [rbp-48]
+push rax
+mov rax, str14
+push rax
+push QWORD [v438]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, v1467
+push rax
+mov rax, 1
+push rax
+push QWORD [v1467]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L302
+L301:
+mov rax, v1466
+push rax
+mov rax, 1
+push rax
+push QWORD [v1466]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L302:
+add rsp, 48
+pop rbp
+ret
+v199:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov rax, v1465
+push rax
+mov rax, 1
+push rax
+push QWORD [v1465]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L303
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+pop rax
+mov QWORD [rbp-32], rax
+pop rax
+mov QWORD [rbp-40], rax
+pop rax
+mov QWORD [rbp-48], rax
+lea rax, [rbp-48]
+push rax
+mov rax, str15
+push rax
+push QWORD [v438]
+pop rdi
+pop rsi
+pop rdx
+call v90
+mov rax, v1467
+push rax
+mov rax, 1
+push rax
+push QWORD [v1467]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L304
+L303:
+mov rax, v1466
+push rax
+mov rax, 1
+push rax
+push QWORD [v1466]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L304:
+add rsp, 48
+pop rbp
+ret
+v200:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, str16
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+push QWORD [rbp-8]
+mov rax, 5
+push rax
+mov rax, 5
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+mov rax, 2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 6
+push rax
+mov rax, 6
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4
+push rax
+mov rax, 4
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 1
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 8
+pop rbp
+ret
+v201:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov rax, str17
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+mov rax, 0
+push rax
+pop rax
+mov DWORD [rbp-24], eax
+push QWORD [v9]
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4
+push rax
+mov rax, 4
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4
+push rax
+mov rax, 4
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 16
+push rax
+mov rax, 16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 16
+push rax
+mov rax, 16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 16
+push rax
+mov rax, 16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 48
+pop rbp
+ret
+v202:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [v273]
+push QWORD [rbp-16]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+not rax
+push rax
+push QWORD [rbp-16]
+pop rcx
+pop rax
+shl rax, cl
+push rax
+pop rax
+add rsp, 16
+pop rbp
+ret
+v203:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, str18
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+mov rax, 2
+push rax
+pop rdi
+call v202
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 12
+push rax
+mov rax, 4
+push rax
+pop rdi
+call v202
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 240
+push rax
+mov rax, 8
+push rax
+pop rdi
+call v202
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 131072
+push rax
+mov rax, 131072
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+mov rax, 8
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 1
+push rax
+pop rax
+not rax
+push rax
+pop rax
+not rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 3
+push rax
+mov rax, 18446744073709551612
+push rax
+pop rax
+not rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 5
+push rax
+mov rax, 5
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 3
+push rax
+mov rax, 3
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 8
+pop rbp
+ret
+v204:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+mov rax, 7
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v205:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [rbp-8]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+add rsp, 8
+pop rbp
+ret
+v206:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+push QWORD [rbp-8]
+push QWORD [rbp-8]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+add rsp, 8
+pop rbp
+ret
+v207:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-8]
+mov rax, 3
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L305
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-8]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L306
+L305:
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+call v207
+push rax
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+call v207
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L306:
+push QWORD [rbp-16]
+pop rax
+add rsp, 16
+pop rbp
+ret
+v208:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, str19
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+push QWORD [rbp-8]
+mov rax, 10
+push rax
+mov rax, 3
+push rax
+pop rdi
+call v204
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 9
+push rax
+mov rax, 3
+push rax
+pop rdi
+call v205
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 6
+push rax
+mov rax, 3
+push rax
+pop rdi
+call v206
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 43
+push rax
+mov rax, 3
+push rax
+pop rdi
+call v206
+push rax
+pop rdi
+call v205
+push rax
+pop rdi
+call v204
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 233
+push rax
+mov rax, 12
+push rax
+pop rdi
+call v207
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 8
+pop rbp
+ret
+v209:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+mov rax, str20
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+push QWORD [rbp-8]
+mov rax, 20
+push rax
+mov rax, 20
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [v1498]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+push QWORD [v1499]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [v1495]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+push QWORD [v1496]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 20
+push rax
+mov rax, 20
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 20
+push rax
+mov rax, 20
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 20
+push rax
+mov rax, 20
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 40
+push rax
+mov rax, 40
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 40
+push rax
+mov rax, 40
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 12
+push rax
+mov rax, 12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 12
+push rax
+mov rax, 12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 12
+push rax
+mov rax, 12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 24
+push rax
+mov rax, 24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 24
+push rax
+mov rax, 24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 112
+pop rbp
+ret
+v210:
+push rbp
+mov rbp, rsp
+sub rsp, 936
+mov rax, str21
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-264], rax
+push QWORD [rbp-8]
+mov rax, 256
+push rax
+mov rax, 256
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov DWORD [rbp-392], eax
+push QWORD [rbp-8]
+mov rax, 128
+push rax
+mov rax, 128
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov WORD [rbp-456], ax
+push QWORD [rbp-8]
+mov rax, 64
+push rax
+mov rax, 64
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov BYTE [rbp-488], al
+push QWORD [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 384
+push rax
+mov rax, 384
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-904], rax
+push QWORD [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1
+push rax
+mov rax, 2
+push rax
+mov rax, 3
+push rax
+mov rax, 4
+push rax
+pop rax
+mov QWORD [rbp-912], rax
+pop rax
+mov QWORD [rbp-920], rax
+pop rax
+mov QWORD [rbp-928], rax
+pop rax
+mov QWORD [rbp-936], rax
+push QWORD [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 936
+pop rbp
+ret
+v211:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, str22
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [v1522]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4
+push rax
+push QWORD [v1523]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+push QWORD [v1524]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4
+push rax
+push QWORD [v1525]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4
+push rax
+push QWORD [v1526]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4
+push rax
+push QWORD [v1527]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 128
+push rax
+push QWORD [v1528]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+push QWORD [v1529]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [v1530]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+push QWORD [v1531]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+push QWORD [v1532]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [v1533]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+push QWORD [v1534]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [v1535]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 18446744073709551614
+push rax
+push QWORD [v1536]
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 8
+pop rbp
+ret
+v212:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [v1537]
+push QWORD [rbp-8]
+pop rdi
+pop rax
+mov rcx, 256
+rep stosb
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+L307:
+push QWORD [rbp-24]
+mov rax, 256
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L308
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], bl
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L307
+L308:
+add rsp, 24
+pop rbp
+ret
+v213:
+push rbp
+mov rbp, rsp
+sub rsp, 40
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD [v1537]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD [v1537]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-32]
+push QWORD [rbp-16]
+push QWORD [rbp-8]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v21
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L309
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L309:
+push QWORD [rbp-40]
+pop rax
+add rsp, 40
+pop rbp
+ret
+v214:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+mov [rbp-24], rdx
+mov [rbp-32], rcx
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD [v1537]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD [v1537]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-40], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+L310:
+push QWORD [rbp-48]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L311
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L312
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L312:
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L310
+L311:
+push QWORD [rbp-40]
+pop rax
+add rsp, 48
+pop rbp
+ret
+v215:
+push rbp
+mov rbp, rsp
+sub rsp, 592
+mov rax, str23
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 0
+push rax
+pop rax
+mov BYTE [rbp-264], al
+mov rax, 0
+push rax
+pop rax
+mov BYTE [rbp-520], al
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+mov al, [rsi+0]
+mov [rdi+0], al
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 1
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+mov eax, [rsi+0]
+mov [rdi+0], eax
+mov ax, [rsi+4]
+mov [rdi+4], ax
+mov al, [rsi+6]
+mov [rdi+6], al
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 7
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+mov rax, [rsi+0]
+mov [rdi+0], rax
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 8
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+mov rax, [rsi+16]
+mov [rdi+16], rax
+mov eax, [rsi+24]
+mov [rdi+24], eax
+mov ax, [rsi+28]
+mov [rdi+28], ax
+mov al, [rsi+30]
+mov [rdi+30], al
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 31
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+movdqu xmm0, [rsi+0]
+movdqu [rdi+0], xmm0
+movdqu xmm0, [rsi+16]
+movdqu [rdi+16], xmm0
+movdqu xmm0, [rsi+32]
+movdqu [rdi+32], xmm0
+movdqu xmm0, [rsi+48]
+movdqu [rdi+48], xmm0
+movdqu xmm0, [rsi+64]
+movdqu [rdi+64], xmm0
+movdqu xmm0, [rsi+80]
+movdqu [rdi+80], xmm0
+mov eax, [rsi+96]
+mov [rdi+96], eax
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+push QWORD [v1538]
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+mov rcx, 200
+rep movsb
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 200
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 45
+push rax
+pop rax
+mov QWORD [rbp-528], rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+push QWORD [rbp-528]
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rcx
+rep movsb
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+push QWORD [rbp-528]
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 321
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+mov [rdi+0], al
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 65
+push rax
+mov rax, 1
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 120
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+movzx eax, al
+mov rdx, 72340172838076673
+imul rax, rdx
+movq xmm0, rax
+punpcklqdq xmm0, xmm0
+movdqu [rdi+0], xmm0
+mov [rdi+16], eax
+mov [rdi+20], ax
+mov [rdi+22], al
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 120
+push rax
+mov rax, 23
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 0
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+movzx eax, al
+mov rdx, 72340172838076673
+imul rax, rdx
+movq xmm0, rax
+punpcklqdq xmm0, xmm0
+movdqu [rdi+0], xmm0
+movdqu [rdi+16], xmm0
+movdqu [rdi+32], xmm0
+movdqu [rdi+48], xmm0
+movdqu [rdi+64], xmm0
+movdqu [rdi+80], xmm0
+mov [rdi+96], eax
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 0
+push rax
+push QWORD [v1538]
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 121
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+mov rcx, 180
+rep stosb
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 121
+push rax
+mov rax, 180
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 77
+push rax
+pop rax
+mov QWORD [rbp-536], rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+push QWORD [rbp-536]
+mov rax, 122
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rax
+pop rcx
+rep stosb
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 122
+push rax
+push QWORD [rbp-536]
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, v19
+push rax
+pop rax
+mov QWORD [rbp-544], rax
+mov rax, v18
+push rax
+pop rax
+mov QWORD [rbp-552], rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 37
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 3
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-544]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+call rax
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 37
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v213
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+call v212
+mov rax, 29
+push rax
+mov rax, 119
+push rax
+lea rax, [rbp-520]
+push rax
+mov rax, 5
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-552]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+call rax
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 119
+push rax
+mov rax, 29
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v214
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 97
+push rax
+lea rax, [rbp-520]
+push rax
+pop rdi
+pop rax
+mov rcx, 256
+rep stosb
+lea rax, [rbp-520]
+push rax
+mov rax, 40
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-560], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-568], rax
+L313:
+push QWORD [rbp-560]
+mov rax, 40
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L314
+lea rax, [rbp-520]
+push rax
+push QWORD [rbp-560]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call strlen_sse2
+push rax
+mov rax, 40
+push rax
+push QWORD [rbp-560]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L315
+lea rax, [rbp-568]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-568]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L315:
+lea rax, [rbp-560]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-560]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L313
+L314:
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-568]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, str24
+push rax
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 3
+push rax
+pop rax
+mov QWORD [rbp-576], rax
+mov rax, 34
+push rax
+pop rax
+mov QWORD [rbp-584], rax
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+push QWORD [rbp-584]
+push QWORD [rbp-576]
+mov rax, 4096
+push rax
+push QWORD [v9]
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+pop r8
+pop r9
+call v59
+push rax
+pop rax
+mov QWORD [rbp-592], rax
+mov rax, 97
+push rax
+push QWORD [rbp-592]
+pop rdi
+pop rax
+mov rcx, 4095
+rep stosb
+push QWORD [rbp-592]
+mov rax, 4095
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], bl
+push QWORD [rbp-8]
+mov rax, 5
+push rax
+push QWORD [rbp-592]
+mov rax, 4090
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-592]
+mov rax, 4095
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 4096
+push rax
+push QWORD [rbp-592]
+pop rdi
+pop rsi
+call v61
+add rsp, 592
+pop rbp
+ret
+v216:
+push rbp
+mov rbp, rsp
+sub rsp, 96
+mov rax, str25
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+push QWORD [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+mov rax, 2
+push rax
+pop rdi
+pop rsi
+call v12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+mov rax, 16
+push rax
+pop rdi
+pop rsi
+call v12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 64
+push rax
+mov rax, 32
+push rax
+mov rax, 33
+push rax
+pop rdi
+pop rsi
+call v12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+mov rax, 32
+push rax
+pop rdi
+pop rsi
+call v12
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 13
+push rax
+mov rax, str26
+push rax
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 10
+push rax
+mov rax, str27
+push rax
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, str28
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-8]
+mov rax, 13
+push rax
+push QWORD [rbp-16]
+pop rdi
+call strlen_sse2
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 10
+push rax
+mov rax, 10
+push rax
+mov rax, str29
+push rax
+pop rdi
+pop rsi
+call v14
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 3
+push rax
+mov rax, 10
+push rax
+mov rax, str30
+push rax
+pop rdi
+pop rsi
+call v14
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, str31
+push rax
+mov rax, str32
+push rax
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, str33
+push rax
+mov rax, str34
+push rax
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, str35
+push rax
+mov rax, str36
+push rax
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, str37
+push rax
+mov rax, str38
+push rax
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 3
+push rax
+mov rax, str39
+push rax
+mov rax, str40
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 100
+push rax
+mov rax, str41
+push rax
+mov rax, str42
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 3
+push rax
+mov rax, str43
+push rax
+mov rax, str44
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 100
+push rax
+mov rax, str45
+push rax
+mov rax, str46
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v16
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+mov rax, str47
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, str48
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-32]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v20
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, str49
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+mov rax, str50
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-40]
+pop rdi
+call strlen_sse2
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+pop rdx
+call v20
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+mov rax, 0
+push rax
+pop rax
+mov BYTE [rbp-80], al
+mov rax, 97
+push rax
+lea rax, [rbp-80]
+push rax
+pop rdi
+pop rax
+movzx eax, al
+mov rdx, 72340172838076673
+imul rax, rdx
+movq xmm0, rax
+punpcklqdq xmm0, xmm0
+movdqu [rdi+0], xmm0
+movdqu [rdi+16], xmm0
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-88], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-96], rax
+L316:
+push QWORD [rbp-88]
+push QWORD [v1573]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L317
+lea rax, [rbp-80]
+push rax
+push QWORD [rbp-88]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov bl, [rax]
+push rbx
+mov rax, 97
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L318
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L318:
+lea rax, [rbp-88]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-88]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L316
+L317:
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 7
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+mov rax, 77
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 3
+push rax
+mov rax, 777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4
+push rax
+mov rax, 7777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 5
+push rax
+mov rax, 77777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 6
+push rax
+mov rax, 777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 7
+push rax
+mov rax, 7777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+mov rax, 77777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 9
+push rax
+mov rax, 777777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 10
+push rax
+mov rax, 7777777777
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 11
+push rax
+mov rax, 81209347389
+push rax
+pop rdi
+call v24
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 7
+push rax
+mov rax, str51
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 77
+push rax
+mov rax, str52
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 777
+push rax
+mov rax, str53
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 7777
+push rax
+mov rax, str54
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 77777
+push rax
+mov rax, str55
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 777777
+push rax
+mov rax, str56
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 7777777
+push rax
+mov rax, str57
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 77777777
+push rax
+mov rax, str58
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 777777777
+push rax
+mov rax, str59
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 7777777777
+push rax
+mov rax, str60
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 81209347389
+push rax
+mov rax, str61
+push rax
+pop rdi
+call v34
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+add rsp, 96
+pop rbp
+ret
+v217:
+push rbp
+mov rbp, rsp
+sub rsp, 72
+mov rax, str62
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 24
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-16]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-16]
+mov rax, 42
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-16]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 42
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-16]
+pop rdi
+call v108
+mov rax, 20
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-8]
+push QWORD [rbp-16]
+push QWORD [rbp-24]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-24]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-24]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 20
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-24]
+pop rdi
+call v108
+push QWORD [rbp-32]
+pop rdi
+call v108
+mov rax, 100
+push rax
+pop rdi
+call v109
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-40]
+mov rax, 7
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 104
+push rax
+push QWORD [rbp-40]
+pop rdi
+pop rsi
+call v110
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+push QWORD [rbp-8]
+push QWORD [rbp-40]
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1000
+push rax
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+call v110
+push rax
+pop rax
+mov QWORD [rbp-56], rax
+push QWORD [rbp-8]
+mov rax, 7
+push rax
+push QWORD [rbp-56]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-56]
+mov rax, 992
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 100000
+push rax
+push QWORD [rbp-56]
+pop rdi
+pop rsi
+call v111
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+push QWORD [rbp-8]
+mov rax, 7
+push rax
+push QWORD [rbp-64]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-64]
+mov rax, 99992
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 8
+push rax
+push QWORD [rbp-64]
+pop rdi
+pop rsi
+call v110
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+push QWORD [rbp-8]
+mov rax, 7
+push rax
+push QWORD [rbp-72]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-72]
+pop rdi
+call v108
+add rsp, 72
+pop rbp
+ret
+v218:
+push rbp
+mov rbp, rsp
+sub rsp, 104
+mov rax, str63
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 8
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v112
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v116
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v114
+push QWORD [rbp-8]
+push QWORD [v1043]
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v116
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+L319:
+push QWORD [rbp-40]
+push QWORD [v1586]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L320
+push QWORD [rbp-40]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v114
+push QWORD [rbp-40]
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v115
+push rax
+push QWORD [rbp-40]
+mov rax, 3
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L319
+L320:
+push QWORD [rbp-8]
+mov rax, 1024
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v116
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+lea rax, [rbp-40]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L321:
+push QWORD [rbp-40]
+push QWORD [v1586]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L322
+push QWORD [rbp-40]
+lea rax, [rbp-32]
+push rax
+pop rdi
+pop rsi
+call v115
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-40]
+mov rax, 3
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L323
+lea rax, [rbp-48]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-48]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L323:
+lea rax, [rbp-40]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L321
+L322:
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-48]
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v113
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-32]
+push rax
+pop rdi
+call v116
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 8
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v117
+mov rax, 1
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v119
+mov rax, 0
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v120
+push rax
+pop rax
+mov QWORD [rbp-96], rax
+push QWORD [rbp-96]
+mov rax, 42
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [v1591]
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v119
+push QWORD [rbp-8]
+push QWORD [v1591]
+lea rax, [rbp-88]
+push rax
+pop rdi
+call v121
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1
+push rax
+pop rax
+mov QWORD [rbp-104], rax
+L324:
+push QWORD [rbp-104]
+push QWORD [v1591]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L325
+push QWORD [rbp-104]
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v120
+push rax
+push QWORD [rbp-104]
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-104]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-104]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L324
+L325:
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v120
+push rax
+push QWORD [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 42
+push rax
+push QWORD [rbp-96]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1023
+push rax
+mov rax, 1023
+push rax
+lea rax, [rbp-88]
+push rax
+pop rdi
+pop rsi
+call v120
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-88]
+push rax
+pop rdi
+call v118
+add rsp, 104
+pop rbp
+ret
+v219:
+push rbp
+mov rbp, rsp
+sub rsp, 296
+mov rax, str64
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 256
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+call v122
+mov rax, 1
+push rax
+mov rax, 3
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+mov QWORD [rbp-64], rax
+mov rax, 8
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-72]
+mov rax, 7
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+push QWORD [v1080]
+push QWORD [rbp-72]
+push QWORD [rbp-64]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 64
+push rax
+mov rax, 1
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v126
+push rax
+pop rax
+mov QWORD [rbp-80], rax
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-80]
+mov rax, 63
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 1000
+push rax
+lea rax, [rbp-56]
+push rax
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD [rbp-88], rax
+mov rax, 1
+push rax
+push QWORD [rbp-88]
+pop rdi
+pop rax
+mov rcx, 1000
+rep stosb
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 1256
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-56]
+push rax
+pop rdi
+call v131
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-56]
+push rax
+push QWORD [v1090]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 128
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v122
+mov rax, str65
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v133
+push rax
+pop rax
+mov QWORD [rbp-144], rax
+lea rax, [rbp-168]
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v128
+lea rax, [rbp-136]
+push rax
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-176], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-184], rax
+L326:
+push QWORD [rbp-184]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L327
+mov rax, 64
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD [rbp-192], rax
+lea rax, [rbp-184]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-184]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L326
+L327:
+lea rax, [rbp-136]
+push rax
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rax
+mov QWORD [rbp-200], rax
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+push QWORD [rbp-200]
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-168]
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v129
+push QWORD [rbp-8]
+push QWORD [rbp-176]
+lea rax, [rbp-136]
+push rax
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-136]
+push rax
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-136]
+push rax
+push QWORD [v1089]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 6400
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, str66
+push rax
+push QWORD [rbp-144]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, str67
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v133
+push rax
+pop rax
+mov QWORD [rbp-208], rax
+push QWORD [rbp-8]
+push QWORD [rbp-144]
+mov rax, 6
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+push QWORD [rbp-208]
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-184]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L328:
+push QWORD [rbp-184]
+mov rax, 100
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L329
+mov rax, 64
+push rax
+lea rax, [rbp-136]
+push rax
+pop rdi
+pop rsi
+call v127
+push rax
+pop rax
+mov QWORD [rbp-216], rax
+lea rax, [rbp-184]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-184]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L328
+L329:
+lea rax, [rbp-136]
+push rax
+pop rdi
+call v130
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+lea rax, [rbp-136]
+push rax
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-136]
+push rax
+push QWORD [v1087]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-136]
+push rax
+pop rdi
+call v131
+mov rax, 0
+push rax
+lea rax, [rbp-264]
+push rax
+pop rdi
+pop rsi
+call v122
+mov rax, 42
+push rax
+mov rax, str68
+push rax
+pop rax
+mov QWORD [rbp-272], rax
+pop rax
+mov QWORD [rbp-280], rax
+lea rax, [rbp-280]
+push rax
+mov rax, str69
+push rax
+lea rax, [rbp-264]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v134
+push rax
+pop rax
+mov QWORD [rbp-288], rax
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, str70
+push rax
+push QWORD [rbp-288]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+lea rax, [rbp-264]
+push rax
+push QWORD [v1088]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+mov rax, 16
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 2
+push rax
+mov rax, str71
+push rax
+lea rax, [rbp-264]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v132
+push rax
+pop rax
+mov QWORD [rbp-296], rax
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, str72
+push rax
+push QWORD [rbp-296]
+pop rdi
+pop rsi
+call v15
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-264]
+push rax
+pop rdi
+call v131
+add rsp, 296
+pop rbp
+ret
+v220:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov rax, str73
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+push QWORD [rbp-8]
+mov rax, 17241709254077376921
+push rax
+mov rax, 0
+push rax
+mov rax, str74
+push rax
+pop rdi
+pop rsi
+call v143
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 15154266338359012955
+push rax
+mov rax, str75
+push rax
+pop rdi
+call v144
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 4952883123889572249
+push rax
+mov rax, str76
+push rax
+pop rdi
+call v144
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 18144624926692707313
+push rax
+mov rax, str77
+push rax
+pop rdi
+call v144
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 12914696790927413826
+push rax
+mov rax, str78
+push rax
+pop rdi
+call v144
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, str79
+push rax
+pop rdi
+call v144
+push rax
+mov rax, 3
+push rax
+mov rax, str80
+push rax
+pop rdi
+pop rsi
+call v143
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+pop rdi
+call v145
+push rax
+mov rax, 1
+push rax
+pop rdi
+call v145
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+add rsp, 8
+pop rbp
+ret
+v221:
+push rbp
+mov rbp, rsp
+sub rsp, 240
+mov rax, str81
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 8
+push rax
+push QWORD [v264]
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v146
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 1
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-72], rax
+L330:
+push QWORD [rbp-72]
+push QWORD [v1615]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L331
+push QWORD [rbp-72]
+push QWORD [rbp-72]
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+mov QWORD [rbp-80], rax
+lea rax, [rbp-80]
+push rax
+push QWORD [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v158
+push rax
+pop rax
+mov QWORD [rbp-88], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L330
+L331:
+push QWORD [rbp-8]
+push QWORD [v1615]
+lea rax, [rbp-64]
+push rax
+pop rdi
+call v149
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-96], rax
+lea rax, [rbp-72]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L332:
+push QWORD [rbp-72]
+push QWORD [v1615]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L333
+push QWORD [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+pop rax
+mov QWORD [rbp-104], rax
+push QWORD [rbp-104]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L334
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L335
+L334:
+push QWORD [rbp-104]
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+push QWORD [rbp-72]
+push QWORD [rbp-72]
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L336
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L336:
+L335:
+push QWORD [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+mov rax, 1
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+pop rax
+test rax, rax
+jz L337
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L337:
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L332
+L333:
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 7
+push rax
+pop rax
+mov QWORD [rbp-112], rax
+lea rax, [rbp-112]
+push rax
+mov rax, 32
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v158
+push rax
+mov rax, 8
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+mov rax, 8
+push rax
+mov rax, 32
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+push QWORD [v1615]
+lea rax, [rbp-64]
+push rax
+pop rdi
+call v149
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-96]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L338:
+push QWORD [rbp-72]
+push QWORD [v1615]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L339
+push QWORD [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v160
+push rax
+mov rax, 1
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L340
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L340:
+lea rax, [rbp-72]
+push rax
+mov rax, 2
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L338
+L339:
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 0
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v160
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 500
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+call v149
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-96]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-72]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L341:
+push QWORD [rbp-72]
+push QWORD [v1615]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L342
+push QWORD [rbp-72]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v159
+push rax
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovne rcx, rdx
+push rcx
+pop rax
+mov QWORD [rbp-120], rax
+push QWORD [rbp-120]
+mov rax, 0
+push rax
+push QWORD [rbp-72]
+mov rax, 1
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L343
+lea rax, [rbp-96]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-96]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+L343:
+lea rax, [rbp-72]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-72]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L341
+L342:
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-96]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-128], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-136], rax
+lea rax, [rbp-128]
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v164
+push rax
+pop rax
+mov QWORD [rbp-144], rax
+L344:
+push QWORD [rbp-144]
+pop rax
+test rax, rax
+jz L345
+lea rax, [rbp-136]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-136]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-144]
+push rax
+lea rax, [rbp-128]
+push rax
+lea rax, [rbp-64]
+push rax
+pop rdi
+pop rsi
+call v164
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L344
+L345:
+push QWORD [rbp-8]
+mov rax, 500
+push rax
+push QWORD [rbp-136]
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-64]
+push rax
+pop rdi
+call v148
+mov rax, 4
+push rax
+push QWORD [v265]
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v146
+mov rax, 0
+push rax
+pop rax
+mov BYTE [rbp-216], al
+mov rax, str82
+push rax
+lea rax, [rbp-216]
+push rax
+pop rdi
+pop rsi
+mov eax, [rsi+0]
+mov [rdi+0], eax
+mov al, [rsi+4]
+mov [rdi+4], al
+mov rax, 1
+push rax
+pop rax
+mov DWORD [rbp-224], eax
+lea rax, [rbp-224]
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-216]
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v161
+push rax
+pop rax
+mov QWORD [rbp-232], rax
+mov rax, str83
+push rax
+lea rax, [rbp-216]
+push rax
+pop rdi
+pop rsi
+mov eax, [rsi+0]
+mov [rdi+0], eax
+mov al, [rsi+4]
+mov [rdi+4], al
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 5
+push rax
+lea rax, [rbp-216]
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 5
+push rax
+mov rax, str84
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 4
+push rax
+mov rax, str85
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [v9]
+mov rax, 3
+push rax
+mov rax, str86
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v161
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], ebx
+push QWORD [v9]
+mov rax, 0
+push rax
+mov rax, str87
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v161
+push rax
+mov rax, 3
+push rax
+pop rbx
+pop rax
+mov [rax], ebx
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+mov rax, 3
+push rax
+mov rax, str88
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 3
+push rax
+mov rax, 0
+push rax
+mov rax, str89
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rax
+xor rbx, rbx
+mov ebx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 1
+push rax
+mov rax, 5
+push rax
+mov rax, str90
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v163
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, 5
+push rax
+mov rax, str91
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+call v149
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-200]
+push rax
+pop rdi
+call v148
+mov rax, 0
+push rax
+push QWORD [v265]
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v146
+lea rax, [rbp-200]
+push rax
+push QWORD [v1196]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, v136
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [v9]
+mov rax, 4
+push rax
+mov rax, str92
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+pop rcx
+call v161
+push rax
+pop rax
+mov QWORD [rbp-240], rax
+push QWORD [rbp-8]
+push QWORD [rbp-240]
+mov rax, 4
+push rax
+mov rax, str93
+push rax
+lea rax, [rbp-200]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v162
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-200]
+push rax
+pop rdi
+call v148
+add rsp, 240
+pop rbp
+ret
+v222:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+L346:
+push QWORD [rbp-16]
+push QWORD [v1632]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L347
+mov rax, 1
+push rax
+mov rax, v1635
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, v1637
+push rax
+pop rdi
+call v169
+mov rax, v1636
+push rax
+mov rax, 1
+push rax
+push QWORD [v1636]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1637
+push rax
+pop rdi
+call v171
+lea rax, [rbp-16]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-16]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L346
+L347:
+add rsp, 24
+pop rbp
+ret
+v223:
+push rbp
+mov rbp, rsp
+sub rsp, 8
+mov [rbp-8], rdi
+mov rax, v1637
+push rax
+pop rdi
+call v169
+L348:
+push QWORD [v1639]
+mov rax, 0
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmove rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L349
+mov rax, v1637
+push rax
+mov rax, v1638
+push rax
+pop rdi
+pop rsi
+call v173
+jmp L348
+L349:
+mov rax, v1639
+push rax
+mov rax, 2
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1637
+push rax
+pop rdi
+call v171
+add rsp, 8
+pop rbp
+ret
+v224:
+push rbp
+mov rbp, rsp
+sub rsp, 56
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shr rax, cl
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+push QWORD [rbp-16]
+mov rax, 4294967295
+push rax
+pop rax
+pop rbx
+and rbx, rax
+push rbx
+pop rax
+mov QWORD [rbp-32], rax
+L350:
+push QWORD [rbp-32]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+sub rbx, rax
+push rbx
+push QWORD [v1634]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovg rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L351
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+mov rax, 2
+push rax
+xor rdx, rdx
+pop r8
+pop rax
+div r8
+push rax
+pop rax
+mov QWORD [rbp-40], rax
+push QWORD [rbp-24]
+mov rax, 32
+push rax
+pop rcx
+pop rax
+shl rax, cl
+push rax
+push QWORD [rbp-40]
+pop rax
+pop rbx
+or rbx, rax
+push rbx
+mov rax, v224
+push rax
+push QWORD [rbp-8]
+pop rdi
+pop rsi
+pop rdx
+call v194
+lea rax, [rbp-24]
+push rax
+push QWORD [rbp-40]
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L350
+L351:
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-48], rax
+L352:
+push QWORD [rbp-24]
+push QWORD [rbp-32]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L353
+lea rax, [rbp-48]
+push rax
+push QWORD [rbp-48]
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-24]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L352
+L353:
+push QWORD [rbp-48]
+mov rax, v1640
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-56], rax
+add rsp, 56
+pop rbp
+ret
+v225:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+mov [rbp-8], rdi
+mov [rbp-16], rsi
+push QWORD [rbp-16]
+mov rax, v1640
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rax
+mov QWORD [rbp-24], rax
+add rsp, 24
+pop rbp
+ret
+v226:
+push rbp
+mov rbp, rsp
+sub rsp, 232
+mov rax, str94
+push rax
+pop rax
+mov QWORD [rbp-8], rax
+mov rax, 40
+push rax
+pop rax
+mov QWORD [rbp-16], rax
+push QWORD [rbp-8]
+mov rax, 40
+push rax
+mov rax, 2
+push rax
+lea rax, [rbp-16]
+push rax
+pop rax
+pop rbx
+lock xadd [rax], rbx
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 42
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 42
+push rax
+mov rax, 7
+push rax
+mov rax, 41
+push rax
+lea rax, [rbp-16]
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 42
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 42
+push rax
+mov rax, 7
+push rax
+mov rax, 42
+push rax
+lea rax, [rbp-16]
+push rax
+pop rdx
+pop rax
+pop rbx
+lock cmpxchg [rdx], rbx
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 7
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 7
+push rax
+mov rax, 9
+push rax
+lea rax, [rbp-16]
+push rax
+pop rdi
+pop rsi
+call v165
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 9
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, v22
+push rax
+pop rax
+mov QWORD [rbp-24], rax
+mov rax, v23
+push rax
+pop rax
+mov QWORD [rbp-32], rax
+push QWORD [rbp-8]
+mov rax, 9
+push rax
+mov rax, 1
+push rax
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-24]
+pop rax
+pop rdi
+pop rsi
+call rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 10
+push rax
+mov rax, 3
+push rax
+mov rax, 10
+push rax
+lea rax, [rbp-16]
+push rax
+push QWORD [rbp-32]
+pop rax
+pop rdi
+pop rsi
+pop rdx
+call rax
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 3
+push rax
+push QWORD [rbp-16]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, v1637
+push rax
+pop rdi
+call v168
+mov rax, v1635
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1636
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-104], rax
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-112], rax
+L354:
+push QWORD [rbp-112]
+push QWORD [v1631]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L355
+lea rax, [rbp-104]
+push rax
+push QWORD [rbp-104]
+push QWORD [v9]
+mov rax, v222
+push rax
+lea rax, [rbp-96]
+push rax
+push QWORD [rbp-112]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v176
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+lea rax, [rbp-112]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-112]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L354
+L355:
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [rbp-104]
+pop rdi
+pop rsi
+pop rdx
+call v198
+lea rax, [rbp-112]
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+L356:
+push QWORD [rbp-112]
+push QWORD [v1631]
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L357
+lea rax, [rbp-96]
+push rax
+push QWORD [rbp-112]
+mov rax, 16
+push rax
+pop rax
+pop rbx
+mul rbx
+push rax
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rdi
+call v177
+lea rax, [rbp-112]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-112]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L356
+L357:
+push QWORD [rbp-8]
+mov rax, 8000
+push rax
+push QWORD [v1635]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 8000
+push rax
+push QWORD [v1636]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+mov rax, v1637
+push rax
+pop rax
+xor rbx, rbx
+mov rbx, [rax]
+push rbx
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, v1638
+push rax
+pop rdi
+call v172
+mov rax, v1639
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [v9]
+mov rax, v223
+push rax
+lea rax, [rbp-128]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v176
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, v1637
+push rax
+pop rdi
+call v169
+mov rax, v1639
+push rax
+mov rax, 1
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, v1638
+push rax
+pop rdi
+call v174
+mov rax, v1637
+push rax
+pop rdi
+call v171
+lea rax, [rbp-128]
+push rax
+pop rdi
+call v177
+push QWORD [rbp-8]
+mov rax, 2
+push rax
+push QWORD [v1639]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+push QWORD [v1631]
+lea rax, [rbp-224]
+push rax
+pop rdi
+pop rsi
+call v192
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, v1640
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+push QWORD [v1633]
+mov rax, v224
+push rax
+lea rax, [rbp-224]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v193
+lea rax, [rbp-224]
+push rax
+pop rdi
+call v195
+push QWORD [rbp-8]
+mov rax, 4999950000
+push rax
+push QWORD [v1640]
+pop rdi
+pop rsi
+pop rdx
+call v198
+mov rax, v1640
+push rax
+mov rax, 0
+push rax
+pop rbx
+pop rax
+mov [rax], rbx
+mov rax, 0
+push rax
+pop rax
+mov QWORD [rbp-232], rax
+L358:
+push QWORD [rbp-232]
+mov rax, 1000
+push rax
+mov rcx, 0
+mov rdx, 1
+pop rax
+pop rbx
+cmp rbx, rax
+cmovl rcx, rdx
+push rcx
+pop rax
+test rax, rax
+jz L359
+push QWORD [rbp-232]
+mov rax, v225
+push rax
+lea rax, [rbp-224]
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v193
+lea rax, [rbp-232]
+push rax
+mov rax, 1
+push rax
+push QWORD [rbp-232]
+pop rax
+pop rbx
+add rbx, rax
+push rbx
+pop rbx
+pop rax
+mov [rax], rbx
+jmp L358
+L359:
+lea rax, [rbp-224]
+push rax
+pop rdi
+call v196
+push QWORD [rbp-8]
+mov rax, 499500
+push rax
+push QWORD [v1640]
+pop rdi
+pop rsi
+pop rdx
+call v198
+push QWORD [rbp-8]
+mov rax, 0
+push rax
+call v178
+push rax
+pop rdi
+pop rsi
+pop rdx
+call v199
+add rsp, 232
+pop rbp
+ret
+v227:
+push rbp
+mov rbp, rsp
+push QWORD [v9]
+mov rax, str95
+push rax
+pop rdi
+pop rsi
+call v92
+call v200
+call v201
+call v203
+call v208
+call v209
+call v210
+call v211
+call v215
+call v216
+call v217
+call v218
+call v219
+call v220
+call v221
+call v226
+pop rbp
+ret
+v228:
+push rbp
+mov rbp, rsp
+sub rsp, 24
+push QWORD [v1466]
+push QWORD [v1467]
+push QWORD [v1465]
+pop rax
+mov QWORD [rbp-8], rax
+pop rax
+mov QWORD [rbp-16], rax
+pop rax
+mov QWORD [rbp-24], rax
+lea rax, [rbp-24]
+push rax
+mov rax, str96
+push rax
+pop rdi
+pop rsi
+call v92
+add rsp, 24
+pop rbp
+ret
+main:
+push rbp
+mov rbp, rsp
+call v197
+call v227
+call v228
+pop rbp
+ret
+
+_start:
+mov rdi, [rsp] ; argc
+mov rcx, rsp
+mov rax, rsp
+add rax, 8
+mov rsi, rax ; argv
+; store offset to envp
+mov rax, [rcx]
+add rax, 2
+shl rax, 3
+mov rdx, rcx
+add rdx, rax ; envp
+call main
+mov rax, 231 ; exit_group syscall, ends every thread
+mov rdi, 0 ; return code
+syscall
+ret
+section .data
+str0: db 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 97, 98, 99, 100, 101, 102, 0
+str1: db 48, 120, 0
+str2: db 48, 98, 0
+str3: db 91, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 93, 58, 32, 37, 115, 0
+str4: db 109, 101, 109, 111, 114, 121, 95, 105, 110, 105, 116, 58, 32, 115, 105, 122, 101, 32, 99, 108, 97, 115, 115, 101, 115, 32, 100, 111, 32, 110, 111, 116, 32, 101, 110, 100, 32, 97, 116, 32, 77, 69, 77, 79, 82, 89, 95, 83, 77, 65, 76, 76, 95, 77, 65, 88, 10, 0
+str5: db 118, 101, 99, 116, 111, 114, 95, 114, 101, 115, 101, 114, 118, 101, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str6: db 115, 116, 97, 98, 108, 101, 95, 118, 101, 99, 116, 111, 114, 95, 114, 101, 115, 101, 114, 118, 101, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str7: db 97, 114, 101, 110, 97, 95, 99, 104, 117, 110, 107, 95, 112, 117, 115, 104, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str8: db 97, 114, 101, 110, 97, 95, 97, 108, 108, 111, 99, 95, 97, 108, 105, 103, 110, 101, 100, 58, 32, 97, 108, 105, 103, 110, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 112, 111, 119, 101, 114, 32, 111, 102, 32, 116, 119, 111, 10, 0
+str9: db 104, 97, 115, 104, 109, 97, 112, 95, 103, 114, 111, 119, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str10: db 104, 97, 115, 104, 109, 97, 112, 95, 105, 110, 115, 101, 114, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str11: db 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 115, 117, 98, 109, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str12: db 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 105, 110, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str13: db 116, 104, 114, 101, 97, 100, 95, 112, 111, 111, 108, 95, 105, 110, 105, 116, 58, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 10, 0
+str14: db 97, 115, 115, 101, 114, 116, 95, 101, 113, 117, 97, 108, 32, 40, 37, 100, 32, 33, 61, 32, 37, 100, 41, 58, 32, 37, 115, 10, 0
+str15: db 97, 115, 115, 101, 114, 116, 95, 110, 111, 116, 95, 101, 113, 117, 97, 108, 32, 102, 97, 105, 108, 101, 100, 32, 40, 37, 100, 32, 61, 61, 32, 37, 100, 41, 58, 32, 37, 115, 10, 0
+str16: db 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 97, 114, 105, 116, 104, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 97, 114, 105, 116, 104, 40, 41, 0
+str17: db 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 115, 116, 114, 117, 99, 116, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 115, 116, 114, 117, 99, 116, 40, 41, 0
+str18: db 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 98, 105, 116, 119, 105, 115, 101, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 98, 105, 116, 119, 105, 115, 101, 40, 41, 0
+str19: db 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 102, 117, 110, 99, 116, 105, 111, 110, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 0
+str20: db 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 115, 116, 114, 117, 99, 116, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 115, 116, 114, 117, 99, 116, 40, 41, 0
+str21: db 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 97, 114, 114, 97, 121, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 97, 114, 114, 97, 121, 40, 41, 0
+str22: db 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 99, 111, 110, 115, 116, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 99, 111, 110, 115, 116, 40, 41, 0
+str23: db 116, 101, 115, 116, 115, 47, 99, 111, 114, 101, 47, 105, 110, 116, 114, 105, 110, 115, 105, 99, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 105, 110, 116, 114, 105, 110, 115, 105, 99, 40, 41, 0
+str24: db 0
+str25: db 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 99, 111, 109, 109, 111, 110, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 99, 111, 109, 109, 111, 110, 40, 41, 0
+str26: db 104, 101, 108, 108, 111, 44, 32, 119, 111, 114, 108, 100, 33, 0
+str27: db 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0
+str28: db 104, 101, 108, 108, 111, 44, 32, 119, 111, 114, 108, 100, 33, 0
+str29: db 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 0
+str30: db 97, 97, 97, 0
+str31: db 104, 101, 108, 108, 111, 0
+str32: db 104, 101, 108, 108, 111, 0
+str33: db 104, 101, 108, 108, 111, 0
+str34: db 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str35: db 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str36: db 104, 101, 108, 108, 111, 0
+str37: db 0
+str38: db 104, 101, 108, 108, 111, 0
+str39: db 104, 101, 108, 108, 111, 0
+str40: db 104, 101, 108, 108, 111, 0
+str41: db 104, 101, 108, 108, 111, 0
+str42: db 104, 101, 108, 108, 111, 0
+str43: db 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str44: db 104, 101, 108, 108, 111, 0
+str45: db 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str46: db 104, 101, 108, 108, 111, 0
+str47: db 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str48: db 72, 69, 76, 76, 79, 0
+str49: db 72, 69, 76, 76, 79, 0
+str50: db 104, 101, 108, 108, 111, 32, 116, 104, 101, 114, 101, 0
+str51: db 55, 0
+str52: db 55, 55, 0
+str53: db 55, 55, 55, 0
+str54: db 55, 55, 55, 55, 0
+str55: db 55, 55, 55, 55, 55, 0
+str56: db 55, 55, 55, 55, 55, 55, 0
+str57: db 55, 55, 55, 55, 55, 55, 55, 0
+str58: db 55, 55, 55, 55, 55, 55, 55, 55, 0
+str59: db 55, 55, 55, 55, 55, 55, 55, 55, 55, 0
+str60: db 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 0
+str61: db 56, 49, 50, 48, 57, 51, 52, 55, 51, 56, 57, 0
+str62: db 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 109, 101, 109, 111, 114, 121, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 109, 101, 109, 111, 114, 121, 40, 41, 0
+str63: db 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 118, 101, 99, 116, 111, 114, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 118, 101, 99, 116, 111, 114, 40, 41, 0
+str64: db 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 97, 114, 101, 110, 97, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 97, 114, 101, 110, 97, 40, 41, 0
+str65: db 102, 105, 114, 115, 116, 0
+str66: db 102, 105, 114, 115, 116, 0
+str67: db 115, 101, 99, 111, 110, 100, 0
+str68: db 115, 116, 114, 0
+str69: db 37, 100, 32, 37, 115, 0
+str70: db 52, 50, 32, 115, 116, 114, 0
+str71: db 97, 98, 99, 0
+str72: db 97, 98, 0
+str73: db 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 104, 97, 115, 104, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 104, 97, 115, 104, 40, 41, 0
+str74: db 0
+str75: db 97, 0
+str76: db 97, 98, 99, 0
+str77: db 78, 111, 98, 111, 100, 121, 32, 105, 110, 115, 112, 101, 99, 116, 115, 32, 116, 104, 101, 32, 115, 112, 97, 109, 109, 105, 115, 104, 32, 114, 101, 112, 101, 116, 105, 116, 105, 111, 110, 0
+str78: db 104, 101, 108, 108, 111, 44, 32, 119, 111, 114, 108, 100, 0
+str79: db 97, 98, 99, 0
+str80: db 97, 98, 99, 100, 101, 102, 0
+str81: db 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 104, 97, 115, 104, 109, 97, 112, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 104, 97, 115, 104, 109, 97, 112, 40, 41, 0
+str82: db 97, 108, 112, 104, 97, 0
+str83: db 111, 109, 101, 103, 97, 0
+str84: db 97, 108, 112, 104, 97, 0
+str85: db 97, 108, 112, 104, 97, 0
+str86: db 97, 108, 112, 0
+str87: db 0
+str88: db 97, 108, 112, 0
+str89: db 0
+str90: db 97, 108, 112, 104, 97, 0
+str91: db 97, 108, 112, 104, 97, 0
+str92: db 98, 101, 116, 97, 0
+str93: db 98, 101, 116, 97, 0
+str94: db 116, 101, 115, 116, 115, 47, 108, 105, 98, 47, 116, 104, 114, 101, 97, 100, 46, 115, 112, 108, 58, 116, 101, 115, 116, 95, 108, 105, 98, 95, 116, 104, 114, 101, 97, 100, 40, 41, 0
+str95: db 114, 117, 110, 110, 105, 110, 103, 32, 116, 101, 115, 116, 115, 46, 46, 46, 10, 0
+str96: db 116, 101, 115, 116, 115, 32, 99, 111, 109, 112, 108, 101, 116, 101, 58, 32, 37, 100, 32, 112, 97, 115, 115, 101, 100, 44, 32, 37, 100, 32, 102, 97, 105, 108, 101, 100, 44, 32, 37, 100, 32, 116, 111, 116, 97, 108, 10, 0, 0, 0
+v7: dq 9057184610999237435
+v8: dq 0
+v9: dq 0
+v230: db 0, 0, 0, 0, 0, 0, 0, 0
+v231: db 1, 0, 0, 0, 0, 0, 0, 0
+v232: db 2, 0, 0, 0, 0, 0, 0, 0
+v233: db 3, 0, 0, 0, 0, 0, 0, 0
+v234: db 4, 0, 0, 0, 0, 0, 0, 0
+v235: db 5, 0, 0, 0, 0, 0, 0, 0
+v236: db 6, 0, 0, 0, 0, 0, 0, 0
+v237: db 7, 0, 0, 0, 0, 0, 0, 0
+v238: db 8, 0, 0, 0, 0, 0, 0, 0
+v239: db 9, 0, 0, 0, 0, 0, 0, 0
+v240: db 10, 0, 0, 0, 0, 0, 0, 0
+v241: db 11, 0, 0, 0, 0, 0, 0, 0
+v242: db 12, 0, 0, 0, 0, 0, 0, 0
+v243: db 13, 0, 0, 0, 0, 0, 0, 0
+v244: db 14, 0, 0, 0, 0, 0, 0, 0
+v245: db 15, 0, 0, 0, 0, 0, 0, 0
+v246: db 16, 0, 0, 0, 0, 0, 0, 0
+v247: db 17, 0, 0, 0, 0, 0, 0, 0
+v248: db 18, 0, 0, 0, 0, 0, 0, 0
+v249: db 19, 0, 0, 0, 0, 0, 0, 0
+v250: db 20, 0, 0, 0, 0, 0, 0, 0
+v251: db 21, 0, 0, 0, 0, 0, 0, 0
+v252: db 22, 0, 0, 0, 0, 0, 0, 0
+v253: db 23, 0, 0, 0, 0, 0, 0, 0
+v254: db 24, 0, 0, 0, 0, 0, 0, 0
+v255: db 25, 0, 0, 0, 0, 0, 0, 0
+v256: db 26, 0, 0, 0, 0, 0, 0, 0
+v257: db 27, 0, 0, 0, 0, 0, 0, 0
+v258: db 28, 0, 0, 0, 0, 0, 0, 0
+v259: db 29, 0, 0, 0, 0, 0, 0, 0
+v260: db 30, 0, 0, 0, 0, 0, 0, 0
+v261: db 31, 0, 0, 0, 0, 0, 0, 0
+v262: dq 0
+v263: dq 1
+v264: dq 0
+v265: dq 1
+v266: dq 18446744073709551614
+v267: dq 0
+v268: dq 1
+v269: dq 1048576
+v273: dq 18446744073709551615
+v274: dq 9223372036854775807
+v275: dd 4294967295, 0
+v276: dd 2147483647, 0
+v277: dw 65535, 0, 0, 0
+v278: dw 32767, 0, 0, 0
+v279: db 255, 0, 0, 0, 0, 0, 0, 0
+v280: db 127, 0, 0, 0, 0, 0, 0, 0
+v281: dq 18446744073709551615
+v282: dq 9223372036854775807
+v283: dd 4294967295, 0
+v284: dd 2147483647, 0
+v285: dw 65535, 0, 0, 0
+v286: dw 32767, 0, 0, 0
+v287: db 255, 0, 0, 0, 0, 0, 0, 0
+v288: db 127, 0, 0, 0, 0, 0, 0, 0
+v289: dq 18446744073709551615
+v290: dq 512
+v291: dq 0
+v292: dq 8
+v348: dq 10
+v354: dq 10
+v361: dq 20
+v368: dq 95
+v392: dq 1
+v413: dq 1
+v419: dq 32
+v433: dq 0
+v434: dq 8
+v436: dq 0
+v437: dq 1
+v438: dq 2
+v439: dq 0
+v440: dq 1
+v441: dq 2
+v442: dq 3
+v443: dq 4
+v444: dq 5
+v445: dq 6
+v446: dq 7
+v447: dq 8
+v448: dq 9
+v449: dq 11
+v450: dq 0
+v451: dq 1
+v452: dq 2
+v453: dq 3
+v454: dq 4
+v455: dq 5
+v456: dq 6
+v457: dq 7
+v458: dq 8
+v459: dq 9
+v460: dq 10
+v461: dq 11
+v462: dq 12
+v463: dq 13
+v464: dq 14
+v465: dq 15
+v466: dq 16
+v467: dq 17
+v468: dq 18
+v469: dq 19
+v470: dq 20
+v471: dq 21
+v472: dq 22
+v473: dq 23
+v474: dq 24
+v475: dq 25
+v476: dq 26
+v477: dq 27
+v478: dq 28
+v479: dq 29
+v480: dq 30
+v481: dq 31
+v482: dq 32
+v483: dq 33
+v484: dq 34
+v485: dq 35
+v486: dq 36
+v487: dq 37
+v488: dq 38
+v489: dq 39
+v490: dq 40
+v491: dq 41
+v492: dq 42
+v493: dq 43
+v494: dq 44
+v495: dq 45
+v496: dq 46
+v497: dq 47
+v498: dq 48
+v499: dq 49
+v500: dq 50
+v501: dq 51
+v502: dq 52
+v503: dq 53
+v504: dq 54
+v505: dq 55
+v506: dq 56
+v507: dq 57
+v508: dq 58
+v509: dq 59
+v510: dq 60
+v511: dq 61
+v512: dq 62
+v513: dq 63
+v514: dq 64
+v515: dq 65
+v516: dq 66
+v517: dq 67
+v518: dq 68
+v519: dq 69
+v520: dq 70
+v521: dq 71
+v522: dq 72
+v523: dq 73
+v524: dq 74
+v525: dq 75
+v526: dq 76
+v527: dq 77
+v528: dq 78
+v529: dq 79
+v530: dq 80
+v531: dq 81
+v532: dq 82
+v533: dq 83
+v534: dq 84
+v535: dq 85
+v536: dq 86
+v537: dq 87
+v538: dq 88
+v539: dq 89
+v540: dq 90
+v541: dq 91
+v542: dq 92
+v543: dq 93
+v544: dq 94
+v545: dq 95
+v546: dq 96
+v547: dq 97
+v548: dq 98
+v549: dq 99
+v550: dq 100
+v551: dq 101
+v552: dq 102
+v553: dq 103
+v554: dq 104
+v555: dq 105
+v556: dq 106
+v557: dq 107
+v558: dq 108
+v559: dq 109
+v560: dq 110
+v561: dq 111
+v562: dq 112
+v563: dq 113
+v564: dq 114
+v565: dq 115
+v566: dq 116
+v567: dq 117
+v568: dq 118
+v569: dq 119
+v570: dq 120
+v571: dq 121
+v572: dq 122
+v573: dq 123
+v574: dq 124
+v575: dq 125
+v576: dq 126
+v577: dq 127
+v578: dq 128
+v579: dq 129
+v580: dq 130
+v581: dq 131
+v582: dq 132
+v583: dq 133
+v584: dq 134
+v585: dq 135
+v586: dq 136
+v587: dq 137
+v588: dq 138
+v589: dq 139
+v590: dq 140
+v591: dq 141
+v592: dq 142
+v593: dq 143
+v594: dq 144
+v595: dq 145
+v596: dq 146
+v597: dq 147
+v598: dq 148
+v599: dq 149
+v600: dq 150
+v601: dq 151
+v602: dq 152
+v603: dq 153
+v604: dq 154
+v605: dq 155
+v606: dq 156
+v607: dq 157
+v608: dq 158
+v609: dq 159
+v610: dq 160
+v611: dq 161
+v612: dq 162
+v613: dq 163
+v614: dq 164
+v615: dq 165
+v616: dq 166
+v617: dq 167
+v618: dq 168
+v619: dq 169
+v620: dq 170
+v621: dq 171
+v622: dq 172
+v623: dq 173
+v624: dq 174
+v625: dq 175
+v626: dq 176
+v627: dq 177
+v628: dq 178
+v629: dq 179
+v630: dq 180
+v631: dq 181
+v632: dq 182
+v633: dq 183
+v634: dq 184
+v635: dq 185
+v636: dq 186
+v637: dq 187
+v638: dq 188
+v639: dq 189
+v640: dq 190
+v641: dq 191
+v642: dq 192
+v643: dq 193
+v644: dq 194
+v645: dq 195
+v646: dq 196
+v647: dq 197
+v648: dq 198
+v649: dq 199
+v650: dq 200
+v651: dq 201
+v652: dq 202
+v653: dq 203
+v654: dq 204
+v655: dq 205
+v656: dq 206
+v657: dq 207
+v658: dq 208
+v659: dq 209
+v660: dq 210
+v661: dq 211
+v662: dq 212
+v663: dq 213
+v664: dq 214
+v665: dq 215
+v666: dq 216
+v667: dq 217
+v668: dq 218
+v669: dq 219
+v670: dq 220
+v671: dq 221
+v672: dq 222
+v673: dq 223
+v674: dq 224
+v675: dq 225
+v676: dq 226
+v677: dq 227
+v678: dq 228
+v679: dq 229
+v680: dq 230
+v681: dq 231
+v682: dq 232
+v683: dq 233
+v684: dq 234
+v685: dq 235
+v686: dq 236
+v687: dq 237
+v688: dq 238
+v689: dq 239
+v690: dq 240
+v691: dq 241
+v692: dq 242
+v693: dq 243
+v694: dq 244
+v695: dq 245
+v696: dq 246
+v697: dq 247
+v698: dq 248
+v699: dq 249
+v700: dq 250
+v701: dq 251
+v702: dq 252
+v703: dq 253
+v704: dq 254
+v705: dq 255
+v706: dq 256
+v707: dq 257
+v708: dq 258
+v709: dq 259
+v710: dq 260
+v711: dq 261
+v712: dq 262
+v713: dq 263
+v714: dq 264
+v715: dq 265
+v716: dq 266
+v717: dq 267
+v718: dq 268
+v719: dq 269
+v720: dq 270
+v721: dq 271
+v722: dq 272
+v723: dq 273
+v724: dq 274
+v725: dq 275
+v726: dq 276
+v727: dq 277
+v728: dq 278
+v729: dq 279
+v730: dq 280
+v731: dq 281
+v732: dq 282
+v733: dq 283
+v734: dq 284
+v735: dq 285
+v736: dq 286
+v737: dq 287
+v738: dq 288
+v739: dq 289
+v740: dq 290
+v741: dq 291
+v742: dq 292
+v743: dq 293
+v744: dq 294
+v745: dq 295
+v746: dq 296
+v747: dq 297
+v748: dq 298
+v749: dq 299
+v750: dq 300
+v751: dq 301
+v752: dq 302
+v753: dq 303
+v754: dq 304
+v755: dq 305
+v756: dq 306
+v757: dq 307
+v758: dq 308
+v759: dq 309
+v760: dq 310
+v761: dq 311
+v762: dq 312
+v763: dq 313
+v764: dq 0
+v765: dq 1
+v766: dq 64
+v767: dq 512
+v768: dq 0
+v769: dq 1
+v770: dq 2
+v771: dq 4
+v772: dq 16777216
+v773: dq 33554432
+v774: dq 1
+v775: dq 2
+v776: dq 16
+v777: dq 32
+v778: dq 32
+v779: dq 16384
+v780: dq 131072
+v781: dq 1
+v782: dq 2
+v783: dq 4
+v784: dq 256
+v785: dq 512
+v786: dq 1024
+v787: dq 2048
+v788: dq 65536
+v789: dq 262144
+v790: dq 1048576
+v791: dq 2097152
+v792: dq 0
+v793: dq 1
+v794: dq 128
+v795: dq 1
+v796: dq 2
+v797: dq 3
+v798: dq 4
+v799: dq 5
+v800: dq 6
+v801: dq 10
+v802: dq 2
+v803: dq 0
+v804: dq 0
+v805: dq 2
+v807: dq 0
+v809: dq 0
+v810: dq 2
+v811: dq 4
+v812: dq 8
+v814: dq 0
+v815: dq 8
+v816: dq 16
+v817: dq 24
+v818: dq 28
+v819: dq 32
+v820: dq 36
+v821: dq 40
+v822: dq 48
+v823: dq 56
+v824: dq 64
+v825: dq 72
+v826: dq 88
+v827: dq 104
+v828: dq 120
+v904: dq 1024
+v905: dq 4096
+v906: dq 65536
+v997: dq 2048
+v998: dq 4
+v999: dq 24
+v1000: dq 129
+v1001: dq 65536
+v1043: dq 16
+v1044: dq 0
+v1045: dq 8
+v1046: dq 16
+v1058: dq 8
+v1059: dq 256
+v1060: dq 0
+v1061: dq 24
+v1062: dq 32
+v1079: dq 65536
+v1080: dq 8
+v1081: dq 0
+v1082: dq 8
+v1083: dq 16
+v1085: dq 0
+v1086: dq 8
+v1087: dq 16
+v1088: dq 24
+v1089: dq 32
+v1090: dq 40
+v1092: dq 0
+v1093: dq 8
+v1094: dq 16
+v1160: dq 11400714785074694791
+v1161: dq 14029467366897019727
+v1162: dq 1609587929392839161
+v1163: dq 9650029242287828579
+v1164: dq 2870177450012600261
+v1185: dq 16
+v1186: dq 0
+v1187: dq 8
+v1188: dq 16
+v1190: dq 0
+v1191: dq 8
+v1192: dq 16
+v1193: dq 24
+v1194: dq 32
+v1195: dq 40
+v1196: dq 48
+v1299: dq 8388608
+v1300: dq 3477248
+v1301: dq 2147483647
+v1302: dq 4096
+v1303: dq 64
+v1314: dq 0
+v1321: dq 0
+v1331: dq 0
+v1332: dq 8
+v1353: dq 0
+v1354: dq 8
+v1358: dq 0
+v1359: dq 8
+v1360: dq 16
+v1381: dq 0
+v1382: dq 8
+v1383: dq 16
+v1384: dq 32
+v1386: dq 0
+v1387: dq 8
+v1388: dq 16
+v1389: dq 24
+v1390: dq 32
+v1391: dq 40
+v1392: dq 48
+v1393: dq 56
+v1394: dq 64
+v1395: dq 72
+v1396: dq 80
+v1397: dq 88
+v1480: dq 0
+v1481: dq 8
+v1495: dq 0
+v1496: dq 8
+v1498: dq 0
+v1499: dq 8
+v1506: dq 32
+v1508: dq 32
+v1510: dq 32
+v1512: dq 32
+v1514: dq 0
+v1515: dq 8
+v1517: dq 32
+v1522: dq 0
+v1523: dq 4
+v1524: dq 2
+v1525: dq 4
+v1526: dq 4
+v1527: dq 4
+v1528: dq 128
+v1529: dq 1
+v1530: dq 0
+v1531: dq 1
+v1532: dq 1
+v1533: dq 0
+v1534: dq 8
+v1535: dq 0
+v1536: dq 18446744073709551614
+v1537: dq 238
+v1538: dq 100
+v1573: dq 32
+v1586: dq 1000
+v1591: dq 1024
+v1615: dq 1000
+v1631: dq 4
+v1632: dq 2000
+v1633: dq 100000
+v1634: dq 256
+section .bss
+v270: resb 1048576
+v271: resb 8
+v272: resb 8
+v293: resb 16
+v435: resb 16
+v806: resb 16
+v808: resb 8
+v813: resb 16
+v829: resb 144
+v1002: resb 192
+v1003: resb 136
+v1004: resb 192
+v1005: resb 192
+v1006: resb 192
+v1007: resb 8
+v1008: resb 8
+v1047: resb 24
+v1063: resb 40
+v1084: resb 24
+v1091: resb 48
+v1095: resb 24
+v1189: resb 24
+v1197: resb 56
+v1315: resb 8
+v1322: resb 8
+v1333: resb 16
+v1355: resb 16
+v1361: resb 24
+v1385: resb 56
+v1398: resb 96
+v1465: resb 8
+v1466: resb 8
+v1467: resb 8
+v1635: resb 8
+v1636: resb 8
+v1637: resb 8
+v1638: resb 8
+v1639: resb 8
+v1640: resb 8
@@ -0,0 +1,85 @@
+#!/bin/sh
+# bench.sh
+# times every program in examples/basic and tests/core natively and in the bytecode interpreter
+#
+#   usage: ./bench.sh [runs] [warmup runs]
+#
+# environment:
+#   BENCH_DIR            where programs, binaries and results go (.cache/bench)
+#   INTERPRETER_FLAGS    extra interpreter options, e.g. `--jit` or `--engine reg`
+#
+# prints a table of median run times and writes the same numbers to ${BENCH_DIR}/bench.csv
+
+RUNS=${1:-5}
+WARMUP=${2:-1}
+BENCH_DIR=${BENCH_DIR:-.cache/bench}
+SPL=./spl
+INTERPRETER=${BENCH_DIR}/interpreter
+CSV=${BENCH_DIR}/bench.csv
+
+mkdir -p ${BENCH_DIR}
+gcc interpreter/src/interpreter.c -o ${INTERPRETER} -Iinterpreter/include -Wall -O2 -pthread || exit 1
+
+# wall clock time of one run in microseconds
+time_run() {
+  start=$(date +%s%N)
+  "$@" > /dev/null 2>&1
+  end=$(date +%s%N)
+  echo $(( (end - start) / 1000 ))
+}
+
+# median wall clock time over all runs, after the warmup runs
+time_median() {
+  i=0
+  while [ $i -lt ${WARMUP} ]; do
+    "$@" > /dev/null 2>&1
+    i=$((i + 1))
+  done
+  i=0
+  while [ $i -lt ${RUNS} ]; do
+    time_run "$@"
+    i=$((i + 1))
+  done | sort -n | awk '{ t[NR] = $1 } END { if (NR % 2) print t[(NR + 1) / 2]; else print int((t[NR / 2] + t[NR / 2 + 1]) / 2) }'
+}
+
+# compiles a program natively and dumps its bytecode, both end up in the bench directory
+build() {
+  source=$1
+  name=$2
+  ${SPL} dump ${source} > /dev/null 2>&1 || return 1
+  mv -f $(basename ${source} .spl) ${BENCH_DIR}/${name} || return 1
+  [ "${source}.bin" = "${BENCH_DIR}/${name}.spl.bin" ] || mv -f ${source}.bin ${BENCH_DIR}/${name}.spl.bin
+}
+
+bench() {
+  source=$1
+  name=$2
+  if ! build ${source} ${name}; then
+    printf "%-24s failed to build\n" ${name}
+    return
+  fi
+  native=$(time_median ${BENCH_DIR}/${name})
+  interpreted=$(time_median ${INTERPRETER} ${INTERPRETER_FLAGS} ${BENCH_DIR}/${name}.spl.bin)
+  ratio=$(awk "BEGIN { printf \"%.2f\", ${interpreted} / (${native} > 0 ? ${native} : 1) }")
+  printf "%-24s %12s %16s %8sx\n" ${name} ${native} ${interpreted} ${ratio}
+  echo "${name},${native},${interpreted},${ratio}" >> ${CSV}
+}
+
+echo "program,native_us,interpreter_us,ratio" > ${CSV}
+printf "%-24s %12s %16s %9s\n" "program" "native (us)" "interpreter (us)" "ratio"
+
+for source in examples/basic/*.spl; do
+  bench ${source} $(basename ${source} .spl)
+done
+
+# tests in tests/core are fragments of test.spl, so each one gets a main next to the assertions test.spl defines
+for test in tests/core/*.spl; do
+  name=test_$(basename ${test} .spl)
+  source=${BENCH_DIR}/${name}.spl
+  sed '/^include "tests\//,$d' test.spl > ${source}
+  printf 'include "%s"\n\nfn main -> none {\n  test_init();\n  %s();\n}\n' ${test} ${name} >> ${source}
+  bench ${source} ${name}
+done
+
+rm -f noise.ppm
+echo "results written to ${CSV}"
@@ -3,4 +3,4 @@
 set -xe
 
 spl dump debug-output test.spl
-gcc src/interpreter.c -o interpreter -Iinclude -Wall -O0 -ggdb # -DVERBOSE -DSLOW_INTERPRET
+gcc src/interpreter.c -o interpreter -Iinclude -Wall -O2 -ggdb -pthread # -DVERBOSE -DSLOW_INTERPRET
@@ -6,25 +6,41 @@
 #include <fcntl.h>
 #include <time.h>
 #include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <pthread.h>
+#include <errno.h>
+#include <linux/futex.h>
+
+#if defined(__x86_64__)
+  #include <x86intrin.h>
+#endif
+
+#ifndef MREMAP_MAYMOVE
+  #define MREMAP_MAYMOVE (1)
+  #define MREMAP_FIXED (2)
+#endif
+
+#ifndef CLONE_PARENT_SETTID
+  #define CLONE_PARENT_SETTID (0x00100000)
+  #define CLONE_CHILD_CLEARTID (0x00200000)
+#endif
 
-#define MAX_SYMBOL (4096)
-#define MAX_SYMBOL_PER_BLOCK (4096)
-#define MAX_STATIC_DATA (128 * 1024)
-#define MAX_CSTRING (2048)
-#define MAX_SYSCALL_FUNCTION (7)
-#define MAX_BLOCK (256)
-#define MAX_TYPE_STACK (256)
-#define MAX_INS (128 * 1024)
-#define MAX_TYPE_CONTRACT_STACK (16)
 #define MAX_FUNC_ARGC (6)
-#define MAX_NAME_SIZE (64)
-#define MAX_COMPILE_TYPE (1024)
-#define MAX_NUM_STRUCT_FIELDS (64)
-#define MAX_TYPE_CONTEXT (512)
-#define MAX_FIELD_ACCESS_LEVEL (8)
 
 #define NONE UINT64_MAX
 
+#define DEFAULT_STACK_SIZE (Mb(8))
+#define JIT_CODE_CAPACITY (Mb(16))
+#define JIT_DEFAULT_THRESHOLD (1)
+
+// programs that can be snapshotted are laid out from here on, so that a resumed run finds everything where it was left
+#define SNAPSHOT_BASE (0x100000000000)
+#define SNAPSHOT_MAGIC (0x70616e736c7073) // "splsnap"
+#define SNAPSHOT_VERSION (1)
+
 #ifdef VERBOSE
   #define verbose_printf(...) printf(__VA_ARGS__)
 #else
@@ -40,12 +56,6 @@
   #define THINK(ms)
 #endif
 
-#if 0
-  #define PACK_AND_ALIGN __attribute__((packed, aligned(sizeof(size_t))))
-#else
-  #define PACK_AND_ALIGN
-#endif
-
 typedef enum Primitive_type {
   TypeNone,
   TypeAny,
@@ -72,63 +82,6 @@ typedef enum Symbol_type {
   MAX_SYM_TYPE,
 } Symbol_type;
 
-typedef struct Type {
-  size_t base;
-  size_t sub_id;
-  size_t hash;
-  size_t count;
-  size_t size;
-} PACK_AND_ALIGN Type;
-
-typedef struct Struct_field {
-  u8 name[MAX_NAME_SIZE];
-  Type type;
-  size_t offset;
-} PACK_AND_ALIGN Struct_field;
-
-typedef struct Struct_type_info {
-  u8 name[MAX_NAME_SIZE];
-  Struct_field fields[MAX_NUM_STRUCT_FIELDS];
-  size_t count;
-} PACK_AND_ALIGN Struct_type_info;
-
-typedef struct Func_signature {
-  size_t argc;
-  Type args[MAX_FUNC_ARGC + 1];
-  Type rtype;
-} PACK_AND_ALIGN Func_signature;
-
-typedef struct Type_context {
-  Type type;
-  size_t offset;
-  size_t symbol_id;
-} PACK_AND_ALIGN Type_context;
-
-typedef struct Token {
-  char* buffer;
-  size_t length;
-  size_t type;
-  size_t v;
-  char* filename;
-  char* source;
-  size_t line;
-  size_t column;
-} PACK_AND_ALIGN Token;
-
-typedef struct Function {
-  size_t ir_address;
-  size_t ir_body_size;
-  size_t label;
-  size_t argc;
-  size_t locals_offset;
-} PACK_AND_ALIGN Function;
-
-typedef struct Value {
-  Function func;
-  size_t num;
-  size_t konst;
-} PACK_AND_ALIGN Value;
-
 typedef enum Ir_code {
   I_NOP,
   I_POP,
@@ -181,6 +134,13 @@ typedef enum Ir_code {
   I_SYSCALL5,
   I_SYSCALL6,
 
+  I_MEMCPY, // <size, x, x>
+  I_MEMSET, // <size, x, x>
+  I_STRLEN,
+  I_ATOMIC_ADD,
+  I_ATOMIC_CAS,
+  I_THREAD_CLONE,
+
   MAX_IR_CODE
 } Ir_code;
 
@@ -235,27 +195,14 @@ static const char* ir_code_str[MAX_IR_CODE] = {
   "I_SYSCALL4",
   "I_SYSCALL5",
   "I_SYSCALL6",
-};
 
-typedef struct Symbol {
-  u8 name[MAX_NAME_SIZE];
-  size_t imm;
-  size_t size;
-  size_t num_elements_init;
-  size_t konst;
-  size_t local_id;
-  size_t sym_type;
-  Type type;
-  Token token;
-  Value value;
-  size_t ref_count;
-} PACK_AND_ALIGN Symbol;
-
-typedef struct Block {
-  size_t symbols[MAX_SYMBOL_PER_BLOCK];
-  size_t symbol_count;
-  struct Block* parent;
-} PACK_AND_ALIGN Block;
+  "I_MEMCPY",
+  "I_MEMSET",
+  "I_STRLEN",
+  "I_ATOMIC_ADD",
+  "I_ATOMIC_CAS",
+  "I_THREAD_CLONE",
+};
 
 typedef struct Op {
   size_t i;
@@ -264,73 +211,706 @@ typedef struct Op {
   size_t src1;
 } Op;
 
-typedef struct Compile {
-  Op ins[MAX_INS];
-  size_t ins_count;
+// bytecode file written by compile_state_dump() in src/compile_state.spl.
+// layout: [ header | section table | sections ], every section starts at an 8 byte aligned offset.
+#define BYTECODE_MAGIC (0x63626c7073) // "splbc"
+#define BYTECODE_VERSION (3)
 
-  u8 imm[MAX_STATIC_DATA];
-  size_t imm_index;
+typedef enum Section_kind {
+  SECTION_INS, // Op[count]
+  SECTION_IMM, // immediate data, u8[size]
+  SECTION_CSTRINGS, // u64[count], offsets of cstrings in the immediate data
+  SECTION_SYMBOLS, // Bytecode_symbol[count]
+  SECTION_NAMES, // nul terminated symbol names
 
-  Symbol symbols[MAX_SYMBOL];
-  size_t symbol_count;
+  MAX_SECTION
+} Section_kind;
+
+typedef struct Bytecode_header {
+  size_t magic;
+  size_t version;
+  size_t entry_point; // ir address of `main`, NONE if there is none
+  size_t section_count;
+} Bytecode_header;
+
+typedef struct Bytecode_section {
+  size_t kind;
+  size_t offset;
+  size_t size; // in bytes
+  size_t count; // number of elements
+} Bytecode_section;
+
+typedef struct Bytecode_symbol {
+  size_t name; // offset into the name section
+  size_t imm;
+  size_t size;
+  size_t konst;
+  size_t sym_type;
+  size_t type_base;
+  size_t type_size;
+  size_t ir_address;
+} Bytecode_symbol;
 
-  size_t cstrings[MAX_CSTRING];
+// a loaded bytecode file, the sections point straight into the mapped file
+typedef struct Module {
+  u8* file;
+  size_t file_size;
+  size_t entry_point;
+  const Op* ins;
+  size_t ins_count;
+  const u8* imm;
+  size_t imm_size;
+  const size_t* cstrings;
   size_t cstring_count;
+  const Bytecode_symbol* symbols;
+  size_t symbol_count;
+  const char* names;
+  size_t names_size;
+} Module;
 
-  Block global;
 
-  Block blocks[MAX_BLOCK];
-  size_t block_count;
-  size_t block_count_largest;
+// pre-decoded instruction set, translated from the Ir_code stream by prepare_interpreter()
+// labels and nops are dropped, jump and call targets are absolute indices into the code
+// and immediates, masks and addresses are resolved ahead of time
+typedef enum Code_op {
+  C_HALT,
+  C_POP,
+  C_MOVE_LOCAL, // <local_id, x>
+  C_MOVE_LOCAL32, // <local_id, x>
+  C_MOVE_LOCAL16, // <local_id, x>
+  C_MOVE_LOCAL8, // <local_id, x>
+  C_STORE64,
+  C_STORE32,
+  C_STORE16,
+  C_STORE8,
+  C_LOAD64,
+  C_LOAD32,
+  C_LOAD16,
+  C_LOAD8,
+  C_PUSH_LOCAL_ADDR_OF, // <local_id, x>
+  C_PUSH_LOCAL, // <local_id, x>
+  C_PUSH_LOCAL32, // <local_id, x>
+  C_PUSH_LOCAL16, // <local_id, x>
+  C_PUSH_LOCAL8, // <local_id, x>
+  C_PUSH_GLOBAL, // <address, mask>
+  C_PUSH_IMM, // <value, x>
+  C_ADD,
+  C_SUB,
+  C_MUL,
+  C_LSHIFT,
+  C_RSHIFT,
+  C_DIV,
+  C_DIVMOD,
+  C_LT,
+  C_GT,
+  C_AND,
+  C_LOGICAL_NOT,
+  C_NOT,
+  C_OR,
+  C_XOR,
+  C_EQ,
+  C_NEQ,
+  C_RET, // <x, x>
+  C_NORET, // <x, x>
+  C_PRINT,
+  C_CALL, // <target, has_return_value>, argc
+  C_ADDR_CALL, // <x, has_return_value>, argc
+  C_JMP, // <target, x>
+  C_JZ, // <target, x>
+  C_BEGIN_FUNC, // <frame_size, x>, argc
+  C_SYSCALL, // <x, x>, argc
+  C_MEMCPY, // <size, x>, size is NONE when it is on the stack
+  C_MEMSET, // <size, x>, size is NONE when it is on the stack
+  C_STRLEN,
+  C_ATOMIC_ADD,
+  C_ATOMIC_CAS,
+  C_THREAD_CLONE,
 
-  size_t label_count;
+  // superinstructions
+  C_ADD_LOCAL_IMM, // <local_id, imm>
+  C_MOVE_LOCAL_IMM, // <local_id, imm>
+  C_COPY_LOCAL, // <dest_local_id, src_local_id>
+  C_LOAD_LOCAL64, // <local_id, x>
+  C_JZ_LT, // <target, x>
+  C_JZ_GT, // <target, x>
+  C_JZ_EQ, // <target, x>
+  C_JZ_NEQ, // <target, x>
+  C_JZ_LT_LOCALS, // <target, local_id>, local_id
+  C_JZ_LT_LOCAL_IMM, // <target, imm>, local_id
+  C_JZ_EQ_LOCAL_IMM, // <target, imm>, local_id
 
-  size_t status;
-  size_t entry_point;
+  MAX_CODE_OP
+} Code_op;
+
+static const char* code_op_str[MAX_CODE_OP] = {
+  "C_HALT",
+  "C_POP",
+  "C_MOVE_LOCAL",
+  "C_MOVE_LOCAL32",
+  "C_MOVE_LOCAL16",
+  "C_MOVE_LOCAL8",
+  "C_STORE64",
+  "C_STORE32",
+  "C_STORE16",
+  "C_STORE8",
+  "C_LOAD64",
+  "C_LOAD32",
+  "C_LOAD16",
+  "C_LOAD8",
+  "C_PUSH_LOCAL_ADDR_OF",
+  "C_PUSH_LOCAL",
+  "C_PUSH_LOCAL32",
+  "C_PUSH_LOCAL16",
+  "C_PUSH_LOCAL8",
+  "C_PUSH_GLOBAL",
+  "C_PUSH_IMM",
+  "C_ADD",
+  "C_SUB",
+  "C_MUL",
+  "C_LSHIFT",
+  "C_RSHIFT",
+  "C_DIV",
+  "C_DIVMOD",
+  "C_LT",
+  "C_GT",
+  "C_AND",
+  "C_LOGICAL_NOT",
+  "C_NOT",
+  "C_OR",
+  "C_XOR",
+  "C_EQ",
+  "C_NEQ",
+  "C_RET",
+  "C_NORET",
+  "C_PRINT",
+  "C_CALL",
+  "C_ADDR_CALL",
+  "C_JMP",
+  "C_JZ",
+  "C_BEGIN_FUNC",
+  "C_SYSCALL",
+  "C_MEMCPY",
+  "C_MEMSET",
+  "C_STRLEN",
+  "C_ATOMIC_ADD",
+  "C_ATOMIC_CAS",
+  "C_THREAD_CLONE",
+
+  "C_ADD_LOCAL_IMM",
+  "C_MOVE_LOCAL_IMM",
+  "C_COPY_LOCAL",
+  "C_LOAD_LOCAL64",
+  "C_JZ_LT",
+  "C_JZ_GT",
+  "C_JZ_EQ",
+  "C_JZ_NEQ",
+  "C_JZ_LT_LOCALS",
+  "C_JZ_LT_LOCAL_IMM",
+  "C_JZ_EQ_LOCAL_IMM",
+};
+
+// register based instruction set, translated from the stack code by prepare_registers().
+// operand stack entries live in registers, which are frame slots below the locals of a function,
+// so operands are addressed the same way locals are: as an offset below the frame pointer.
+// instructions take their destination in c and their sources in a and b.
+typedef enum Reg_op {
+  R_HALT,
+  R_MOV, // <x, src>, dest
+  R_MOVI, // <x, imm>, dest
+  R_LEA, // <x, local_id>, dest
+  R_LOADG, // <address, mask>, dest
+  R_LOAD64, // <x, src>, dest
+  R_LOAD32, // <x, src>, dest
+  R_LOAD16, // <x, src>, dest
+  R_LOAD8, // <x, src>, dest
+  R_LOAD_LOCAL32, // <x, local_id>, dest
+  R_LOAD_LOCAL16, // <x, local_id>, dest
+  R_LOAD_LOCAL8, // <x, local_id>, dest
+  R_STORE64, // <address, src>
+  R_STORE32, // <address, src>
+  R_STORE16, // <address, src>
+  R_STORE8, // <address, src>
+  R_STORE_LOCAL32, // <x, src>, local_id
+  R_STORE_LOCAL16, // <x, src>, local_id
+  R_STORE_LOCAL8, // <x, src>, local_id
+
+  // binary operators, in the same order as Code_op, with a register and an immediate form
+  R_ADD, // <src0, src1>, dest
+  R_SUB,
+  R_MUL,
+  R_LSHIFT,
+  R_RSHIFT,
+  R_DIV,
+  R_DIVMOD,
+  R_LT,
+  R_GT,
+  R_AND,
+  R_OR,
+  R_XOR,
+  R_EQ,
+  R_NEQ,
+  R_ADDI, // <src0, imm>, dest
+  R_SUBI,
+  R_MULI,
+  R_LSHIFTI,
+  R_RSHIFTI,
+  R_DIVI,
+  R_DIVMODI,
+  R_LTI,
+  R_GTI,
+  R_ANDI,
+  R_ORI,
+  R_XORI,
+  R_EQI,
+  R_NEQI,
+
+  R_LOGICAL_NOT, // <x, src>, dest
+  R_NOT, // <x, src>, dest
+  R_JMP, // <target, x>
+  R_JZ, // <target, src>
+  R_JZ_LT, // <target, src1>, src0
+  R_JZ_GT, // <target, src1>, src0
+  R_JZ_EQ, // <target, src1>, src0
+  R_JZ_NEQ, // <target, src1>, src0
+  R_JZ_LTI, // <target, imm>, src0
+  R_JZ_GTI, // <target, imm>, src0
+  R_JZ_EQI, // <target, imm>, src0
+  R_JZ_NEQI, // <target, imm>, src0
+  R_CALL, // <target, args>, argc
+  R_ADDR_CALL, // <src, args>, argc
+  R_SYSCALL, // <src, args>, argc
+  R_RET, // <x, src>
+  R_NORET,
+  R_BEGIN_FUNC, // <frame_size, x>, argc
+  R_PRINT, // <x, src>
+  R_MEMCPY, // <size, args>, argc
+  R_MEMSET, // <size, args>, argc
+  R_STRLEN, // <x, args>, argc
+  R_ATOMIC_ADD, // <x, args>, argc
+  R_ATOMIC_CAS, // <x, args>, argc
+  R_THREAD_CLONE, // <x, args>, argc
+
+  MAX_REG_OP
+} Reg_op;
+
+#define REG_IMM_FORM(OP) ((OP) + (R_ADDI - R_ADD))
+
+static const char* reg_op_str[MAX_REG_OP] = {
+  "R_HALT",
+  "R_MOV",
+  "R_MOVI",
+  "R_LEA",
+  "R_LOADG",
+  "R_LOAD64",
+  "R_LOAD32",
+  "R_LOAD16",
+  "R_LOAD8",
+  "R_LOAD_LOCAL32",
+  "R_LOAD_LOCAL16",
+  "R_LOAD_LOCAL8",
+  "R_STORE64",
+  "R_STORE32",
+  "R_STORE16",
+  "R_STORE8",
+  "R_STORE_LOCAL32",
+  "R_STORE_LOCAL16",
+  "R_STORE_LOCAL8",
+
+  "R_ADD",
+  "R_SUB",
+  "R_MUL",
+  "R_LSHIFT",
+  "R_RSHIFT",
+  "R_DIV",
+  "R_DIVMOD",
+  "R_LT",
+  "R_GT",
+  "R_AND",
+  "R_OR",
+  "R_XOR",
+  "R_EQ",
+  "R_NEQ",
+  "R_ADDI",
+  "R_SUBI",
+  "R_MULI",
+  "R_LSHIFTI",
+  "R_RSHIFTI",
+  "R_DIVI",
+  "R_DIVMODI",
+  "R_LTI",
+  "R_GTI",
+  "R_ANDI",
+  "R_ORI",
+  "R_XORI",
+  "R_EQI",
+  "R_NEQI",
+
+  "R_LOGICAL_NOT",
+  "R_NOT",
+  "R_JMP",
+  "R_JZ",
+  "R_JZ_LT",
+  "R_JZ_GT",
+  "R_JZ_EQ",
+  "R_JZ_NEQ",
+  "R_JZ_LTI",
+  "R_JZ_GTI",
+  "R_JZ_EQI",
+  "R_JZ_NEQI",
+  "R_CALL",
+  "R_ADDR_CALL",
+  "R_SYSCALL",
+  "R_RET",
+  "R_NORET",
+  "R_BEGIN_FUNC",
+  "R_PRINT",
+  "R_MEMCPY",
+  "R_MEMSET",
+  "R_STRLEN",
+  "R_ATOMIC_ADD",
+  "R_ATOMIC_CAS",
+  "R_THREAD_CLONE",
+};
+
+typedef struct Code {
+  const void* handler; // dispatch address, filled in when the code is threaded
+  u32 op;
+  u32 c; // small operand, argument count or local id
+  size_t a;
+  size_t b;
+} Code;
+
+// node of the calling context tree, one for every distinct call stack that was seen
+typedef struct Profile_node {
+  size_t func; // code index of the function entry
+  size_t parent;
+  size_t first_child;
+  size_t next_sibling;
+  u64 self; // time spent in the function itself under this call stack
+} Profile_node;
+
+typedef struct Profile_frame {
+  size_t node;
+  u64 start;
+  u64 children; // time spent in callees
+} Profile_frame;
+
+typedef struct Profile {
+  size_t* hits; // executions of every instruction
+  size_t* calls; // per function entry
+  size_t* active; // activations of every function on the call stack, recursive calls are only timed once
+  u64* inclusive; // per function entry
+  u64* exclusive; // per function entry
+  Profile_node* nodes;
+  size_t node_count;
+  size_t node_capacity;
+  Profile_frame* frames;
+  size_t frame_count;
+  size_t frame_capacity;
+  u64 start;
+  u64 total;
+  const char* folded_path;
+  bool reported;
+} Profile;
+
+// machine code compiled from the stack code, see jit_compile()
+typedef struct Jit {
+  u8* code;
+  size_t size;
+  size_t capacity;
+  void** entry; // native entry point of every compiled function, indexed by code index
+  u32* calls; // calls made to each function while it was interpreted
+  bool* failed; // functions that could not be compiled
+  bool* address_taken;
+  size_t threshold; // number of calls after which a function is compiled
+  size_t func_count;
+  bool frozen; // set once guest threads run, which share the code, no more functions are compiled from then on
+} Jit;
 
-  Type ts[MAX_TYPE_STACK];
-  size_t ts_count;
+typedef struct Program {
+  Code* code;
+  size_t count;
+  size_t entry;
+  u8* data; // cstrings, constants and global variables, laid out the same way as the native backends do
+  size_t data_size;
+  bool threaded;
+  size_t ir_count; // number of ir instructions the code was decoded from
+  size_t fusion_count[MAX_CODE_OP]; // how many times each superinstruction was formed
+  Code* reg_code; // register code, only built for the register engine
+  size_t reg_count;
+  size_t* reg_index; // index into the register code for every stack code instruction
+  bool reg_threaded;
+  Jit* jit; // only set when running with the jit
+  size_t* ir_address; // ir address each instruction was decoded from
+  u8* ir_op; // ir code each instruction was decoded from
+  char** func_name; // name of the function that starts at each instruction, NULL everywhere else
+  Profile* profile; // only set when profiling
+  u8* base; // data and code were placed at this fixed address instead of the heap, NULL otherwise
+  size_t base_size;
+} Program;
+
+typedef struct Frame {
+  const Code* call; // call instruction to return to
+  u8* fp; // frame pointer of the caller
+} Frame;
 
-  Value vs[MAX_TYPE_STACK];
-  size_t vs_count;
+typedef enum Engine {
+  ENGINE_STACK,
+  ENGINE_REG,
+} Engine;
 
-  Type types[MAX_COMPILE_TYPE];
-  size_t type_count;
+typedef struct Options {
+  size_t stack_size;
+  bool fuse;
+  Engine engine;
+  bool jit;
+  size_t jit_threshold;
+  const char* profile_path; // profile the run and write folded call stacks here, NULL when not profiling
+  const char* snapshot_path; // write a snapshot here when the snapshot point is reached
+  const char* snapshot_at; // function name or ir address to take the snapshot at
+  const char* resume_path; // resume from this snapshot instead of starting from the entry point
+} Options;
 
-  Type type_contract_stack[MAX_TYPE_CONTRACT_STACK];
-  size_t type_contract_count;
+// registers of the stack engine at an instruction boundary
+typedef struct Snapshot_state {
+  u64 ip;
+  u64 sp;
+  u64 fp;
+  u64 rax;
+  u64 args[MAX_FUNC_ARGC];
+  u64 frame_count;
+} Snapshot_state;
 
-  Struct_type_info struct_type_info[MAX_COMPILE_TYPE];
-  size_t struct_id;
+typedef struct Snapshot_header {
+  u64 magic;
+  u64 version;
+  u64 module_hash; // snapshots only resume the program they were taken of
+  u64 fused;
+  u64 code_count;
+  u64 stack_size;
+  u64 map_next;
+  Snapshot_state state;
+  u64 region_count;
+} Snapshot_header;
 
-  Func_signature func_signatures[MAX_COMPILE_TYPE];
-  size_t func_sig_count;
+// memory that is mapped back at the same address when resuming, contents start at a page aligned offset in the file
+typedef struct Snapshot_region {
+  u64 address;
+  u64 size;
+  u64 offset;
+} Snapshot_region;
 
-  Type_context type_contexts[MAX_TYPE_CONTEXT];
-  size_t type_context_count;
+typedef struct Region {
+  u8* address;
+  size_t size;
+} Region;
 
-  size_t warning_count;
-  size_t error_count;
-} PACK_AND_ALIGN Compile;
+// one instance of a program with all of its mutable state: decoded code, static data, guest stack and exit status.
+// contexts share nothing but the read-only module they were created from, so any number of them can run at
+// the same time on different threads.
+typedef struct Context {
+  Program program;
+  Options options;
+  u8* stack; // lowest usable address of the guest stack, the page below it is a guard page
+  size_t stack_size;
+  Frame* frames;
+  size_t frame_capacity;
+  bool exited; // the program ended itself with an exit syscall
+  i32 exit_code;
+  size_t snapshot_at; // code index at which a snapshot is taken, NONE for no snapshot
+  u8* map_next; // end of the memory reserved for guest mappings above the stack, only used at SNAPSHOT_BASE
+  Region* regions; // memory mapped by the guest, only tracked when snapshotting
+  size_t region_count;
+  size_t region_capacity;
+  Snapshot_state* resume; // registers to continue from, NULL when starting at the entry point
+  Snapshot_state resume_state;
+  u64 module_hash;
+  bool fused; // whether the code was built with superinstructions
+  size_t thread_arg; // argument of the entry function of a guest thread
+  bool thread; // a guest thread, which shares its program with the context that started it
+  // guest threads belong to the top-level context they were started from, the fields below are only used on that one
+  struct Context* owner; // the top-level context, the context itself when it is not a guest thread
+  pthread_t host; // thread running context_run()
+  pthread_mutex_t thread_lock;
+  pthread_t* threads; // guest threads that have not been joined yet
+  size_t thread_count;
+  size_t thread_capacity;
+  bool stopping; // the program has ended, no more guest threads are started and running ones are stopped
+  bool thread_exited; // a guest thread ended the program, by exiting or with an error
+  Result thread_result;
+  i32 thread_exit_code;
+} Context;
 
 void printbits(size_t v);
 void tabs(size_t count);
-Compile* compile_state_new(const char* path);
-void prepare_interpreter(Compile* c, size_t* entry_point);
-void interpret(Compile* c, size_t ip, size_t depth);
-void compile_state_free(Compile* c);
+Result module_load(const char* path, Module* m);
+void prepare_interpreter(const Module* m, Program* p, bool fuse, u8* base);
+void print_code_stats(i32 fd, const Program* p);
+Result interpret(Context* ctx, const Code* entry);
+void prepare_registers(Program* p);
+Jit* jit_new(const Program* p, size_t threshold);
+bool jit_compile(Program* p, size_t func);
+void jit_free(Jit* jit);
+Profile* profile_new(const Program* p, const char* folded_path);
+void profile_report(const Program* p, i32 fd);
+Result interpret_reg(Context* ctx, const Code* entry);
+void program_free(Program* p);
+void module_free(Module* m);
+Context* context_new(const Module* m, const Options* options);
+size_t context_map(Context* ctx, size_t code, const size_t* args);
+size_t context_thread_clone(Context* ctx, const size_t* args);
+Result snapshot_write(Context* ctx, const Snapshot_state* state, const Frame* frames);
+Result context_run(Context* ctx);
+void context_free(Context* ctx);
+Result run_batch(const char** paths, size_t path_count, size_t repeat, size_t jobs, const Options* options);
+
+#ifndef INTERPRETER_LIBRARY
+
+i32 main(i32 argc, char** argv) {
+  const char** paths = calloc(argc, sizeof(char*));
+  ASSERT(paths != NULL);
+  size_t path_count = 0;
+  Options options = {
+    .stack_size = DEFAULT_STACK_SIZE,
+    .fuse = true,
+    .engine = ENGINE_STACK,
+    .jit = false,
+    .jit_threshold = JIT_DEFAULT_THRESHOLD,
+    .profile_path = NULL,
+    .snapshot_path = NULL,
+    .snapshot_at = NULL,
+    .resume_path = NULL,
+  };
+  bool stats = false;
+  bool profile = false;
+  size_t repeat = 1;
+  size_t jobs = (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+  for (i32 i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--stack-size") && i + 1 < argc) {
+      options.stack_size = strtoull(argv[++i], NULL, 10);
+    }
+    else if (!strcmp(argv[i], "--no-fusion")) {
+      options.fuse = false;
+    }
+    else if (!strcmp(argv[i], "--stats")) {
+      stats = true;
+    }
+    else if (!strcmp(argv[i], "--engine") && i + 1 < argc) {
+      const char* engine = argv[++i];
+      if (!strcmp(engine, "reg")) {
+        options.engine = ENGINE_REG;
+      }
+      else if (strcmp(engine, "stack")) {
+        fprintf(stderr, "unknown engine `%s`, expected `stack` or `reg`\n", engine);
+        return EXIT_FAILURE;
+      }
+    }
+    else if (!strcmp(argv[i], "--jit")) {
+      options.jit = true;
+    }
+    else if (!strcmp(argv[i], "--jit-threshold") && i + 1 < argc) {
+      options.jit = true;
+      options.jit_threshold = strtoull(argv[++i], NULL, 10);
+    }
+    else if (!strcmp(argv[i], "--profile")) {
+      profile = true;
+    }
+    else if (!strcmp(argv[i], "--snapshot-at") && i + 1 < argc) {
+      options.snapshot_at = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--snapshot") && i + 1 < argc) {
+      options.snapshot_path = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--resume") && i + 1 < argc) {
+      options.resume_path = argv[++i];
+    }
+    else if (!strcmp(argv[i], "--repeat") && i + 1 < argc) {
+      repeat = strtoull(argv[++i], NULL, 10);
+      repeat = MAX(repeat, 1);
+    }
+    else if (!strcmp(argv[i], "--jobs") && i + 1 < argc) {
+      jobs = strtoull(argv[++i], NULL, 10);
+      jobs = MAX(jobs, 1);
+    }
+    else {
+      paths[path_count++] = argv[i];
+    }
+  }
+  if (path_count == 0) {
+    paths[path_count++] = "test.spl.bin";
+  }
+  if (options.jit && options.engine != ENGINE_STACK) {
+    fprintf(stderr, "the jit only works together with the stack engine\n");
+    return EXIT_FAILURE;
+  }
+  if (profile && (options.jit || options.engine != ENGINE_STACK)) {
+    fprintf(stderr, "profiling only works with the stack engine and without the jit\n");
+    return EXIT_FAILURE;
+  }
+  if ((options.snapshot_at || options.snapshot_path || options.resume_path) && options.engine != ENGINE_STACK) {
+    fprintf(stderr, "snapshots only work with the stack engine\n");
+    return EXIT_FAILURE;
+  }
+  if ((options.snapshot_at || options.snapshot_path) && (options.jit || profile || options.resume_path)) {
+    fprintf(stderr, "snapshots can not be taken with the jit, while profiling or from a resumed run\n");
+    return EXIT_FAILURE;
+  }
+  if (options.snapshot_path && !options.snapshot_at) {
+    fprintf(stderr, "--snapshot needs a snapshot point, given with --snapshot-at\n");
+    return EXIT_FAILURE;
+  }
+  const bool batch = path_count > 1 || repeat > 1;
+  if (batch && (profile || stats || options.snapshot_at || options.resume_path)) {
+    fprintf(stderr, "profiling, stats and snapshots only work for a single run\n");
+    return EXIT_FAILURE;
+  }
+  if (batch) {
+    const Result result = run_batch(paths, path_count, repeat, jobs, &options);
+    free(paths);
+    return result == Ok ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
 
-i32 main(void) {
-  Compile* c = compile_state_new("test.spl.bin");
-  if (c) {
-    size_t ip = 0;
-    prepare_interpreter(c, &ip);
-    interpret(c, ip, 0);
-    compile_state_free(c);
+  char folded_path[MAX_PATH_LENGTH] = {0};
+  snprintf(folded_path, sizeof(folded_path), "%s.folded", paths[0]);
+  if (profile) {
+    options.profile_path = folded_path;
+  }
+  char snapshot_path[MAX_PATH_LENGTH] = {0};
+  snprintf(snapshot_path, sizeof(snapshot_path), "%s.snapshot", paths[0]);
+  if (options.snapshot_at && !options.snapshot_path) {
+    options.snapshot_path = snapshot_path;
+  }
+  Module module;
+  if (module_load(paths[0], &module) != Ok) {
+    return EXIT_FAILURE;
   }
-  return EXIT_SUCCESS;
+  free(paths);
+  Context* ctx = context_new(&module, &options);
+  module_free(&module);
+  if (!ctx) {
+    return EXIT_FAILURE;
+  }
+  Program* program = &ctx->program;
+  if (stats) {
+    print_code_stats(STDERR_FILENO, program);
+  }
+  const Result result = context_run(ctx);
+  if (stats && program->jit) {
+    dprintf(STDERR_FILENO, "jit compiled functions: %zu (%zu bytes)\n", program->jit->func_count, program->jit->size);
+  }
+  if (program->profile) {
+    profile_report(program, STDERR_FILENO);
+  }
+  const i32 exit_code = ctx->exit_code;
+  context_free(ctx);
+  if (result != Ok) {
+    return EXIT_FAILURE;
+  }
+  return exit_code;
 }
 
+#endif // INTERPRETER_LIBRARY
+
 void printbits(size_t v) {
   for (size_t i = (size_t)sizeof(v) - 1;;) {
     for (size_t bit = 8; bit > 0; --bit) {
@@ -354,622 +934,3319 @@ void tabs(size_t count) {
   }
 }
 
-Compile* compile_state_new(const char* path) {
+Result module_load(const char* path, Module* m) {
+  Result result = Ok;
+  memset(m, 0, sizeof(Module));
   i32 fd = open(path, O_RDONLY);
   if (fd < 0) {
-    return NULL;
+    fprintf(stderr, "failed to open `%s`\n", path);
+    return Error;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Bytecode_header)) {
+    fprintf(stderr, "[interpreter-error]: `%s` is not a bytecode file\n", path);
+    return_defer(Error);
+  }
+  m->file_size = (size_t)st.st_size;
+  m->file = mmap(NULL, m->file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (m->file == MAP_FAILED) {
+    m->file = NULL;
+    fprintf(stderr, "[interpreter-error]: failed to map `%s`\n", path);
+    return_defer(Error);
+  }
+
+  const Bytecode_header* header = (const Bytecode_header*)m->file;
+  if (header->magic != BYTECODE_MAGIC) {
+    fprintf(stderr, "[interpreter-error]: `%s` is not a bytecode file\n", path);
+    return_defer(Error);
+  }
+  if (header->version != BYTECODE_VERSION) {
+    fprintf(stderr, "[interpreter-error]: `%s` has bytecode version %zu, expected version %d\n", path, header->version, BYTECODE_VERSION);
+    return_defer(Error);
+  }
+  if (header->section_count > (m->file_size - sizeof(Bytecode_header)) / sizeof(Bytecode_section)) {
+    fprintf(stderr, "[interpreter-error]: `%s` has a truncated section table\n", path);
+    return_defer(Error);
+  }
+  m->entry_point = header->entry_point;
+
+  const Bytecode_section* sections = (const Bytecode_section*)(m->file + sizeof(Bytecode_header));
+  for (size_t i = 0; i < header->section_count; ++i) {
+    const Bytecode_section* section = &sections[i];
+    static const size_t element_size[MAX_SECTION] = {
+      [SECTION_INS]      = sizeof(Op),
+      [SECTION_IMM]      = sizeof(u8),
+      [SECTION_CSTRINGS] = sizeof(size_t),
+      [SECTION_SYMBOLS]  = sizeof(Bytecode_symbol),
+      [SECTION_NAMES]    = 0,
+    };
+    if (section->offset % sizeof(size_t) || section->offset > m->file_size || section->size > m->file_size - section->offset ||
+      (section->kind < MAX_SECTION && element_size[section->kind] && section->size != section->count * element_size[section->kind])) {
+      fprintf(stderr, "[interpreter-error]: `%s` has a corrupt section (%zu)\n", path, i);
+      return_defer(Error);
+    }
+    const void* data = m->file + section->offset;
+    switch (section->kind) {
+      case SECTION_INS:      m->ins = data; m->ins_count = section->count; break;
+      case SECTION_IMM:      m->imm = data; m->imm_size = section->size; break;
+      case SECTION_CSTRINGS: m->cstrings = data; m->cstring_count = section->count; break;
+      case SECTION_SYMBOLS:  m->symbols = data; m->symbol_count = section->count; break;
+      case SECTION_NAMES:    m->names = data; m->names_size = section->size; break;
+      default:
+        break; // sections from newer versions of the format are skipped
+    }
   }
-  Compile* state = malloc(sizeof(Compile));
-  i32 n = read(fd, state, sizeof(Compile));
-  ASSERT(n == sizeof(Compile));
+defer:
   close(fd);
-  return state;
+  if (result != Ok) {
+    module_free(m);
+  }
+  return result;
 }
 
-void prepare_interpreter(Compile* c, size_t* entry_point) {
-  ASSERT(entry_point != NULL);
-  for (size_t i = 0; i < c->symbol_count; ++i) {
-    Symbol* symbol = &c->symbols[i];
-    if (!strncmp((char*)symbol->name, "main", MAX_NAME_SIZE)) {
-      Function main_func = symbol->value.func;
-      *entry_point = main_func.ir_address;
-      break;
+static size_t mask_from_size(size_t size) {
+  if (size >= sizeof(size_t)) {
+    return ~(size_t)0;
+  }
+  return ((size_t)1 << (size * 8)) - 1;
+}
+
+// width of a single element of a constant, matches the data directives emitted by the backends
+static size_t data_width(size_t type_base) {
+  switch (type_base) {
+    case TypeUnsigned64:
+    case TypePtr:
+      return sizeof(u64);
+    case TypeUnsigned32:
+      return sizeof(u32);
+    case TypeUnsigned16:
+      return sizeof(u16);
+    case TypeUnsigned8:
+      return sizeof(u8);
+    default:
+      return 0;
+  }
+}
+
+// how many bytes of static storage a symbol needs, zero if it does not live in memory
+static size_t symbol_storage_size(const Bytecode_symbol* symbol) {
+  if (symbol->konst && (symbol->sym_type == SYM_LOCAL_VAR || symbol->sym_type == SYM_GLOBAL_VAR)) {
+    const size_t width = data_width(symbol->type_base);
+    if (width == 0 || symbol->type_size == 0 || symbol->imm == NONE) {
+      return 0;
+    }
+    const size_t count = symbol->size / symbol->type_size;
+    return ALIGN((count * width), sizeof(size_t));
+  }
+  if (!symbol->konst && symbol->sym_type == SYM_GLOBAL_VAR) {
+    if (symbol->type_base == TypeNone || symbol->type_base == TypeSyscallFunc) {
+      return 0;
     }
+    return ALIGN(symbol->size, sizeof(size_t));
   }
+  return 0;
 }
 
-void interpret(Compile* c, size_t ip, size_t depth) {
-  (void)ir_code_str;
-  #define STACK_SIZE (Kb(8))
-  #define MAX_STACK (STACK_SIZE / sizeof(size_t))
-  size_t stack[MAX_STACK] = {0};
-  size_t sp = 0; // stack pointer
-  size_t bsp = 0; // base stack pointer
-
-  #define STACK_PUSH(V) (stack[sp++] = (size_t)V)
-  #define STACK_POP(N) (sp -= N, stack[sp])
-  #define STACK_TOP(OFFSET) (stack[sp + OFFSET - 1])
-
-  #define STACK_PRINT() do {                                          \
-    for (size_t stack_index = 0; stack_index < sp; ++stack_index) {   \
-      verbose_printf("%7zu: %zu", stack_index, stack[stack_index]);   \
-      if (stack_index+1 == bsp) {                                     \
-        verbose_printf(" <- bsp");                                    \
-      }                                                               \
-      verbose_printf("\n");                                           \
-    }                                                                 \
-  } while (0)
+static void code_emit(Program* p, u32 op, u32 c, size_t a, size_t b) {
+  Code* code = &p->code[p->count++];
+  code->handler = NULL;
+  code->op = op;
+  code->c = c;
+  code->a = a;
+  code->b = b;
+}
 
-  // x86_64 style registers
-  typedef union Register {
-    size_t v64;
-    u32 v32;
-    u16 v16;
-    u8 v8;
-  } Register;
-
-  #define REG_FROM_TYPE(REGISTER_TYPE) &regs[REGISTER_TYPE]
-  #define REG_VALUE_FROM_TYPE(REGISTER_TYPE, BITS) REG_FROM_TYPE(REGISTER_TYPE).v##BITS
-
-  typedef enum Register_type {
-    RAX,
-    RCX,
-    RDX,
-    RBX,
-    RSP,
-    RBP,
-    RSI,
-    RDI,
-    R8,
-    R9,
-    R10,
-    R11,
-    R12,
-    R13,
-    R14,
-    R15,
-
-    MAX_REGISTER,
-  } Register_type;
-
-  static Register regs[MAX_REGISTER] = {0};
-
-  Register_type func_call_regs[MAX_FUNC_ARGC] = {
-    RDI,
-    RSI,
-    RDX,
-    RCX,
-    R8,
-    R9
-  };
+static bool code_has_target(u32 op) {
+  switch (op) {
+    case C_CALL:
+    case C_JMP:
+    case C_JZ:
+    case C_JZ_LT:
+    case C_JZ_GT:
+    case C_JZ_EQ:
+    case C_JZ_NEQ:
+    case C_JZ_LT_LOCALS:
+    case C_JZ_LT_LOCAL_IMM:
+    case C_JZ_EQ_LOCAL_IMM:
+      return true;
+    default:
+      return false;
+  }
+}
 
-  const char* regs_str[MAX_REGISTER] = {
-    "RAX",
-    "RCX",
-    "RDX",
-    "RBX",
-    "RSP",
-    "RBP",
-    "RSI",
-    "RDI",
-    "R8",
-    "R9",
-    "R10",
-    "R11",
-    "R12",
-    "R13",
-    "R14",
-    "R15",
-  };
-  (void)regs_str;
+static size_t jump_target(const Op* op, size_t ip) {
+  if (op->i == I_JMP) {
+    return op->src0 != NONE ? ip + op->src0 : ip - op->src1;
+  }
+  return ip + op->src0;
+}
 
-  for (; ip < c->ins_count; ++ip) {
-    const Op* op = &c->ins[ip];
-    tabs(depth);
-    verbose_printf("%4zu: %s: ", ip, ir_code_str[op->i]);
-    THINK(100);
-    switch (op->i) {
-      case I_NOP: {
-        verbose_printf("\n");
-        break;
-      }
-      case I_POP: {
-        *(REG_VALUE_FROM_TYPE(RAX, 64)) = STACK_POP(1);
-        verbose_printf("\n");
-        break;
-      }
-      // <size, local_id, x>
-      case I_MOVE_LOCAL: {
-        const size_t size = op->dest;
-        const size_t local_id = op->src0;
-        const size_t offset = (bsp - 1) + (local_id / sizeof(size_t));
-        size_t mask = ~0;
-        mask >>= 64 - (size * 8);
-        size_t top = STACK_TOP(0);
-        (void)top;
-        size_t value = STACK_POP(1);
-        stack[offset] = value & mask;
-        verbose_printf("value = %zu, size = %zu, local_id = %zu, offset = %zu, top = %zu\n", value, size, local_id, offset, top);
-        break;
-      }
-      case I_STORE64: {
-        size_t b = STACK_POP(1);
-        size_t* a = (size_t*)STACK_POP(1);
-        *a = b;
-        verbose_printf("\n");
-        break;
-      }
-      case I_STORE32: {
-        size_t b = STACK_POP(1);
-        size_t* a = (size_t*)STACK_POP(1);
-        *(u32*)a = (u32)b;
-        verbose_printf("\n");
-        break;
-      }
-      case I_STORE16: {
-        size_t b = STACK_POP(1);
-        size_t* a = (size_t*)STACK_POP(1);
-        *(u16*)a = (u16)b;
-        verbose_printf("\n");
-        break;
+// match a sequence of ir instructions starting at ip against the known superinstructions.
+// returns the number of instructions that were fused, or zero if nothing matched.
+// branch targets are given as ir addresses, they are resolved once all code has been emitted.
+static size_t match_fusion(const Module* m, size_t ip, const u8* is_target, Code* out) {
+  #define MAX_FUSION_LENGTH 5
+  const Op* op = &m->ins[ip];
+  // nothing but the first instruction of a sequence may be jumped to
+  size_t n = 1;
+  while (n < MAX_FUSION_LENGTH && ip + n < m->ins_count && !is_target[ip + n]) {
+    n += 1;
+  }
+
+  #define INS(N) (op[N].i)
+  #define IS_LOCAL64(N) (INS(N) == I_PUSH_LOCAL && op[N].dest == sizeof(size_t))
+  #define IS_MOVE_LOCAL64(N) (INS(N) == I_MOVE_LOCAL && op[N].dest == sizeof(size_t))
+  #define IMM(N) (*(const size_t*)&m->imm[op[N].src0])
+  #define FUSE(LENGTH, OP, C, A, B) do { *out = (Code) { .op = (OP), .c = (u32)(C), .a = (A), .b = (B), }; return (LENGTH); } while (0)
+
+  // store64 @x + k x
+  // store64 @x + x k
+  if (n >= 5 && INS(0) == I_PUSH_LOCAL_ADDR_OF && INS(3) == I_ADD && INS(4) == I_STORE64) {
+    if (INS(1) == I_PUSH_IMM && IS_LOCAL64(2) && op[2].src0 == op[0].src0) {
+      FUSE(5, C_ADD_LOCAL_IMM, 0, op[0].src0, IMM(1));
+    }
+    if (IS_LOCAL64(1) && INS(2) == I_PUSH_IMM && op[1].src0 == op[0].src0) {
+      FUSE(5, C_ADD_LOCAL_IMM, 0, op[0].src0, IMM(2));
+    }
+  }
+  if (n >= 4 && INS(2) == I_ADD && IS_MOVE_LOCAL64(3)) {
+    if (IS_LOCAL64(0) && INS(1) == I_PUSH_IMM && op[0].src0 == op[3].src0) {
+      FUSE(4, C_ADD_LOCAL_IMM, 0, op[0].src0, IMM(1));
+    }
+    if (INS(0) == I_PUSH_IMM && IS_LOCAL64(1) && op[1].src0 == op[3].src0) {
+      FUSE(4, C_ADD_LOCAL_IMM, 0, op[1].src0, IMM(0));
+    }
+  }
+  // while < x y, while < x k, if eq x k
+  if (n >= 4 && IS_LOCAL64(0) && INS(3) == I_JZ) {
+    const size_t target = jump_target(&op[3], ip + 3);
+    if (IS_LOCAL64(1) && INS(2) == I_LT) {
+      FUSE(4, C_JZ_LT_LOCALS, op[0].src0, target, op[1].src0);
+    }
+    if (INS(1) == I_PUSH_IMM && INS(2) == I_LT) {
+      FUSE(4, C_JZ_LT_LOCAL_IMM, op[0].src0, target, IMM(1));
+    }
+    if (INS(1) == I_PUSH_IMM && INS(2) == I_EQ) {
+      FUSE(4, C_JZ_EQ_LOCAL_IMM, op[0].src0, target, IMM(1));
+    }
+  }
+  // store64 @x k
+  // store64 @x y
+  if (n >= 3 && INS(0) == I_PUSH_LOCAL_ADDR_OF && INS(2) == I_STORE64) {
+    if (INS(1) == I_PUSH_IMM) {
+      FUSE(3, C_MOVE_LOCAL_IMM, 0, op[0].src0, IMM(1));
+    }
+    if (IS_LOCAL64(1)) {
+      FUSE(3, C_COPY_LOCAL, 0, op[0].src0, op[1].src0);
+    }
+  }
+  if (n >= 2) {
+    if (IS_MOVE_LOCAL64(1) && INS(0) == I_PUSH_IMM) {
+      FUSE(2, C_MOVE_LOCAL_IMM, 0, op[1].src0, IMM(0));
+    }
+    if (IS_MOVE_LOCAL64(1) && IS_LOCAL64(0)) {
+      FUSE(2, C_COPY_LOCAL, 0, op[1].src0, op[0].src0);
+    }
+    if (IS_LOCAL64(0) && INS(1) == I_LOAD64) {
+      FUSE(2, C_LOAD_LOCAL64, 0, op[0].src0, 0);
+    }
+    if (INS(1) == I_JZ) {
+      const size_t target = jump_target(&op[1], ip + 1);
+      switch (INS(0)) {
+        case I_LT:  FUSE(2, C_JZ_LT, 0, target, 0);
+        case I_GT:  FUSE(2, C_JZ_GT, 0, target, 0);
+        case I_EQ:  FUSE(2, C_JZ_EQ, 0, target, 0);
+        case I_NEQ: FUSE(2, C_JZ_NEQ, 0, target, 0);
+        default: break;
       }
-      case I_STORE8: {
-        size_t b = STACK_POP(1);
-        size_t* a = (size_t*)STACK_POP(1);
-        *(u8*)a = (u8)b;
-        verbose_printf("\n");
-        break;
+    }
+  }
+  return 0;
+
+  #undef INS
+  #undef IS_LOCAL64
+  #undef IS_MOVE_LOCAL64
+  #undef IMM
+  #undef FUSE
+}
+
+// data and code come from the heap, or are laid out from base on when the program has to stay at a fixed address
+static void* program_alloc(Program* p, size_t size) {
+  if (!p->base) {
+    return calloc(size, 1);
+  }
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  u8* at = p->base + p->base_size;
+  size = ALIGN(size, page_size);
+  void* mem = mmap(at, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  ASSERT(mem == at);
+  p->base_size += size;
+  return mem;
+}
+
+void prepare_interpreter(const Module* m, Program* p, bool fuse, u8* base) {
+  ASSERT(p != NULL);
+  memset(p, 0, sizeof(Program));
+  p->base = base;
+  p->entry = NONE;
+  p->ir_count = m->ins_count;
+
+  size_t* cstring_addr = calloc(m->cstring_count + 1, sizeof(size_t));
+  size_t* symbol_addr = calloc(m->symbol_count + 1, sizeof(size_t));
+  size_t* code_index = malloc((m->ins_count + 1) * sizeof(size_t));
+  u8* is_target = calloc(m->ins_count + 1, sizeof(u8));
+  ASSERT(cstring_addr != NULL && symbol_addr != NULL && code_index != NULL && is_target != NULL);
+
+  // static data
+  for (size_t i = 0; i < m->cstring_count; ++i) {
+    const size_t length = *(size_t*)&m->imm[m->cstrings[i]];
+    p->data_size += ALIGN((length + 1), sizeof(size_t));
+  }
+  for (size_t id = 0; id < m->symbol_count; ++id) {
+    p->data_size += symbol_storage_size(&m->symbols[id]);
+  }
+  p->data = program_alloc(p, p->data_size + sizeof(size_t));
+  ASSERT(p->data != NULL);
+
+  u8* it = p->data;
+  for (size_t i = 0; i < m->cstring_count; ++i) {
+    const size_t imm = m->cstrings[i];
+    const size_t length = *(size_t*)&m->imm[imm];
+    const u8* str = &m->imm[imm + sizeof(size_t)];
+    u8* dest = it;
+    cstring_addr[i] = (size_t)it;
+    for (size_t n = 0; n < length; ++n) {
+      *dest++ = str[n];
+      if (str[n] == '\n') {
+        n += 1; // escaped character is left behind by the lexer
       }
-      case I_LOAD64: {
-        size_t* value = (size_t*)STACK_POP(1);
-        STACK_PUSH(*value);
-        verbose_printf("\n");
-        break;
+    }
+    *dest = 0;
+    it += ALIGN((length + 1), sizeof(size_t));
+  }
+  for (size_t id = 0; id < m->symbol_count; ++id) {
+    const Bytecode_symbol* symbol = &m->symbols[id];
+    const size_t size = symbol_storage_size(symbol);
+    if (size == 0) {
+      continue;
+    }
+    symbol_addr[id] = (size_t)it;
+    if (symbol->konst) {
+      // elements are stored in reverse order in the immediate data
+      const size_t width = data_width(symbol->type_base);
+      const size_t count = symbol->size / symbol->type_size;
+      size_t imm = symbol->imm + sizeof(size_t) * count - sizeof(size_t);
+      for (size_t v = 0; v < count; ++v, imm -= sizeof(size_t)) {
+        memcpy(it + v * width, &m->imm[imm], width);
       }
-      case I_LOAD32: {
-        size_t* value = (size_t*)STACK_POP(1);
-        STACK_PUSH(*(u32*)value);
-        verbose_printf("\n");
-        break;
+    }
+    it += size;
+  }
+
+  for (size_t ip = 0; ip < m->ins_count; ++ip) {
+    const Op* op = &m->ins[ip];
+    if (op->i == I_JMP || op->i == I_JZ) {
+      const size_t target = jump_target(op, ip);
+      ASSERT(target <= m->ins_count);
+      is_target[target] = 1;
+    }
+  }
+
+  // map every ir instruction to its decoded counterpart
+  size_t count = 0;
+  for (size_t ip = 0; ip < m->ins_count;) {
+    code_index[ip] = count;
+    const size_t ins = m->ins[ip].i;
+    Code fused;
+    const size_t length = fuse ? match_fusion(m, ip, is_target, &fused) : 0;
+    if (length > 0) {
+      for (size_t i = 1; i < length; ++i) {
+        code_index[ip + i] = count;
       }
-      case I_LOAD16: {
-        size_t* value = (size_t*)STACK_POP(1);
-        STACK_PUSH(*(u16*)value);
-        verbose_printf("\n");
+      count += 1;
+      ip += length;
+      continue;
+    }
+    if (ins != I_NOP && ins != I_LABEL && ins != I_LOOP_LABEL) {
+      count += 1;
+    }
+    ip += 1;
+  }
+  code_index[m->ins_count] = count;
+  p->code = program_alloc(p, (count + 1) * sizeof(Code));
+  ASSERT(p->code != NULL);
+
+  for (size_t id = 0; id < m->symbol_count; ++id) {
+    const Bytecode_symbol* symbol = &m->symbols[id];
+    if (symbol->sym_type == SYM_FUNC && symbol->ir_address < m->ins_count) {
+      symbol_addr[id] = (size_t)&p->code[code_index[symbol->ir_address]];
+    }
+  }
+  if (m->entry_point < m->ins_count) {
+    p->entry = code_index[m->entry_point];
+  }
+
+  for (size_t ip = 0; ip < m->ins_count; ++ip) {
+    const Op* op = &m->ins[ip];
+    Code fused;
+    const size_t length = fuse ? match_fusion(m, ip, is_target, &fused) : 0;
+    if (length > 0) {
+      code_emit(p, fused.op, fused.c, fused.a, fused.b);
+      p->fusion_count[fused.op] += 1;
+      ip += length - 1;
+      continue;
+    }
+    switch (op->i) {
+      case I_NOP:
+      case I_LABEL:
+      case I_LOOP_LABEL:
         break;
-      }
-      case I_LOAD8: {
-        size_t* value = (size_t*)STACK_POP(1);
-        STACK_PUSH(*(u8*)value);
-        verbose_printf("\n");
+      case I_POP: code_emit(p, C_POP, 0, 0, 0); break;
+      // <size, local_id, x>
+      case I_MOVE_LOCAL: {
+        static const u32 move_local[] = { [1] = C_MOVE_LOCAL8, [2] = C_MOVE_LOCAL16, [4] = C_MOVE_LOCAL32, [8] = C_MOVE_LOCAL };
+        ASSERT(op->dest < LENGTH(move_local) && move_local[op->dest] != C_HALT);
+        code_emit(p, move_local[op->dest], 0, op->src0, 0);
         break;
       }
+      case I_STORE64: code_emit(p, C_STORE64, 0, 0, 0); break;
+      case I_STORE32: code_emit(p, C_STORE32, 0, 0, 0); break;
+      case I_STORE16: code_emit(p, C_STORE16, 0, 0, 0); break;
+      case I_STORE8:  code_emit(p, C_STORE8, 0, 0, 0); break;
+      case I_LOAD64:  code_emit(p, C_LOAD64, 0, 0, 0); break;
+      case I_LOAD32:  code_emit(p, C_LOAD32, 0, 0, 0); break;
+      case I_LOAD16:  code_emit(p, C_LOAD16, 0, 0, 0); break;
+      case I_LOAD8:   code_emit(p, C_LOAD8, 0, 0, 0); break;
       // <x, id, x>
       case I_PUSH_ADDR_OF: {
-        const size_t id = op->src0;
-        Symbol* symbol = &c->symbols[id];
-        switch (symbol->sym_type) {
-          case SYM_FUNC: {
-            Function func = symbol->value.func;
-            const size_t addr = (size_t)(size_t*)&c->ins[func.ir_address];
-            STACK_PUSH(addr);
-            break;
-          }
-          case SYM_GLOBAL_VAR: {
-            const size_t addr = (size_t)(size_t*)&c->imm[symbol->imm];
-            STACK_PUSH(addr);
-            break;
-          }
-          default: {
-            ASSERT(!"can not take the address of this kind of symbol");
-            break;
-          }
-        }
-        verbose_printf("\n");
+        const Bytecode_symbol* symbol = &m->symbols[op->src0];
+        ASSERT(symbol->sym_type == SYM_FUNC || symbol->sym_type == SYM_GLOBAL_VAR || symbol->konst);
+        code_emit(p, C_PUSH_IMM, 0, symbol_addr[op->src0], 0);
         break;
       }
       // <x, local_id, x>
       case I_PUSH_LOCAL_ADDR_OF: {
-        size_t local_id = op->src0;
-        const size_t offset = (bsp - 1) + (local_id / sizeof(size_t));
-        size_t* addr = &stack[offset];
-        STACK_PUSH((size_t)addr);
-        verbose_printf("\n");
+        code_emit(p, C_PUSH_LOCAL_ADDR_OF, 0, op->src0, 0);
         break;
       }
       // <type, id, size>
       case I_PUSH: {
         const size_t type = op->dest;
-        const size_t id   = op->src0;
+        const size_t id = op->src0;
         if (type == TypeCString) {
-          // TODO(lucas): working with strings does not work fully yet, put cstrings at another location and format them properly
-          const size_t imm = c->cstrings[id] + sizeof(size_t);
-          size_t* addr = (size_t*)&c->imm[imm];
-          STACK_PUSH((size_t)addr);
+          code_emit(p, C_PUSH_IMM, 0, cstring_addr[id], 0);
         }
         else if (type == TypeFunc) {
-          Symbol* symbol = &c->symbols[id];
-          Function func = symbol->value.func;
-          size_t* addr = (size_t*)&c->ins[func.ir_address];
-          verbose_printf("ir_address = %zu, %zu", func.ir_address, *addr);
-          STACK_PUSH((size_t)addr);
+          code_emit(p, C_PUSH_IMM, 0, symbol_addr[id], 0);
         }
         else {
-          const size_t size = op->src1;
-          const Symbol* symbol = &c->symbols[id];
-          const size_t imm = symbol->imm;
-          const size_t* value = (size_t*)&c->imm[imm];
-          size_t mask = ~0;
-          mask >>= 64 - (size * 8);
-          STACK_PUSH(*value & mask);
+          code_emit(p, C_PUSH_GLOBAL, 0, symbol_addr[id], mask_from_size(op->src1));
         }
-        verbose_printf("\n");
         break;
       }
       // <size, local_id, x>
       case I_PUSH_LOCAL: {
-        const size_t size = op->dest;
-        const size_t local_id = op->src0;
-        const size_t offset = (bsp - 1) + (local_id / sizeof(size_t));
-        const size_t value = stack[offset];
-        size_t mask = ~0;
-        mask >>= 64 - (size * 8);
-        STACK_PUSH(value & mask);
-        size_t top = STACK_TOP(0);
-        (void)top;
-        verbose_printf("value = %zu, size = %zu, local_id = %zu, offset = %zu, top = %zu\n", value, size, local_id, offset, top);
+        static const u32 push_local[] = { [1] = C_PUSH_LOCAL8, [2] = C_PUSH_LOCAL16, [4] = C_PUSH_LOCAL32, [8] = C_PUSH_LOCAL };
+        ASSERT(op->dest < LENGTH(push_local) && push_local[op->dest] != C_HALT);
+        code_emit(p, push_local[op->dest], 0, op->src0, 0);
         break;
       }
       // <size, imm, x>
       case I_PUSH_IMM: {
-        const size_t size = op->dest;
-        const size_t imm = op->src0;
-        ASSERT(size == 8);
-        size_t value = *(size_t*)&c->imm[imm];
-        STACK_PUSH(value);
-        verbose_printf("%zu\n", value);
-        break;
-      }
-      case I_ADD: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a + b);
-        verbose_printf("%zu + %zu = %zu\n", a, b, a + b);
-        break;
-      }
-      case I_SUB: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a - b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_MUL: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a * b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_LSHIFT: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a << b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_RSHIFT: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a >> b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_DIV: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a / b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_DIVMOD: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a % b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_LT: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a < b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_GT: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a > b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_AND: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a && b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_LOGICAL_NOT: {
-        size_t a = STACK_POP(1);
-        STACK_PUSH(!a);
-        verbose_printf("\n");
-        break;
-      }
-      case I_NOT: {
-        size_t a = STACK_POP(1);
-        STACK_PUSH(~a);
-        verbose_printf("\n");
-        break;
-      }
-      case I_OR: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a || b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_XOR: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a ^ b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_EQ: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a == b);
-        verbose_printf("\n");
-        break;
-      }
-      case I_NEQ: {
-        size_t b = STACK_POP(1);
-        size_t a = STACK_POP(1);
-        STACK_PUSH(a != b);
-        verbose_printf("\n");
-        break;
-      }
-      // <x, frame_size, x>
-      case I_RET: {
-        const size_t frame_size = op->src0;
-        const size_t frame_count = (frame_size / sizeof(size_t));
-        Register* r = REG_FROM_TYPE(RAX);
-        r->v64 = STACK_POP(1);
-        sp -= frame_count;
-        verbose_printf("frame_size = %zu, frame_count = %zu, rax = %zu\n", frame_size, frame_count, r->v64);
-        return;
-      }
-      // <x, frame_size, x>
-      case I_NORET: {
-        const size_t frame_size = op->src0;
-        const size_t frame_count = (frame_size / sizeof(size_t));
-        sp -= frame_count;
-        verbose_printf("frame_size = %zu, frame_count = %zu\n", frame_size, frame_count);
-        return;
-      }
-      case I_PRINT: {
-        size_t value = STACK_POP(1);
-        (void)value;
-        printf("%zu\n", value);
-        break;
-      }
-      case I_LABEL: {
-        verbose_printf("\n");
+        ASSERT(op->dest == sizeof(size_t));
+        code_emit(p, C_PUSH_IMM, 0, *(size_t*)&m->imm[op->src0], 0);
         break;
       }
+      case I_ADD:         code_emit(p, C_ADD, 0, 0, 0); break;
+      case I_SUB:         code_emit(p, C_SUB, 0, 0, 0); break;
+      case I_MUL:         code_emit(p, C_MUL, 0, 0, 0); break;
+      case I_LSHIFT:      code_emit(p, C_LSHIFT, 0, 0, 0); break;
+      case I_RSHIFT:      code_emit(p, C_RSHIFT, 0, 0, 0); break;
+      case I_DIV:         code_emit(p, C_DIV, 0, 0, 0); break;
+      case I_DIVMOD:      code_emit(p, C_DIVMOD, 0, 0, 0); break;
+      case I_LT:          code_emit(p, C_LT, 0, 0, 0); break;
+      case I_GT:          code_emit(p, C_GT, 0, 0, 0); break;
+      case I_AND:         code_emit(p, C_AND, 0, 0, 0); break;
+      case I_LOGICAL_NOT: code_emit(p, C_LOGICAL_NOT, 0, 0, 0); break;
+      case I_NOT:         code_emit(p, C_NOT, 0, 0, 0); break;
+      case I_OR:          code_emit(p, C_OR, 0, 0, 0); break;
+      case I_XOR:         code_emit(p, C_XOR, 0, 0, 0); break;
+      case I_EQ:          code_emit(p, C_EQ, 0, 0, 0); break;
+      case I_NEQ:         code_emit(p, C_NEQ, 0, 0, 0); break;
+      case I_RET:         code_emit(p, C_RET, 0, 0, 0); break;
+      case I_NORET:       code_emit(p, C_NORET, 0, 0, 0); break;
+      case I_PRINT:       code_emit(p, C_PRINT, 0, 0, 0); break;
       // <label, argc, rtype>
       case I_CALL: {
-        const size_t label = op->dest;
-        const size_t argc = op->src0;
-        const size_t has_return_value = op->src1 != NONE;
-        Symbol* symbol = &c->symbols[label];
-        Function func = symbol->value.func;
-        size_t ip_jump = func.ir_address;
-        for (size_t i = 0; i < argc; ++i) {
-          Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          r->v64 = STACK_POP(1);
-          verbose_printf("%s = %zu, ", regs_str[func_call_regs[i]], r->v64);
-        }
-        verbose_printf("%s (addr: %zu)\n", symbol->name, ip_jump);
-        interpret(c, ip_jump, depth + 1);
-        if (has_return_value) {
-          STACK_PUSH(*REG_VALUE_FROM_TYPE(RAX, 64));
-        }
+        const Bytecode_symbol* func = &m->symbols[op->dest];
+        ASSERT(func->ir_address < m->ins_count);
+        code_emit(p, C_CALL, op->src0, func->ir_address, op->src1 != NONE);
         break;
       }
       // <x, argc, rtype>
       case I_ADDR_CALL: {
-        const size_t argc = op->src0;
-        const size_t has_return_value = op->src1 != NONE;
-        const size_t* addr = (size_t*)STACK_POP(1);
-        const size_t ip_jump = ((size_t)addr - (size_t)&c->ins[0]) / sizeof(Op);
-        for (size_t i = 0; i < argc; ++i) {
-          Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          r->v64 = STACK_POP(1);
-          verbose_printf("%s = %zu, ", regs_str[func_call_regs[i]], r->v64);
-        }
-        verbose_printf("ip: %zu, addr: %zu\n", ip, *addr);
-        interpret(c, ip_jump, depth + 1);
-        if (has_return_value) {
-          STACK_PUSH(*REG_VALUE_FROM_TYPE(RAX, 64));
-        }
+        code_emit(p, C_ADDR_CALL, op->src0, 0, op->src1 != NONE);
         break;
       }
-
       // <label, positive_offset, negative_offset>
       case I_JMP: {
-        size_t positive_offset = op->src0;
-        size_t negative_offset = op->src1;
-        if (positive_offset != NONE) {
-          ip += positive_offset - 1;
-          verbose_printf("+%zu, %zu -> %zu\n", positive_offset, ip - positive_offset + 1, ip + 1);
-          break;
-        }
-        ip -= negative_offset + 1;
-        verbose_printf("-%zu, %zu -> %zu\n", negative_offset, ip + negative_offset + 1, ip + 1);
+        code_emit(p, C_JMP, 0, jump_target(op, ip), 0);
         break;
       }
       // <label, offset, x>
       case I_JZ: {
-        size_t offset = op->src0;
-        size_t value = STACK_POP(1);
-        if (value == 0) {
-          ip += offset - 1;
-        }
-        verbose_printf("%zu == 0, offset = %zu, %zu -> %zu\n", value, offset, ip - (size_t)(value == 0) * (offset - 1), ip + (size_t)(value == 0));
+        code_emit(p, C_JZ, 0, jump_target(op, ip), 0);
         break;
       }
       // <x, argc, frame_size>
       case I_BEGIN_FUNC: {
-        const size_t argc = op->src0;
-        const size_t frame_size = op->src1;
-        const size_t frame_count = frame_size / sizeof(size_t);
-        bsp = sp;
-        for (size_t i = 0; i < argc; ++i) {
-          const Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          STACK_PUSH(r->v64);
-          verbose_printf("mov %s, %zu; push %s; ", regs_str[func_call_regs[i]], r->v64, regs_str[func_call_regs[i]]);
-        }
-        sp = bsp + frame_count;
-        verbose_printf("\n");
+        code_emit(p, C_BEGIN_FUNC, op->src0, op->src1, 0);
         break;
       }
-      case I_LOOP_LABEL: {
-        verbose_printf("\n");
+      case I_SYSCALL0:
+      case I_SYSCALL1:
+      case I_SYSCALL2:
+      case I_SYSCALL3:
+      case I_SYSCALL4:
+      case I_SYSCALL5:
+      case I_SYSCALL6: {
+        code_emit(p, C_SYSCALL, op->i - I_SYSCALL0, 0, 0);
         break;
       }
-      case I_SYSCALL0: {
-        const size_t code = STACK_POP(1);
-        *REG_VALUE_FROM_TYPE(RAX, 64) = code;
-        size_t rvalue = syscall(code);
-        STACK_PUSH(rvalue);
-        verbose_printf("syscall(%zu)\n", code);
+      // <size, x, x>
+      case I_MEMCPY: code_emit(p, C_MEMCPY, 0, op->dest, 0); break;
+      case I_MEMSET: code_emit(p, C_MEMSET, 0, op->dest, 0); break;
+      case I_STRLEN: code_emit(p, C_STRLEN, 0, 0, 0); break;
+      case I_ATOMIC_ADD: code_emit(p, C_ATOMIC_ADD, 0, 0, 0); break;
+      case I_ATOMIC_CAS: code_emit(p, C_ATOMIC_CAS, 0, 0, 0); break;
+      case I_THREAD_CLONE: code_emit(p, C_THREAD_CLONE, 0, 0, 0); break;
+      default: {
+        ASSERT(!"unknown instruction");
         break;
       }
-      case I_SYSCALL1: {
-        const size_t code = STACK_POP(1);
-        *REG_VALUE_FROM_TYPE(RAX, 64) = code;
-        for (size_t i = 0; i < 1; ++i) {
-          Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          r->v64 = STACK_POP(1);
+    }
+  }
+  ASSERT(p->count == count);
+  code_emit(p, C_HALT, 0, 0, 0);
+
+  // resolve ir addresses of branches and calls
+  for (size_t i = 0; i < p->count; ++i) {
+    Code* code = &p->code[i];
+    if (code_has_target(code->op)) {
+      code->a = code_index[code->a];
+    }
+  }
+
+  // remember where every instruction came from, superinstructions point at the first instruction of their sequence
+  p->ir_address = malloc(p->count * sizeof(size_t));
+  p->ir_op = malloc(p->count * sizeof(u8));
+  p->func_name = calloc(p->count, sizeof(char*));
+  ASSERT(p->ir_address != NULL && p->ir_op != NULL && p->func_name != NULL);
+  p->ir_address[p->count - 1] = m->ins_count;
+  p->ir_op[p->count - 1] = I_NOP;
+  for (size_t ip = m->ins_count; ip-- > 0;) {
+    const size_t ins = m->ins[ip].i;
+    if (ins != I_NOP && ins != I_LABEL && ins != I_LOOP_LABEL) {
+      p->ir_address[code_index[ip]] = ip;
+      p->ir_op[code_index[ip]] = (u8)ins;
+    }
+  }
+  for (size_t id = 0; id < m->symbol_count; ++id) {
+    const Bytecode_symbol* symbol = &m->symbols[id];
+    if (symbol->sym_type == SYM_FUNC && symbol->ir_address < m->ins_count && symbol->name < m->names_size) {
+      p->func_name[code_index[symbol->ir_address]] = strndup(&m->names[symbol->name], m->names_size - symbol->name);
+    }
+  }
+
+  free(is_target);
+  free(code_index);
+  free(symbol_addr);
+  free(cstring_addr);
+}
+
+void print_code_stats(i32 fd, const Program* p) {
+  size_t fusion_total = 0;
+  dprintf(fd, "ir instructions:      %zu\n", p->ir_count);
+  dprintf(fd, "decoded instructions: %zu\n", p->count);
+  for (size_t op = C_ADD_LOCAL_IMM; op < MAX_CODE_OP; ++op) {
+    dprintf(fd, "  %-20s %zu\n", code_op_str[op], p->fusion_count[op]);
+    fusion_total += p->fusion_count[op];
+  }
+  dprintf(fd, "superinstructions:    %zu\n", fusion_total);
+  if (p->reg_code) {
+    dprintf(fd, "register instructions: %zu\n", p->reg_count);
+  }
+}
+
+// profiler for the stack engine, every instruction goes through op_profile before its handler.
+// function entries and returns are timed with the time stamp counter where there is one.
+#define PROFILE_MAX_ROWS (20)
+
+#if defined(__x86_64__)
+  #define PROFILE_UNIT "cycles"
+  static inline u64 profile_clock(void) {
+    return __rdtsc();
+  }
+#else
+  #define PROFILE_UNIT "ns"
+  static inline u64 profile_clock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000 + (u64)ts.tv_nsec;
+  }
+#endif
+
+Profile* profile_new(const Program* p, const char* folded_path) {
+  Profile* profile = calloc(1, sizeof(Profile));
+  ASSERT(profile != NULL);
+  profile->hits = calloc(p->count, sizeof(size_t));
+  profile->calls = calloc(p->count, sizeof(size_t));
+  profile->active = calloc(p->count, sizeof(size_t));
+  profile->inclusive = calloc(p->count, sizeof(u64));
+  profile->exclusive = calloc(p->count, sizeof(u64));
+  profile->node_capacity = 256;
+  profile->nodes = malloc(profile->node_capacity * sizeof(Profile_node));
+  profile->frame_capacity = 64;
+  profile->frames = malloc(profile->frame_capacity * sizeof(Profile_frame));
+  ASSERT(profile->hits != NULL && profile->calls != NULL && profile->active != NULL && profile->inclusive != NULL && profile->exclusive != NULL);
+  ASSERT(profile->nodes != NULL && profile->frames != NULL);
+  // root of the calling context tree
+  profile->nodes[profile->node_count++] = (Profile_node) { .func = NONE, .parent = NONE, .first_child = NONE, .next_sibling = NONE, .self = 0, };
+  profile->folded_path = folded_path;
+  profile->start = profile_clock();
+  return profile;
+}
+
+void profile_free(Profile* profile) {
+  free(profile->hits);
+  free(profile->calls);
+  free(profile->active);
+  free(profile->inclusive);
+  free(profile->exclusive);
+  free(profile->nodes);
+  free(profile->frames);
+  free(profile);
+}
+
+static size_t profile_child(Profile* profile, size_t parent, size_t func) {
+  for (size_t child = profile->nodes[parent].first_child; child != NONE; child = profile->nodes[child].next_sibling) {
+    if (profile->nodes[child].func == func) {
+      return child;
+    }
+  }
+  if (profile->node_count == profile->node_capacity) {
+    profile->node_capacity *= 2;
+    profile->nodes = realloc(profile->nodes, profile->node_capacity * sizeof(Profile_node));
+    ASSERT(profile->nodes != NULL);
+  }
+  const size_t node = profile->node_count++;
+  profile->nodes[node] = (Profile_node) {
+    .func = func,
+    .parent = parent,
+    .first_child = NONE,
+    .next_sibling = profile->nodes[parent].first_child,
+    .self = 0,
+  };
+  profile->nodes[parent].first_child = node;
+  return node;
+}
+
+static void profile_enter(Profile* profile, size_t func) {
+  if (profile->frame_count == profile->frame_capacity) {
+    profile->frame_capacity *= 2;
+    profile->frames = realloc(profile->frames, profile->frame_capacity * sizeof(Profile_frame));
+    ASSERT(profile->frames != NULL);
+  }
+  const size_t parent = profile->frame_count > 0 ? profile->frames[profile->frame_count - 1].node : 0;
+  const size_t node = profile_child(profile, parent, func);
+  profile->calls[func] += 1;
+  profile->active[func] += 1;
+  profile->frames[profile->frame_count++] = (Profile_frame) { .node = node, .start = profile_clock(), .children = 0, };
+}
+
+static void profile_leave(Profile* profile, u64 now) {
+  if (profile->frame_count == 0) {
+    return;
+  }
+  const Profile_frame* frame = &profile->frames[--profile->frame_count];
+  Profile_node* node = &profile->nodes[frame->node];
+  const u64 elapsed = now - frame->start;
+  const u64 self = elapsed - MIN(frame->children, elapsed);
+  node->self += self;
+  profile->exclusive[node->func] += self;
+  profile->active[node->func] -= 1;
+  if (profile->active[node->func] == 0) {
+    profile->inclusive[node->func] += elapsed;
+  }
+  if (profile->frame_count > 0) {
+    profile->frames[profile->frame_count - 1].children += elapsed;
+  }
+}
+
+static const char* profile_func_name(const Program* p, size_t func) {
+  return (func < p->count && p->func_name[func]) ? p->func_name[func] : "?";
+}
+
+// function that the instruction at the given code index belongs to
+static size_t profile_func_of(const Program* p, size_t index) {
+  while (index > 0 && p->code[index].op != C_BEGIN_FUNC) {
+    index -= 1;
+  }
+  return index;
+}
+
+static i32 compare_desc(u64 a, u64 b) {
+  return (a < b) - (a > b);
+}
+
+static const Profile* sort_profile;
+static const u64* sort_keys;
+
+static i32 compare_by_key(const void* a, const void* b) {
+  return compare_desc(sort_keys[*(const size_t*)a], sort_keys[*(const size_t*)b]);
+}
+
+static i32 compare_by_hits(const void* a, const void* b) {
+  return compare_desc(sort_profile->hits[*(const size_t*)a], sort_profile->hits[*(const size_t*)b]);
+}
+
+static void profile_write_folded(const Program* p, const Profile* profile, FILE* fp) {
+  size_t* path = malloc(profile->node_count * sizeof(size_t));
+  ASSERT(path != NULL);
+  for (size_t i = 1; i < profile->node_count; ++i) {
+    const Profile_node* node = &profile->nodes[i];
+    if (node->self == 0) {
+      continue;
+    }
+    size_t depth = 0;
+    for (size_t n = i; n != 0; n = profile->nodes[n].parent) {
+      path[depth++] = profile->nodes[n].func;
+    }
+    while (depth-- > 0) {
+      fprintf(fp, "%s%s", profile_func_name(p, path[depth]), depth > 0 ? ";" : "");
+    }
+    fprintf(fp, " %llu\n", (unsigned long long)node->self);
+  }
+  free(path);
+}
+
+// summary of a profiled run on fd, and the call stacks in folded format (one `a;b;c weight` line per stack) next to it
+void profile_report(const Program* p, i32 fd) {
+  Profile* profile = p->profile;
+  if (profile->reported) {
+    return;
+  }
+  profile->reported = true;
+  const char* folded_path = profile->folded_path;
+  const u64 now = profile_clock();
+  while (profile->frame_count > 0) {
+    profile_leave(profile, now);
+  }
+  profile->total = now - profile->start;
+
+  u64 ir_hits[MAX_IR_CODE] = {0};
+  u64 instructions = 0;
+  for (size_t i = 0; i < p->count; ++i) {
+    ir_hits[p->ir_op[i]] += profile->hits[i];
+    instructions += profile->hits[i];
+  }
+  size_t order[MAX_IR_CODE];
+  for (size_t i = 0; i < MAX_IR_CODE; ++i) {
+    order[i] = i;
+  }
+  sort_keys = ir_hits;
+  qsort(order, MAX_IR_CODE, sizeof(size_t), compare_by_key);
+  dprintf(fd, "profile: %llu instructions, %llu " PROFILE_UNIT "\n\n", (unsigned long long)instructions, (unsigned long long)profile->total);
+  dprintf(fd, "%-24s %14s %7s\n", "instruction", "count", "%");
+  for (size_t i = 0; i < MAX_IR_CODE && ir_hits[order[i]] > 0; ++i) {
+    const size_t ins = order[i];
+    dprintf(fd, "%-24s %14llu %6.2f%%\n", ir_code_str[ins], (unsigned long long)ir_hits[ins], 100.0 * ir_hits[ins] / MAX(instructions, 1));
+  }
+
+  size_t* funcs = malloc(p->count * sizeof(size_t));
+  ASSERT(funcs != NULL);
+  size_t func_count = 0;
+  for (size_t i = 0; i < p->count; ++i) {
+    if (profile->calls[i] > 0) {
+      funcs[func_count++] = i;
+    }
+  }
+  sort_keys = profile->inclusive;
+  qsort(funcs, func_count, sizeof(size_t), compare_by_key);
+  dprintf(fd, "\n%-24s %10s %16s %16s %7s\n", "function", "calls", "inclusive", "exclusive", "excl %");
+  for (size_t i = 0; i < func_count && i < PROFILE_MAX_ROWS; ++i) {
+    const size_t func = funcs[i];
+    dprintf(fd, "%-24s %10zu %16llu %16llu %6.2f%%\n",
+      profile_func_name(p, func),
+      profile->calls[func],
+      (unsigned long long)profile->inclusive[func],
+      (unsigned long long)profile->exclusive[func],
+      100.0 * profile->exclusive[func] / MAX(profile->total, 1)
+    );
+  }
+
+  // a backward jump closes a loop, the loop header is its target
+  size_t loop_count = 0;
+  for (size_t i = 0; i < p->count; ++i) {
+    if (p->code[i].op == C_JMP && p->code[i].a <= i && profile->hits[i] > 0) {
+      funcs[loop_count++] = i;
+    }
+  }
+  sort_profile = profile;
+  qsort(funcs, loop_count, sizeof(size_t), compare_by_hits);
+  dprintf(fd, "\n%-24s %12s %14s\n", "loop in function", "header (ir)", "iterations");
+  for (size_t i = 0; i < loop_count && i < PROFILE_MAX_ROWS; ++i) {
+    const size_t jmp = funcs[i];
+    const size_t header = p->code[jmp].a;
+    dprintf(fd, "%-24s %12zu %14zu\n", profile_func_name(p, profile_func_of(p, header)), p->ir_address[header], profile->hits[jmp]);
+  }
+  free(funcs);
+
+  FILE* fp = fopen(folded_path, "w");
+  if (!fp) {
+    dprintf(fd, "\nfailed to open `%s`\n", folded_path);
+    return;
+  }
+  profile_write_folded(p, profile, fp);
+  fclose(fp);
+  dprintf(fd, "\nfolded call stacks written to `%s`\n", folded_path);
+}
+
+// template jit, encodes the same instruction sequences codegen_fasm_x86_64.spl emits for every instruction.
+// compiled functions follow the c calling convention, so the interpreter can call them directly, and
+// operate on the native stack. a function is compiled together with every function it can call, which
+// keeps calls between compiled functions native. whenever any of them can not be compiled, all of them
+// stay interpreted.
+
+typedef size_t (*Jit_func)(size_t, size_t, size_t, size_t, size_t, size_t);
+
+typedef enum Reg {
+  RAX = 0,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+} Reg;
+
+static const u8 call_arg_regs[MAX_FUNC_ARGC] = { RDI, RSI, RDX, RCX, R8, R9, };
+static const u8 syscall_arg_regs[MAX_FUNC_ARGC] = { RDI, RSI, RDX, R10, R8, R9, };
+
+// condition codes, used as the second byte of a near jump (0x0f 0x8x) and of setcc (0x0f 0x9x)
+#define CC_E  (0x4)
+#define CC_NE (0x5)
+#define CC_L  (0xc)
+#define CC_GE (0xd)
+#define CC_LE (0xe)
+#define CC_G  (0xf)
+
+typedef struct Jit_fixup {
+  size_t position; // position of the rel32 to patch
+  size_t target; // code index of the jump target
+} Jit_fixup;
+
+Jit* jit_new(const Program* p, size_t threshold) {
+  Jit* jit = calloc(1, sizeof(Jit));
+  ASSERT(jit != NULL);
+  jit->code = mmap(NULL, JIT_CODE_CAPACITY, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  ASSERT(jit->code != MAP_FAILED);
+  jit->capacity = JIT_CODE_CAPACITY;
+  jit->threshold = MAX(threshold, 1);
+  jit->entry = calloc(p->count, sizeof(void*));
+  jit->calls = calloc(p->count, sizeof(u32));
+  jit->failed = calloc(p->count, sizeof(bool));
+  jit->address_taken = calloc(p->count, sizeof(bool));
+  ASSERT(jit->entry != NULL && jit->calls != NULL && jit->failed != NULL && jit->address_taken != NULL);
+  // functions whose addresses are pushed are the only possible targets of indirect calls
+  const size_t code_end = (size_t)(p->code + p->count);
+  for (size_t i = 0; i < p->count; ++i) {
+    const Code* code = &p->code[i];
+    if (code->op == C_PUSH_IMM && code->a >= (size_t)p->code && code->a < code_end && (code->a - (size_t)p->code) % sizeof(Code) == 0) {
+      const size_t target = (const Code*)code->a - p->code;
+      jit->address_taken[target] = p->code[target].op == C_BEGIN_FUNC;
+    }
+  }
+  return jit;
+}
+
+void jit_free(Jit* jit) {
+  munmap(jit->code, jit->capacity);
+  free(jit->entry);
+  free(jit->calls);
+  free(jit->failed);
+  free(jit->address_taken);
+  free(jit);
+}
+
+// natively the threads of a program end with it through exit_group, here a program is only one context of many and
+// its guest threads are stopped with THREAD_STOP_SIGNAL instead. the handler unwinds straight back to context_run()
+// or context_thread() of the thread it arrives on. host calls that allocate or take locks are put between
+// HOST_ENTER() and HOST_LEAVE(), a stop that arrives during one of them is taken once it returns
+#define THREAD_STOP_SIGNAL (SIGUSR1)
+
+static __thread sigjmp_buf* thread_stop_target;
+static __thread volatile sig_atomic_t thread_host_depth;
+static __thread volatile sig_atomic_t thread_stop_pending;
+
+#define HOST_ENTER() (thread_host_depth += 1)
+
+#define HOST_LEAVE() do {                                                                  \
+    thread_host_depth -= 1;                                                                \
+    if (UNLIKELY(thread_stop_pending) && thread_host_depth == 0 && thread_stop_target) {   \
+      siglongjmp(*thread_stop_target, 1);                                                  \
+    }                                                                                      \
+  } while (0)
+
+static void thread_stop_handler(i32 signal) {
+  (void)signal;
+  if (thread_host_depth == 0 && thread_stop_target) {
+    siglongjmp(*thread_stop_target, 1);
+  }
+  thread_stop_pending = 1;
+}
+
+static void jit_print(size_t value) {
+  HOST_ENTER();
+  dprintf(STDOUT_FILENO, "%zu\n", value);
+  HOST_LEAVE();
+}
+
+// compiled code ends the program by unwinding straight back to context_run() of the context running on this thread
+static __thread jmp_buf* jit_exit_target;
+static __thread i32 jit_exit_code;
+
+static void jit_exit(size_t code) {
+  jit_exit_code = (i32)code;
+  longjmp(*jit_exit_target, 1);
+}
+
+static void emit8(Jit* jit, u8 value) {
+  if (jit->size < jit->capacity) {
+    jit->code[jit->size] = value;
+  }
+  jit->size += 1;
+}
+
+static void emit32(Jit* jit, u32 value) {
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    emit8(jit, (u8)(value >> (i * 8)));
+  }
+}
+
+static void emit64(Jit* jit, u64 value) {
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    emit8(jit, (u8)(value >> (i * 8)));
+  }
+}
+
+#define EMIT(...) do {                                 \
+  static const u8 bytes_[] = { __VA_ARGS__ };          \
+  for (size_t i_ = 0; i_ < sizeof(bytes_); ++i_) {     \
+    emit8(jit, bytes_[i_]);                            \
+  }                                                    \
+} while (0)
+
+static void emit_push(Jit* jit, u8 reg) {
+  if (reg >= R8) {
+    emit8(jit, 0x41);
+  }
+  emit8(jit, 0x50 + (reg & 7));
+}
+
+static void emit_pop(Jit* jit, u8 reg) {
+  if (reg >= R8) {
+    emit8(jit, 0x41);
+  }
+  emit8(jit, 0x58 + (reg & 7));
+}
+
+// mov reg, imm64
+static void emit_mov_imm(Jit* jit, u8 reg, u64 imm) {
+  emit8(jit, 0x48 | (reg >= R8));
+  emit8(jit, 0xb8 + (reg & 7));
+  emit64(jit, imm);
+}
+
+// <opcode> reg, [rbp - local_id], with an optional rex prefix (0 for none)
+static void emit_local(Jit* jit, u8 rex, u8 opcode, u8 reg, size_t local_id) {
+  if (reg >= R8) {
+    rex |= 0x44;
+  }
+  if (rex) {
+    emit8(jit, rex);
+  }
+  emit8(jit, opcode);
+  emit8(jit, 0x85 | ((reg & 7) << 3));
+  emit32(jit, (u32)-(i32)local_id);
+}
+
+static void emit_jump(Jit* jit, Jit_fixup* fixups, size_t* fixup_count, u8 cc, size_t target) {
+  if (cc) {
+    emit8(jit, 0x0f);
+    emit8(jit, 0x80 | cc);
+  }
+  else {
+    emit8(jit, 0xe9);
+  }
+  fixups[(*fixup_count)++] = (Jit_fixup) { .position = jit->size, .target = target, };
+  emit32(jit, 0);
+}
+
+// call a c function with the stack aligned to 16 bytes, the operand stack leaves the alignment unknown
+static void emit_aligned_call(Jit* jit, const void* func) {
+  emit_mov_imm(jit, RAX, (u64)func);
+  EMIT(0x48, 0x89, 0xe1); // mov rcx, rsp
+  EMIT(0x48, 0x83, 0xe4, 0xf0); // and rsp, -16
+  EMIT(0x51, 0x51); // push rcx, push rcx
+  EMIT(0xff, 0xd0); // call rax
+  EMIT(0x5c); // pop rsp
+}
+
+static size_t function_end(const Program* p, size_t begin) {
+  size_t i = begin + 1;
+  while (i < p->count && p->code[i].op != C_BEGIN_FUNC && p->code[i].op != C_HALT) {
+    i += 1;
+  }
+  return i;
+}
+
+static bool jit_emit_function(Jit* jit, const Program* p, size_t begin, size_t* native_at, Jit_fixup* fixups, size_t* fixup_count) {
+  const size_t end = function_end(p, begin);
+  for (size_t i = begin; i < end; ++i) {
+    const Code* code = &p->code[i];
+    native_at[i] = jit->size;
+    switch (code->op) {
+      case C_POP:
+        emit_pop(jit, RAX);
+        break;
+      case C_MOVE_LOCAL:
+        emit_pop(jit, RAX);
+        emit_local(jit, 0x48, 0x89, RAX, code->a); // mov [rbp - a], rax
+        break;
+      case C_MOVE_LOCAL32:
+        emit_pop(jit, RAX);
+        emit_local(jit, 0, 0x89, RAX, code->a); // mov [rbp - a], eax
+        break;
+      case C_MOVE_LOCAL16:
+        emit_pop(jit, RAX);
+        emit8(jit, 0x66);
+        emit_local(jit, 0, 0x89, RAX, code->a); // mov [rbp - a], ax
+        break;
+      case C_MOVE_LOCAL8:
+        emit_pop(jit, RAX);
+        emit_local(jit, 0, 0x88, RAX, code->a); // mov [rbp - a], al
+        break;
+      case C_STORE64:
+        EMIT(0x59, 0x58, 0x48, 0x89, 0x08); // pop rcx, pop rax, mov [rax], rcx
+        break;
+      case C_STORE32:
+        EMIT(0x59, 0x58, 0x89, 0x08); // pop rcx, pop rax, mov [rax], ecx
+        break;
+      case C_STORE16:
+        EMIT(0x59, 0x58, 0x66, 0x89, 0x08); // pop rcx, pop rax, mov [rax], cx
+        break;
+      case C_STORE8:
+        EMIT(0x59, 0x58, 0x88, 0x08); // pop rcx, pop rax, mov [rax], cl
+        break;
+      case C_LOAD64:
+        EMIT(0x58, 0x48, 0x8b, 0x00, 0x50); // pop rax, mov rax, [rax], push rax
+        break;
+      case C_LOAD32:
+        EMIT(0x58, 0x8b, 0x00, 0x50); // pop rax, mov eax, [rax], push rax
+        break;
+      case C_LOAD16:
+        EMIT(0x58, 0x0f, 0xb7, 0x00, 0x50); // pop rax, movzx eax, word [rax], push rax
+        break;
+      case C_LOAD8:
+        EMIT(0x58, 0x0f, 0xb6, 0x00, 0x50); // pop rax, movzx eax, byte [rax], push rax
+        break;
+      case C_PUSH_LOCAL_ADDR_OF:
+        emit_local(jit, 0x48, 0x8d, RAX, code->a); // lea rax, [rbp - a]
+        emit_push(jit, RAX);
+        break;
+      case C_PUSH_LOCAL:
+        emit_local(jit, 0, 0xff, 6, code->a); // push qword [rbp - a]
+        break;
+      case C_PUSH_LOCAL32:
+        emit_local(jit, 0, 0x8b, RAX, code->a); // mov eax, [rbp - a]
+        emit_push(jit, RAX);
+        break;
+      case C_PUSH_LOCAL16:
+        emit8(jit, 0x0f);
+        emit_local(jit, 0, 0xb7, RAX, code->a); // movzx eax, word [rbp - a]
+        emit_push(jit, RAX);
+        break;
+      case C_PUSH_LOCAL8:
+        emit8(jit, 0x0f);
+        emit_local(jit, 0, 0xb6, RAX, code->a); // movzx eax, byte [rbp - a]
+        emit_push(jit, RAX);
+        break;
+      case C_PUSH_GLOBAL:
+        emit_mov_imm(jit, RAX, code->a);
+        EMIT(0x48, 0x8b, 0x00); // mov rax, [rax]
+        if (code->b != ~(size_t)0) {
+          emit_mov_imm(jit, RCX, code->b);
+          EMIT(0x48, 0x21, 0xc8); // and rax, rcx
+        }
+        emit_push(jit, RAX);
+        break;
+      case C_PUSH_IMM:
+        if ((i64)code->a == (i32)code->a) {
+          emit8(jit, 0x68); // push imm32, sign extended
+          emit32(jit, (u32)code->a);
+        }
+        else {
+          emit_mov_imm(jit, RAX, code->a);
+          emit_push(jit, RAX);
         }
-        size_t rvalue = syscall(
-          code,
-          *REG_VALUE_FROM_TYPE(func_call_regs[0], 64)
-        );
-        STACK_PUSH(rvalue);
-        verbose_printf("syscall(%zu)\n", code);
-        break;
-      }
-      case I_SYSCALL2: {
-        const size_t code = STACK_POP(1);
-        *REG_VALUE_FROM_TYPE(RAX, 64) = code;
-        for (size_t i = 0; i < 2; ++i) {
-          Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          r->v64 = STACK_POP(1);
+        break;
+      case C_ADD:         EMIT(0x59, 0x58, 0x48, 0x01, 0xc8, 0x50); break; // add rax, rcx
+      case C_SUB:         EMIT(0x59, 0x58, 0x48, 0x29, 0xc8, 0x50); break; // sub rax, rcx
+      case C_MUL:         EMIT(0x59, 0x58, 0x48, 0x0f, 0xaf, 0xc1, 0x50); break; // imul rax, rcx
+      case C_LSHIFT:      EMIT(0x59, 0x58, 0x48, 0xd3, 0xe0, 0x50); break; // shl rax, cl
+      case C_RSHIFT:      EMIT(0x59, 0x58, 0x48, 0xd3, 0xe8, 0x50); break; // shr rax, cl
+      case C_DIV:         EMIT(0x59, 0x58, 0x31, 0xd2, 0x48, 0xf7, 0xf1, 0x50); break; // xor edx, edx, div rcx
+      case C_DIVMOD:      EMIT(0x59, 0x58, 0x31, 0xd2, 0x48, 0xf7, 0xf1, 0x52); break; // xor edx, edx, div rcx, push rdx
+      case C_LT:          EMIT(0x59, 0x58, 0x48, 0x39, 0xc8, 0x0f, 0x90 | CC_L, 0xc0, 0x0f, 0xb6, 0xc0, 0x50); break; // cmp rax, rcx, setl al, movzx eax, al
+      case C_GT:          EMIT(0x59, 0x58, 0x48, 0x39, 0xc8, 0x0f, 0x90 | CC_G, 0xc0, 0x0f, 0xb6, 0xc0, 0x50); break;
+      case C_EQ:          EMIT(0x59, 0x58, 0x48, 0x39, 0xc8, 0x0f, 0x90 | CC_E, 0xc0, 0x0f, 0xb6, 0xc0, 0x50); break;
+      case C_NEQ:         EMIT(0x59, 0x58, 0x48, 0x39, 0xc8, 0x0f, 0x90 | CC_NE, 0xc0, 0x0f, 0xb6, 0xc0, 0x50); break;
+      case C_AND:         EMIT(0x59, 0x58, 0x48, 0x21, 0xc8, 0x50); break; // and rax, rcx
+      case C_OR:          EMIT(0x59, 0x58, 0x48, 0x09, 0xc8, 0x50); break; // or rax, rcx
+      case C_XOR:         EMIT(0x59, 0x58, 0x48, 0x31, 0xc8, 0x50); break; // xor rax, rcx
+      case C_LOGICAL_NOT: EMIT(0x58, 0x48, 0x85, 0xc0, 0x0f, 0x90 | CC_E, 0xc0, 0x0f, 0xb6, 0xc0, 0x50); break; // test rax, rax, sete al, movzx eax, al
+      case C_NOT:         EMIT(0x58, 0x48, 0xf7, 0xd0, 0x50); break; // not rax
+      case C_RET:
+        EMIT(0x58, 0xc9, 0xc3); // pop rax, leave, ret
+        break;
+      case C_NORET:
+        EMIT(0xc9, 0xc3); // leave, ret
+        break;
+      case C_PRINT:
+        emit_pop(jit, RDI);
+        emit_aligned_call(jit, (const void*)jit_print);
+        break;
+      case C_CALL:
+        for (size_t arg = 0; arg < code->c; ++arg) {
+          emit_pop(jit, call_arg_regs[arg]);
         }
-        size_t rvalue = syscall(
-          code,
-          *REG_VALUE_FROM_TYPE(func_call_regs[0], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[1], 64)
-        );
-        STACK_PUSH(rvalue);
-        verbose_printf("syscall(%zu)\n", code);
-        break;
-      }
-      case I_SYSCALL3: {
-        const size_t code = STACK_POP(1);
-        *REG_VALUE_FROM_TYPE(RAX, 64) = code;
-        for (size_t i = 0; i < 3; ++i) {
-          Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          r->v64 = STACK_POP(1);
+        emit_mov_imm(jit, RAX, (u64)&jit->entry[code->a]);
+        EMIT(0xff, 0x10); // call [rax]
+        if (code->b) {
+          emit_push(jit, RAX);
         }
-        size_t rvalue = syscall(
-          code,
-          *REG_VALUE_FROM_TYPE(func_call_regs[0], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[1], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[2], 64)
-        );
-        STACK_PUSH(rvalue);
-        verbose_printf("syscall(%zu)\n", code);
-        break;
-      }
-      case I_SYSCALL4: {
-        const size_t code = STACK_POP(1);
-        *REG_VALUE_FROM_TYPE(RAX, 64) = code;
-        for (size_t i = 0; i < 4; ++i) {
-          Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          r->v64 = STACK_POP(1);
+        break;
+      case C_ADDR_CALL:
+        emit_pop(jit, RAX);
+        for (size_t arg = 0; arg < code->c; ++arg) {
+          emit_pop(jit, call_arg_regs[arg]);
         }
-        size_t rvalue =syscall(
-          code,
-          *REG_VALUE_FROM_TYPE(func_call_regs[0], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[1], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[2], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[3], 64)
-        );
-        STACK_PUSH(rvalue);
-        verbose_printf("syscall(%zu)\n", code);
-        break;
-      }
-      case I_SYSCALL5: {
-        const size_t code = STACK_POP(1);
-        *REG_VALUE_FROM_TYPE(RAX, 64) = code;
-        for (size_t i = 0; i < 5; ++i) {
-          Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          r->v64 = STACK_POP(1);
+        // function values are addresses of stack code, turn them into an index of the entry table
+        emit_mov_imm(jit, R11, (u64)p->code);
+        EMIT(0x4c, 0x29, 0xd8); // sub rax, r11
+        EMIT(0x48, 0xc1, 0xe8, (u8)__builtin_ctzll(sizeof(Code))); // shr rax, log2(sizeof(Code))
+        emit_mov_imm(jit, R11, (u64)jit->entry);
+        EMIT(0x41, 0xff, 0x14, 0xc3); // call [r11 + rax * 8]
+        if (code->b) {
+          emit_push(jit, RAX);
         }
-        size_t rvalue = syscall(
-          code,
-          *REG_VALUE_FROM_TYPE(func_call_regs[0], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[1], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[2], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[3], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[4], 64)
-        );
-        STACK_PUSH(rvalue);
-        verbose_printf("syscall(%zu)\n", code);
         break;
-      }
-      case I_SYSCALL6: {
-        const size_t code = STACK_POP(1);
-        *REG_VALUE_FROM_TYPE(RAX, 64) = code;
-        for (size_t i = 0; i < 6; ++i) {
-          Register* r = REG_FROM_TYPE(func_call_regs[i]);
-          r->v64 = STACK_POP(1);
+      case C_JMP:
+        emit_jump(jit, fixups, fixup_count, 0, code->a);
+        break;
+      case C_JZ:
+        EMIT(0x58, 0x48, 0x85, 0xc0); // pop rax, test rax, rax
+        emit_jump(jit, fixups, fixup_count, CC_E, code->a);
+        break;
+      case C_BEGIN_FUNC:
+        EMIT(0x55, 0x48, 0x89, 0xe5); // push rbp, mov rbp, rsp
+        EMIT(0x48, 0x81, 0xec); // sub rsp, frame_size
+        emit32(jit, (u32)code->a);
+        for (size_t arg = 0; arg < code->c; ++arg) {
+          emit_local(jit, 0x48, 0x89, call_arg_regs[arg], sizeof(size_t) * (arg + 1)); // mov [rbp - 8 * (arg + 1)], reg
+        }
+        break;
+      case C_SYSCALL:
+        emit_pop(jit, RAX);
+        for (size_t arg = 0; arg < code->c; ++arg) {
+          emit_pop(jit, syscall_arg_regs[arg]);
+        }
+        {
+          // exit syscalls end the context instead of the process
+          EMIT(0x48, 0x3d); emit32(jit, SYS_exit); // cmp rax, SYS_exit
+          EMIT(0x74, 0x00); // je exit
+          const size_t to_exit = jit->size;
+          EMIT(0x48, 0x3d); emit32(jit, SYS_exit_group); // cmp rax, SYS_exit_group
+          EMIT(0x74, 0x00); // je exit
+          const size_t to_exit_group = jit->size;
+          EMIT(0x0f, 0x05); // syscall
+          EMIT(0xeb, 0x00); // jmp done
+          const size_t to_done = jit->size;
+          emit_aligned_call(jit, jit_exit); // exit: does not return
+          if (jit->size <= jit->capacity) {
+            jit->code[to_exit - 1] = (u8)(to_done - to_exit);
+            jit->code[to_exit_group - 1] = (u8)(to_done - to_exit_group);
+            jit->code[to_done - 1] = (u8)(jit->size - to_done);
+          }
+          EMIT(0x50); // done: push rax
+        }
+        break;
+      case C_MEMCPY:
+      case C_MEMSET:
+        emit_pop(jit, RDI);
+        emit_pop(jit, code->op == C_MEMCPY ? RSI : RAX);
+        if (code->a == NONE) {
+          emit_pop(jit, RCX);
+        }
+        else {
+          emit_mov_imm(jit, RCX, code->a);
+        }
+        if (code->op == C_MEMCPY) {
+          EMIT(0xf3, 0xa4); // rep movsb
+        }
+        else {
+          EMIT(0xf3, 0xaa); // rep stosb
         }
-        size_t rvalue = syscall(
-          code,
-          *REG_VALUE_FROM_TYPE(func_call_regs[0], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[1], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[2], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[3], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[4], 64),
-          *REG_VALUE_FROM_TYPE(func_call_regs[5], 64)
-        );
-        STACK_PUSH(rvalue);
-        verbose_printf("syscall(%zu)\n", code);
+        break;
+      case C_STRLEN:
+        emit_pop(jit, RDI);
+        emit_aligned_call(jit, (const void*)strlen);
+        emit_push(jit, RAX);
+        break;
+      case C_ATOMIC_ADD:
+        EMIT(0x58, 0x59, 0xf0, 0x48, 0x0f, 0xc1, 0x08, 0x51); // pop rax, pop rcx, lock xadd [rax], rcx, push rcx
+        break;
+      case C_ATOMIC_CAS:
+        EMIT(0x5a, 0x58, 0x59, 0xf0, 0x48, 0x0f, 0xb1, 0x0a, 0x50); // pop rdx, pop rax, pop rcx, lock cmpxchg [rdx], rcx, push rax
+        break;
+      case C_THREAD_CLONE:
+        // threads are started by the interpreter
+        return false;
+      case C_ADD_LOCAL_IMM:
+        emit_mov_imm(jit, RAX, code->b);
+        emit_local(jit, 0x48, 0x01, RAX, code->a); // add [rbp - a], rax
+        break;
+      case C_MOVE_LOCAL_IMM:
+        emit_mov_imm(jit, RAX, code->b);
+        emit_local(jit, 0x48, 0x89, RAX, code->a);
+        break;
+      case C_COPY_LOCAL:
+        emit_local(jit, 0x48, 0x8b, RAX, code->b); // mov rax, [rbp - b]
+        emit_local(jit, 0x48, 0x89, RAX, code->a);
+        break;
+      case C_LOAD_LOCAL64:
+        emit_local(jit, 0x48, 0x8b, RAX, code->a);
+        EMIT(0x48, 0x8b, 0x00, 0x50); // mov rax, [rax], push rax
+        break;
+      case C_JZ_LT:
+      case C_JZ_GT:
+      case C_JZ_EQ:
+      case C_JZ_NEQ: {
+        static const u8 cc_unless[] = { [C_JZ_LT] = CC_GE, [C_JZ_GT] = CC_LE, [C_JZ_EQ] = CC_NE, [C_JZ_NEQ] = CC_E, };
+        EMIT(0x59, 0x58, 0x48, 0x39, 0xc8); // pop rcx, pop rax, cmp rax, rcx
+        emit_jump(jit, fixups, fixup_count, cc_unless[code->op], code->a);
         break;
       }
-      default: {
-        ASSERT(!"unknown instruction");
+      case C_JZ_LT_LOCALS:
+        emit_local(jit, 0x48, 0x8b, RAX, code->c);
+        emit_local(jit, 0x48, 0x3b, RAX, code->b); // cmp rax, [rbp - b]
+        emit_jump(jit, fixups, fixup_count, CC_GE, code->a);
         break;
+      case C_JZ_LT_LOCAL_IMM:
+      case C_JZ_EQ_LOCAL_IMM:
+        emit_local(jit, 0x48, 0x8b, RAX, code->c);
+        emit_mov_imm(jit, RCX, code->b);
+        EMIT(0x48, 0x39, 0xc8); // cmp rax, rcx
+        emit_jump(jit, fixups, fixup_count, code->op == C_JZ_LT_LOCAL_IMM ? CC_GE : CC_NE, code->a);
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+// compile the function at the given code index, and every function it may call that is not compiled yet
+bool jit_compile(Program* p, size_t func) {
+  Jit* jit = p->jit;
+  bool result = true;
+  size_t* funcs = malloc(p->count * sizeof(size_t));
+  bool* queued = calloc(p->count, sizeof(bool));
+  size_t* native_at = malloc(p->count * sizeof(size_t));
+  Jit_fixup* fixups = malloc(p->count * sizeof(Jit_fixup));
+  ASSERT(funcs != NULL && queued != NULL && native_at != NULL && fixups != NULL);
+  size_t func_count = 0;
+  size_t fixup_count = 0;
+  const size_t size = jit->size;
+
+  funcs[func_count++] = func;
+  queued[func] = true;
+  for (size_t f = 0; f < func_count; ++f) {
+    const size_t end = function_end(p, funcs[f]);
+    for (size_t i = funcs[f]; i < end; ++i) {
+      const Code* code = &p->code[i];
+      if (code->op == C_CALL && !jit->entry[code->a] && !queued[code->a]) {
+        if (jit->failed[code->a]) {
+          return_defer(false);
+        }
+        funcs[func_count++] = code->a;
+        queued[code->a] = true;
+      }
+      else if (code->op == C_ADDR_CALL) {
+        for (size_t target = 0; target < p->count; ++target) {
+          if (jit->address_taken[target] && !jit->entry[target] && !queued[target]) {
+            if (jit->failed[target]) {
+              return_defer(false);
+            }
+            funcs[func_count++] = target;
+            queued[target] = true;
+          }
+        }
       }
     }
   }
+
+  if (mprotect(jit->code, jit->capacity, PROT_READ | PROT_WRITE) != 0) {
+    return_defer(false);
+  }
+  for (size_t f = 0; f < func_count; ++f) {
+    if (!jit_emit_function(jit, p, funcs[f], native_at, fixups, &fixup_count)) {
+      return_defer(false);
+    }
+  }
+  if (jit->size > jit->capacity) {
+    return_defer(false);
+  }
+  for (size_t i = 0; i < fixup_count; ++i) {
+    const Jit_fixup* fixup = &fixups[i];
+    const i32 rel = (i32)((i64)native_at[fixup->target] - (i64)(fixup->position + sizeof(u32)));
+    memcpy(&jit->code[fixup->position], &rel, sizeof(rel));
+  }
+  for (size_t f = 0; f < func_count; ++f) {
+    jit->entry[funcs[f]] = &jit->code[native_at[funcs[f]]];
+  }
+  jit->func_count += func_count;
+defer:
+  if (!result) {
+    jit->size = size;
+  }
+  mprotect(jit->code, jit->capacity, PROT_READ | PROT_EXEC);
+  free(fixups);
+  free(native_at);
+  free(queued);
+  free(funcs);
+  return result;
 }
 
-void compile_state_free(Compile* c) {
-  free(c);
+// native entry of a function, compiling it once it has been called often enough
+static inline Jit_func jit_function(Program* p, size_t func) {
+  Jit* jit = p->jit;
+  if (LIKELY(jit->entry[func] != NULL)) {
+    return (Jit_func)jit->entry[func];
+  }
+  if (jit->frozen || jit->failed[func] || ++jit->calls[func] < jit->threshold) {
+    return NULL;
+  }
+  if (!jit_compile(p, func)) {
+    jit->failed[func] = true;
+    return NULL;
+  }
+  return (Jit_func)jit->entry[func];
+}
+
+Result interpret(Context* ctx, const Code* entry) {
+  Program* p = &ctx->program;
+  (void)ir_code_str;
+  (void)code_op_str;
+
+  static const void* dispatch_table[MAX_CODE_OP] = {
+    [C_HALT]               = &&op_halt,
+    [C_POP]                = &&op_pop,
+    [C_MOVE_LOCAL]         = &&op_move_local,
+    [C_MOVE_LOCAL32]       = &&op_move_local32,
+    [C_MOVE_LOCAL16]       = &&op_move_local16,
+    [C_MOVE_LOCAL8]        = &&op_move_local8,
+    [C_STORE64]            = &&op_store64,
+    [C_STORE32]            = &&op_store32,
+    [C_STORE16]            = &&op_store16,
+    [C_STORE8]             = &&op_store8,
+    [C_LOAD64]             = &&op_load64,
+    [C_LOAD32]             = &&op_load32,
+    [C_LOAD16]             = &&op_load16,
+    [C_LOAD8]              = &&op_load8,
+    [C_PUSH_LOCAL_ADDR_OF] = &&op_push_local_addr_of,
+    [C_PUSH_LOCAL]         = &&op_push_local,
+    [C_PUSH_LOCAL32]       = &&op_push_local32,
+    [C_PUSH_LOCAL16]       = &&op_push_local16,
+    [C_PUSH_LOCAL8]        = &&op_push_local8,
+    [C_PUSH_GLOBAL]        = &&op_push_global,
+    [C_PUSH_IMM]           = &&op_push_imm,
+    [C_ADD]                = &&op_add,
+    [C_SUB]                = &&op_sub,
+    [C_MUL]                = &&op_mul,
+    [C_LSHIFT]             = &&op_lshift,
+    [C_RSHIFT]             = &&op_rshift,
+    [C_DIV]                = &&op_div,
+    [C_DIVMOD]             = &&op_divmod,
+    [C_LT]                 = &&op_lt,
+    [C_GT]                 = &&op_gt,
+    [C_AND]                = &&op_and,
+    [C_LOGICAL_NOT]        = &&op_logical_not,
+    [C_NOT]                = &&op_not,
+    [C_OR]                 = &&op_or,
+    [C_XOR]                = &&op_xor,
+    [C_EQ]                 = &&op_eq,
+    [C_NEQ]                = &&op_neq,
+    [C_RET]                = &&op_ret,
+    [C_NORET]              = &&op_noret,
+    [C_PRINT]              = &&op_print,
+    [C_CALL]               = &&op_call,
+    [C_ADDR_CALL]          = &&op_addr_call,
+    [C_JMP]                = &&op_jmp,
+    [C_JZ]                 = &&op_jz,
+    [C_BEGIN_FUNC]         = &&op_begin_func,
+    [C_SYSCALL]            = &&op_syscall,
+    [C_MEMCPY]             = &&op_memcpy,
+    [C_MEMSET]             = &&op_memset,
+    [C_STRLEN]             = &&op_strlen,
+    [C_ATOMIC_ADD]         = &&op_atomic_add,
+    [C_ATOMIC_CAS]         = &&op_atomic_cas,
+    [C_THREAD_CLONE]       = &&op_thread_clone,
+
+    [C_ADD_LOCAL_IMM]      = &&op_add_local_imm,
+    [C_MOVE_LOCAL_IMM]     = &&op_move_local_imm,
+    [C_COPY_LOCAL]         = &&op_copy_local,
+    [C_LOAD_LOCAL64]       = &&op_load_local64,
+    [C_JZ_LT]              = &&op_jz_lt,
+    [C_JZ_GT]              = &&op_jz_gt,
+    [C_JZ_EQ]              = &&op_jz_eq,
+    [C_JZ_NEQ]             = &&op_jz_neq,
+    [C_JZ_LT_LOCALS]       = &&op_jz_lt_locals,
+    [C_JZ_LT_LOCAL_IMM]    = &&op_jz_lt_local_imm,
+    [C_JZ_EQ_LOCAL_IMM]    = &&op_jz_eq_local_imm,
+  };
+
+  // thread the code once, replacing opcodes with the addresses of their handlers
+  if (UNLIKELY(!p->threaded)) {
+    for (size_t i = 0; i < p->count; ++i) {
+      p->code[i].handler = dispatch_table[p->code[i].op];
+    }
+    // calls check for compiled functions only when there is a jit
+    if (p->jit) {
+      for (size_t i = 0; i < p->count; ++i) {
+        if (p->code[i].op == C_CALL) {
+          p->code[i].handler = &&op_call_jit;
+        }
+        else if (p->code[i].op == C_ADDR_CALL) {
+          p->code[i].handler = &&op_addr_call_jit;
+        }
+      }
+    }
+    // every instruction passes through the profiler first, which then dispatches on the opcode
+    if (p->profile) {
+      for (size_t i = 0; i < p->count; ++i) {
+        p->code[i].handler = &&op_profile;
+      }
+    }
+    if (ctx->snapshot_at != NONE) {
+      p->code[ctx->snapshot_at].handler = &&op_snapshot;
+    }
+    p->threaded = true;
+  }
+
+  // the guest stack grows downwards and holds both frames and operands, the same way the native stack does
+  #define STACK_HEADROOM (Kb(4))
+  const size_t stack_size = ctx->stack_size;
+  const u8* stack_limit = ctx->stack + MIN(STACK_HEADROOM, stack_size / 2);
+
+  size_t* sp = (size_t*)(ctx->stack + stack_size); // stack pointer
+  u8* fp = (u8*)sp; // frame pointer
+
+  // return addresses and frame pointers live on a separate frame stack, owned by the context
+  size_t frame_count = 0;
+  size_t frame_capacity = ctx->frame_capacity;
+  Frame* frames = ctx->frames;
+
+  Result result = Ok;
+  size_t rax = 0;
+  size_t args[MAX_FUNC_ARGC] = { ctx->thread_arg, };
+  const Code* ip = entry;
+
+  if (ctx->resume) {
+    const Snapshot_state* state = ctx->resume;
+    ip = (const Code*)state->ip;
+    sp = (size_t*)state->sp;
+    fp = (u8*)state->fp;
+    rax = state->rax;
+    memcpy(args, state->args, sizeof(args));
+    frame_count = state->frame_count;
+    ctx->resume = NULL;
+  }
+
+  #define STACK_PUSH(V) (*--sp = (size_t)(V))
+  #define STACK_POP() (*sp++)
+  #define STACK_TOP() (sp[0])
+  #define LOCAL(TYPE, LOCAL_ID) (*(TYPE*)(fp - (LOCAL_ID)))
+
+  #define FRAME_PUSH(CALL) do {                                       \
+    if (UNLIKELY(frame_count == frame_capacity)) {                   \
+      HOST_ENTER();                                                  \
+      frame_capacity *= 2;                                           \
+      frames = realloc(frames, frame_capacity * sizeof(Frame));      \
+      ASSERT(frames != NULL);                                        \
+      ctx->frames = frames;                                          \
+      ctx->frame_capacity = frame_capacity;                          \
+      HOST_LEAVE();                                                  \
+    }                                                                \
+    frames[frame_count++] = (Frame) { .call = (CALL), .fp = fp, };   \
+  } while (0)
+
+  #define DISPATCH() do {                                                                                 \
+    THINK(100);                                                                                           \
+    tabs(frame_count);                                                                                    \
+    verbose_printf("%4zu: %s: %zu, %zu\n", (size_t)(ip - p->code), code_op_str[ip->op], ip->a, ip->b);  \
+    goto *ip->handler;                                                                                    \
+  } while (0)
+
+  #define NEXT() do { ++ip; DISPATCH(); } while (0)
+
+  // jump to the target unless the condition holds
+  #define BRANCH_UNLESS(COND) do { \
+    if (COND) {                    \
+      NEXT();                      \
+    }                              \
+    ip = &p->code[ip->a];          \
+    DISPATCH();                    \
+  } while (0)
+
+  #define BRANCH_BINOP_UNLESS(EXPR) do { \
+    size_t b = STACK_POP();              \
+    size_t a = STACK_POP();              \
+    BRANCH_UNLESS(EXPR);                 \
+  } while (0)
+
+  #define BINOP(EXPR) do {     \
+    size_t b = STACK_POP();    \
+    size_t a = STACK_TOP();    \
+    STACK_TOP() = (size_t)(EXPR); \
+    NEXT();                    \
+  } while (0)
+
+  DISPATCH();
+
+op_pop:
+  rax = STACK_POP();
+  NEXT();
+op_move_local:
+  LOCAL(size_t, ip->a) = STACK_POP();
+  NEXT();
+op_move_local32:
+  LOCAL(u32, ip->a) = (u32)STACK_POP();
+  NEXT();
+op_move_local16:
+  LOCAL(u16, ip->a) = (u16)STACK_POP();
+  NEXT();
+op_move_local8:
+  LOCAL(u8, ip->a) = (u8)STACK_POP();
+  NEXT();
+op_store64: {
+  size_t b = STACK_POP();
+  size_t* a = (size_t*)STACK_POP();
+  *a = b;
+  NEXT();
+}
+op_store32: {
+  size_t b = STACK_POP();
+  size_t* a = (size_t*)STACK_POP();
+  *(u32*)a = (u32)b;
+  NEXT();
+}
+op_store16: {
+  size_t b = STACK_POP();
+  size_t* a = (size_t*)STACK_POP();
+  *(u16*)a = (u16)b;
+  NEXT();
+}
+op_store8: {
+  size_t b = STACK_POP();
+  size_t* a = (size_t*)STACK_POP();
+  *(u8*)a = (u8)b;
+  NEXT();
+}
+op_load64:
+  STACK_TOP() = *(size_t*)STACK_TOP();
+  NEXT();
+op_load32:
+  STACK_TOP() = *(u32*)STACK_TOP();
+  NEXT();
+op_load16:
+  STACK_TOP() = *(u16*)STACK_TOP();
+  NEXT();
+op_load8:
+  STACK_TOP() = *(u8*)STACK_TOP();
+  NEXT();
+op_push_local_addr_of:
+  STACK_PUSH(fp - ip->a);
+  NEXT();
+op_push_local:
+  STACK_PUSH(LOCAL(size_t, ip->a));
+  NEXT();
+op_push_local32:
+  STACK_PUSH(LOCAL(u32, ip->a));
+  NEXT();
+op_push_local16:
+  STACK_PUSH(LOCAL(u16, ip->a));
+  NEXT();
+op_push_local8:
+  STACK_PUSH(LOCAL(u8, ip->a));
+  NEXT();
+op_push_global:
+  STACK_PUSH(*(size_t*)ip->a & ip->b);
+  NEXT();
+op_push_imm:
+  STACK_PUSH(ip->a);
+  NEXT();
+op_add:         BINOP(a + b);
+op_sub:         BINOP(a - b);
+op_mul:         BINOP(a * b);
+op_lshift:      BINOP(a << b);
+op_rshift:      BINOP(a >> b);
+op_div:         BINOP(a / b);
+op_divmod:      BINOP(a % b);
+op_lt:          BINOP((i64)a < (i64)b);
+op_gt:          BINOP((i64)a > (i64)b);
+op_and:         BINOP(a & b);
+op_or:          BINOP(a | b);
+op_xor:         BINOP(a ^ b);
+op_eq:          BINOP(a == b);
+op_neq:         BINOP(a != b);
+op_logical_not:
+  STACK_TOP() = !STACK_TOP();
+  NEXT();
+op_not:
+  STACK_TOP() = ~STACK_TOP();
+  NEXT();
+op_ret:
+  rax = STACK_POP();
+  // fallthrough
+op_noret:
+  sp = (size_t*)fp;
+  if (frame_count == 0) {
+    goto op_halt;
+  }
+  frame_count -= 1;
+  fp = frames[frame_count].fp;
+  ip = frames[frame_count].call;
+  if (ip->b) {
+    STACK_PUSH(rax);
+  }
+  NEXT();
+op_print: {
+  size_t value = STACK_POP();
+  HOST_ENTER();
+  dprintf(STDOUT_FILENO, "%zu\n", value);
+  HOST_LEAVE();
+  NEXT();
+}
+op_call:
+  for (size_t i = 0; i < ip->c; ++i) {
+    args[i] = STACK_POP();
+  }
+  FRAME_PUSH(ip);
+  ip = &p->code[ip->a];
+  DISPATCH();
+op_addr_call: {
+  const Code* target = (const Code*)STACK_POP();
+  for (size_t i = 0; i < ip->c; ++i) {
+    args[i] = STACK_POP();
+  }
+  FRAME_PUSH(ip);
+  ip = target;
+  DISPATCH();
+}
+op_call_jit: {
+  const Jit_func native = jit_function(p, ip->a);
+  if (!native) {
+    goto op_call;
+  }
+  for (size_t i = 0; i < ip->c; ++i) {
+    args[i] = STACK_POP();
+  }
+  rax = native(args[0], args[1], args[2], args[3], args[4], args[5]);
+  if (ip->b) {
+    STACK_PUSH(rax);
+  }
+  NEXT();
+}
+op_addr_call_jit: {
+  const Jit_func native = jit_function(p, (const Code*)STACK_TOP() - p->code);
+  if (!native) {
+    goto op_addr_call;
+  }
+  sp += 1;
+  for (size_t i = 0; i < ip->c; ++i) {
+    args[i] = STACK_POP();
+  }
+  rax = native(args[0], args[1], args[2], args[3], args[4], args[5]);
+  if (ip->b) {
+    STACK_PUSH(rax);
+  }
+  NEXT();
+}
+op_jmp:
+  ip = &p->code[ip->a];
+  DISPATCH();
+op_jz:
+  if (STACK_POP() == 0) {
+    ip = &p->code[ip->a];
+    DISPATCH();
+  }
+  NEXT();
+op_begin_func:
+  fp = (u8*)sp;
+  sp = (size_t*)(fp - ip->a);
+  if (UNLIKELY((u8*)sp < stack_limit)) {
+    HOST_ENTER();
+    fprintf(stderr, "[interpreter-error]: stack overflow (%zu frames deep, stack size is %zu bytes)\n", frame_count, stack_size);
+    HOST_LEAVE();
+    result = Error;
+    goto op_halt;
+  }
+  for (size_t i = 0; i < ip->c; ++i) {
+    LOCAL(size_t, sizeof(size_t) * (i + 1)) = args[i];
+  }
+  NEXT();
+op_syscall: {
+  const size_t code = STACK_POP();
+  for (size_t i = 0; i < ip->c; ++i) {
+    args[i] = STACK_POP();
+  }
+  if (UNLIKELY(code == SYS_exit || code == SYS_exit_group)) {
+    // only this context ends, not the whole process
+    ctx->exited = true;
+    ctx->exit_code = (i32)args[0];
+    goto op_halt;
+  }
+  if (UNLIKELY(ctx->snapshot_at != NONE) && (code == SYS_mmap || code == SYS_munmap || code == SYS_mremap)) {
+    STACK_PUSH(context_map(ctx, code, args));
+    NEXT();
+  }
+  rax = syscall(code, args[0], args[1], args[2], args[3], args[4], args[5]);
+  STACK_PUSH(rax);
+  NEXT();
+}
+op_memcpy: {
+  void* dest = (void*)STACK_POP();
+  const void* src = (const void*)STACK_POP();
+  const size_t n = ip->a != NONE ? ip->a : STACK_POP();
+  memcpy(dest, src, n);
+  NEXT();
+}
+op_memset: {
+  void* dest = (void*)STACK_POP();
+  const size_t c = STACK_POP();
+  const size_t n = ip->a != NONE ? ip->a : STACK_POP();
+  memset(dest, (i32)c, n);
+  NEXT();
+}
+op_strlen:
+  STACK_TOP() = strlen((const char*)STACK_TOP());
+  NEXT();
+op_atomic_add: {
+  size_t* address = (size_t*)STACK_POP();
+  STACK_TOP() = __atomic_fetch_add(address, STACK_TOP(), __ATOMIC_SEQ_CST);
+  NEXT();
+}
+op_atomic_cas: {
+  size_t* address = (size_t*)STACK_POP();
+  size_t expected = STACK_POP();
+  // leaves the old value in `expected` whether or not it was replaced
+  __atomic_compare_exchange_n(address, &expected, STACK_TOP(), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  STACK_TOP() = expected;
+  NEXT();
+}
+op_thread_clone:
+  for (size_t i = 0; i < 4; ++i) {
+    args[i] = STACK_POP();
+  }
+  STACK_PUSH(context_thread_clone(ctx, args));
+  NEXT();
+op_add_local_imm:
+  LOCAL(size_t, ip->a) += ip->b;
+  NEXT();
+op_move_local_imm:
+  LOCAL(size_t, ip->a) = ip->b;
+  NEXT();
+op_copy_local:
+  LOCAL(size_t, ip->a) = LOCAL(size_t, ip->b);
+  NEXT();
+op_load_local64:
+  STACK_PUSH(*(size_t*)LOCAL(size_t, ip->a));
+  NEXT();
+op_jz_lt:               BRANCH_BINOP_UNLESS((i64)a < (i64)b);
+op_jz_gt:               BRANCH_BINOP_UNLESS((i64)a > (i64)b);
+op_jz_eq:               BRANCH_BINOP_UNLESS(a == b);
+op_jz_neq:              BRANCH_BINOP_UNLESS(a != b);
+op_jz_lt_locals:        BRANCH_UNLESS(LOCAL(i64, ip->c) < LOCAL(i64, ip->b));
+op_jz_lt_local_imm:     BRANCH_UNLESS(LOCAL(i64, ip->c) < (i64)ip->b);
+op_jz_eq_local_imm:     BRANCH_UNLESS(LOCAL(size_t, ip->c) == ip->b);
+op_profile:
+  p->profile->hits[ip - p->code] += 1;
+  switch (ip->op) {
+    case C_BEGIN_FUNC:
+      profile_enter(p->profile, ip - p->code);
+      break;
+    case C_RET:
+    case C_NORET:
+      profile_leave(p->profile, profile_clock());
+      break;
+    default:
+      break;
+  }
+  goto *dispatch_table[ip->op];
+op_snapshot: {
+  // only the first time the snapshot point is reached
+  p->code[ip - p->code].handler = dispatch_table[ip->op];
+  const Snapshot_state state = {
+    .ip = (u64)ip,
+    .sp = (u64)sp,
+    .fp = (u64)fp,
+    .rax = rax,
+    .args = { args[0], args[1], args[2], args[3], args[4], args[5], },
+    .frame_count = frame_count,
+  };
+  if (snapshot_write(ctx, &state, frames) != Ok) {
+    result = Error;
+    goto op_halt;
+  }
+  DISPATCH();
+}
+op_halt:
+  return result;
+}
+
+// stack entries are kept symbolic while a basic block is translated, so that locals, immediates and
+// addresses of locals feed instructions directly instead of being copied into registers first.
+// registers only ever hold the entry at their own depth, which keeps every block boundary trivial:
+// all entries are written back to their registers and the next block starts from that state.
+#define MAX_OPERAND_DEPTH (256)
+
+typedef enum Operand_kind {
+  OPERAND_SLOT, // value is held in a local or in a register
+  OPERAND_IMM,
+  OPERAND_ADDR, // address of a local
+} Operand_kind;
+
+typedef struct Operand {
+  u32 kind;
+  size_t value; // slot, immediate value or local id
+} Operand;
+
+typedef struct Translation {
+  Program* p;
+  size_t capacity;
+  Operand stack[MAX_OPERAND_DEPTH];
+  size_t depth;
+  size_t max_depth;
+  size_t frame_size; // size of the locals of the function being translated
+} Translation;
+
+static void reg_emit(Translation* t, u32 op, u32 c, size_t a, size_t b) {
+  Program* p = t->p;
+  if (p->reg_count == t->capacity) {
+    t->capacity *= 2;
+    p->reg_code = realloc(p->reg_code, t->capacity * sizeof(Code));
+    ASSERT(p->reg_code != NULL);
+  }
+  Code* code = &p->reg_code[p->reg_count++];
+  code->handler = NULL;
+  code->op = op;
+  code->c = c;
+  code->a = a;
+  code->b = b;
+}
+
+static size_t reg_slot(const Translation* t, size_t depth) {
+  return t->frame_size + sizeof(size_t) * (depth + 1);
+}
+
+static bool is_register(const Translation* t, size_t slot) {
+  return slot > t->frame_size;
+}
+
+static void operand_push(Translation* t, u32 kind, size_t value) {
+  ASSERT(t->depth < MAX_OPERAND_DEPTH);
+  t->stack[t->depth++] = (Operand) { .kind = kind, .value = value, };
+  t->max_depth = MAX(t->max_depth, t->depth);
+}
+
+static Operand operand_pop(Translation* t) {
+  ASSERT(t->depth > 0);
+  return t->stack[--t->depth];
+}
+
+// write the entry at the given depth into its register
+static void materialize(Translation* t, size_t depth) {
+  Operand* o = &t->stack[depth];
+  const size_t dest = reg_slot(t, depth);
+  switch (o->kind) {
+    case OPERAND_SLOT:
+      if (o->value == dest) {
+        return;
+      }
+      reg_emit(t, R_MOV, dest, 0, o->value);
+      break;
+    case OPERAND_IMM:
+      reg_emit(t, R_MOVI, dest, 0, o->value);
+      break;
+    case OPERAND_ADDR:
+      reg_emit(t, R_LEA, dest, 0, o->value);
+      break;
+    default:
+      ASSERT(!"unreachable");
+  }
+  o->kind = OPERAND_SLOT;
+  o->value = dest;
+}
+
+// make the entry at the given depth readable as a slot
+static size_t operand_slot(Translation* t, size_t depth) {
+  if (t->stack[depth].kind != OPERAND_SLOT) {
+    materialize(t, depth);
+  }
+  return t->stack[depth].value;
+}
+
+// read every pending local before an instruction that may write to memory
+static void flush_locals(Translation* t) {
+  for (size_t i = 0; i < t->depth; ++i) {
+    const Operand* o = &t->stack[i];
+    if (o->kind == OPERAND_SLOT && !is_register(t, o->value)) {
+      materialize(t, i);
+    }
+  }
+}
+
+// write every entry into its register, which is the state all blocks begin and end with
+static void flush_all(Translation* t) {
+  for (size_t i = 0; i < t->depth; ++i) {
+    materialize(t, i);
+  }
+}
+
+static bool fold_binop(u32 op, size_t a, size_t b, size_t* result) {
+  switch (op) {
+    case R_ADD: *result = a + b; return true;
+    case R_SUB: *result = a - b; return true;
+    case R_MUL: *result = a * b; return true;
+    case R_LSHIFT: return_if(b >= 64, false); *result = a << b; return true;
+    case R_RSHIFT: return_if(b >= 64, false); *result = a >> b; return true;
+    case R_DIV: return_if(b == 0, false); *result = a / b; return true;
+    case R_DIVMOD: return_if(b == 0, false); *result = a % b; return true;
+    case R_LT: *result = (i64)a < (i64)b; return true;
+    case R_GT: *result = (i64)a > (i64)b; return true;
+    case R_AND: *result = a & b; return true;
+    case R_OR: *result = a | b; return true;
+    case R_XOR: *result = a ^ b; return true;
+    case R_EQ: *result = a == b; return true;
+    case R_NEQ: *result = a != b; return true;
+    default:
+      break;
+  }
+  return false;
+}
+
+// operator to use when the operands are swapped, or MAX_REG_OP when they can not be
+static u32 swap_binop(u32 op) {
+  switch (op) {
+    case R_ADD:
+    case R_MUL:
+    case R_AND:
+    case R_OR:
+    case R_XOR:
+    case R_EQ:
+    case R_NEQ:
+      return op;
+    case R_LT: return R_GT;
+    case R_GT: return R_LT;
+    default:
+      break;
+  }
+  return MAX_REG_OP;
+}
+
+static u32 branch_from_compare(u32 op) {
+  switch (op) {
+    case R_LT: return R_JZ_LT;
+    case R_GT: return R_JZ_GT;
+    case R_EQ: return R_JZ_EQ;
+    case R_NEQ: return R_JZ_NEQ;
+    default:
+      break;
+  }
+  return MAX_REG_OP;
+}
+
+// translate a binary operator, fusing it with the conditional jump that follows it when possible.
+// returns true if the jump was consumed.
+static bool translate_binop(Translation* t, u32 op, const Code* next, bool next_is_target, size_t* target_depth) {
+  ASSERT(t->depth >= 2);
+  const size_t depth = t->depth - 2;
+  for (size_t i = depth; i < t->depth; ++i) {
+    if (t->stack[i].kind == OPERAND_ADDR) {
+      materialize(t, i);
+    }
+  }
+  Operand lhs = t->stack[depth];
+  Operand rhs = t->stack[depth + 1];
+  t->depth = depth;
+
+  size_t folded = 0;
+  if (lhs.kind == OPERAND_IMM && rhs.kind == OPERAND_IMM && fold_binop(op, lhs.value, rhs.value, &folded)) {
+    operand_push(t, OPERAND_IMM, folded);
+    return false;
+  }
+  if (lhs.kind == OPERAND_IMM) {
+    const u32 swapped = swap_binop(op);
+    if (swapped != MAX_REG_OP) {
+      Operand tmp = lhs;
+      lhs = rhs;
+      rhs = tmp;
+      op = swapped;
+    }
+    else {
+      lhs.value = operand_slot(t, depth);
+      lhs.kind = OPERAND_SLOT;
+    }
+  }
+
+  const u32 branch = branch_from_compare(op);
+  if (branch != MAX_REG_OP && next->op == C_JZ && !next_is_target) {
+    flush_all(t);
+    target_depth[next->a] = t->depth;
+    reg_emit(t, rhs.kind == OPERAND_IMM ? branch + (R_JZ_LTI - R_JZ_LT) : branch, lhs.value, next->a, rhs.value);
+    return true;
+  }
+
+  const size_t dest = reg_slot(t, depth);
+  reg_emit(t, rhs.kind == OPERAND_IMM ? REG_IMM_FORM(op) : op, dest, lhs.value, rhs.value);
+  operand_push(t, OPERAND_SLOT, dest);
+  return false;
+}
+
+static void translate_store(Translation* t, u32 size) {
+  static const u32 store_local[] = { [4] = R_STORE_LOCAL32, [2] = R_STORE_LOCAL16, [1] = R_STORE_LOCAL8, };
+  static const u32 store[] = { [8] = R_STORE64, [4] = R_STORE32, [2] = R_STORE16, [1] = R_STORE8, };
+  ASSERT(t->depth >= 2);
+  const size_t depth = t->depth - 2;
+  Operand addr = t->stack[depth];
+  Operand value = t->stack[depth + 1];
+  t->depth = depth;
+  flush_locals(t);
+  if (addr.kind == OPERAND_ADDR) {
+    if (size == sizeof(size_t) && value.kind == OPERAND_IMM) {
+      reg_emit(t, R_MOVI, addr.value, 0, value.value);
+      return;
+    }
+    const size_t src = operand_slot(t, depth + 1);
+    if (size == sizeof(size_t)) {
+      reg_emit(t, R_MOV, addr.value, 0, src);
+    }
+    else {
+      reg_emit(t, store_local[size], addr.value, 0, src);
+    }
+    return;
+  }
+  const size_t dest = operand_slot(t, depth);
+  const size_t src = operand_slot(t, depth + 1);
+  reg_emit(t, store[size], 0, dest, src);
+}
+
+static void translate_load(Translation* t, u32 size) {
+  static const u32 load_local[] = { [4] = R_LOAD_LOCAL32, [2] = R_LOAD_LOCAL16, [1] = R_LOAD_LOCAL8, };
+  static const u32 load[] = { [8] = R_LOAD64, [4] = R_LOAD32, [2] = R_LOAD16, [1] = R_LOAD8, };
+  const Operand addr = operand_pop(t);
+  const size_t depth = t->depth;
+  const size_t dest = reg_slot(t, depth);
+  if (addr.kind == OPERAND_ADDR) {
+    if (size == sizeof(size_t)) {
+      operand_push(t, OPERAND_SLOT, addr.value);
+      return;
+    }
+    reg_emit(t, load_local[size], dest, 0, addr.value);
+  }
+  else if (addr.kind == OPERAND_IMM) {
+    reg_emit(t, R_LOADG, dest, addr.value, mask_from_size(size));
+  }
+  else {
+    reg_emit(t, load[size], dest, 0, addr.value);
+  }
+  operand_push(t, OPERAND_SLOT, dest);
+}
+
+static void patch_frame_size(Translation* t, size_t begin_func) {
+  if (begin_func == NONE) {
+    return;
+  }
+  // one spare register receives the return value of calls made at the deepest point
+  t->p->reg_code[begin_func].a = t->frame_size + sizeof(size_t) * (t->max_depth + 1);
+}
+
+void prepare_registers(Program* p) {
+  ASSERT(p->code != NULL);
+  Translation* t = malloc(sizeof(Translation));
+  ASSERT(t != NULL);
+  memset(t, 0, sizeof(Translation));
+  t->p = p;
+  t->capacity = p->count * 2 + 1;
+  p->reg_code = malloc(t->capacity * sizeof(Code));
+  p->reg_index = malloc((p->count + 1) * sizeof(size_t));
+  bool* is_target = calloc(p->count + 1, sizeof(bool));
+  size_t* target_depth = malloc((p->count + 1) * sizeof(size_t));
+  ASSERT(p->reg_code != NULL && p->reg_index != NULL && is_target != NULL && target_depth != NULL);
+
+  for (size_t i = 0; i < p->count; ++i) {
+    const Code* code = &p->code[i];
+    ASSERT(code->op < C_ADD_LOCAL_IMM && "register code is translated from unfused code");
+    if (code->op == C_JMP || code->op == C_JZ) {
+      is_target[code->a] = true;
+    }
+    target_depth[i] = NONE;
+  }
+
+  size_t begin_func = NONE;
+  bool fallthrough = true;
+  for (size_t i = 0; i < p->count; ++i) {
+    const Code* code = &p->code[i];
+    if (is_target[i]) {
+      if (fallthrough) {
+        flush_all(t);
+      }
+      else {
+        t->depth = target_depth[i] != NONE ? target_depth[i] : 0;
+      }
+      for (size_t d = 0; d < t->depth; ++d) {
+        t->stack[d] = (Operand) { .kind = OPERAND_SLOT, .value = reg_slot(t, d), };
+      }
+    }
+    p->reg_index[i] = p->reg_count;
+    fallthrough = true;
+    const size_t depth = t->depth;
+    switch (code->op) {
+      case C_HALT:
+        reg_emit(t, R_HALT, 0, 0, 0);
+        fallthrough = false;
+        break;
+      case C_POP:
+        operand_pop(t);
+        break;
+      case C_MOVE_LOCAL:
+      case C_MOVE_LOCAL32:
+      case C_MOVE_LOCAL16:
+      case C_MOVE_LOCAL8: {
+        static const u32 store_local[] = { [C_MOVE_LOCAL32] = R_STORE_LOCAL32, [C_MOVE_LOCAL16] = R_STORE_LOCAL16, [C_MOVE_LOCAL8] = R_STORE_LOCAL8, };
+        const Operand value = operand_pop(t);
+        flush_locals(t);
+        if (code->op == C_MOVE_LOCAL && value.kind == OPERAND_IMM) {
+          reg_emit(t, R_MOVI, code->a, 0, value.value);
+          break;
+        }
+        const size_t src = operand_slot(t, depth - 1);
+        reg_emit(t, code->op == C_MOVE_LOCAL ? R_MOV : store_local[code->op], code->a, 0, src);
+        break;
+      }
+      case C_STORE64: translate_store(t, 8); break;
+      case C_STORE32: translate_store(t, 4); break;
+      case C_STORE16: translate_store(t, 2); break;
+      case C_STORE8: translate_store(t, 1); break;
+      case C_LOAD64: translate_load(t, 8); break;
+      case C_LOAD32: translate_load(t, 4); break;
+      case C_LOAD16: translate_load(t, 2); break;
+      case C_LOAD8: translate_load(t, 1); break;
+      case C_PUSH_LOCAL_ADDR_OF:
+        operand_push(t, OPERAND_ADDR, code->a);
+        break;
+      case C_PUSH_LOCAL:
+        operand_push(t, OPERAND_SLOT, code->a);
+        break;
+      case C_PUSH_LOCAL32:
+      case C_PUSH_LOCAL16:
+      case C_PUSH_LOCAL8: {
+        static const u32 load_local[] = { [C_PUSH_LOCAL32] = R_LOAD_LOCAL32, [C_PUSH_LOCAL16] = R_LOAD_LOCAL16, [C_PUSH_LOCAL8] = R_LOAD_LOCAL8, };
+        reg_emit(t, load_local[code->op], reg_slot(t, depth), 0, code->a);
+        operand_push(t, OPERAND_SLOT, reg_slot(t, depth));
+        break;
+      }
+      case C_PUSH_GLOBAL:
+        reg_emit(t, R_LOADG, reg_slot(t, depth), code->a, code->b);
+        operand_push(t, OPERAND_SLOT, reg_slot(t, depth));
+        break;
+      case C_PUSH_IMM:
+        operand_push(t, OPERAND_IMM, code->a);
+        break;
+      case C_ADD:
+      case C_SUB:
+      case C_MUL:
+      case C_LSHIFT:
+      case C_RSHIFT:
+      case C_DIV:
+      case C_DIVMOD:
+      case C_LT:
+      case C_GT:
+      case C_AND:
+      case C_OR:
+      case C_XOR:
+      case C_EQ:
+      case C_NEQ: {
+        static const u32 binop[] = {
+          [C_ADD] = R_ADD, [C_SUB] = R_SUB, [C_MUL] = R_MUL, [C_LSHIFT] = R_LSHIFT, [C_RSHIFT] = R_RSHIFT,
+          [C_DIV] = R_DIV, [C_DIVMOD] = R_DIVMOD, [C_LT] = R_LT, [C_GT] = R_GT, [C_AND] = R_AND,
+          [C_OR] = R_OR, [C_XOR] = R_XOR, [C_EQ] = R_EQ, [C_NEQ] = R_NEQ,
+        };
+        const bool next_is_target = i + 1 < p->count ? is_target[i + 1] : true;
+        if (translate_binop(t, binop[code->op], &p->code[i + 1], next_is_target, target_depth)) {
+          i += 1;
+          p->reg_index[i] = p->reg_index[i - 1];
+        }
+        break;
+      }
+      case C_LOGICAL_NOT:
+      case C_NOT: {
+        const Operand value = operand_pop(t);
+        if (value.kind == OPERAND_IMM) {
+          operand_push(t, OPERAND_IMM, code->op == C_NOT ? ~value.value : !value.value);
+          break;
+        }
+        const size_t src = operand_slot(t, depth - 1);
+        reg_emit(t, code->op == C_NOT ? R_NOT : R_LOGICAL_NOT, reg_slot(t, depth - 1), 0, src);
+        operand_push(t, OPERAND_SLOT, reg_slot(t, depth - 1));
+        break;
+      }
+      case C_RET: {
+        operand_pop(t);
+        const size_t src = operand_slot(t, depth - 1);
+        reg_emit(t, R_RET, 0, 0, src);
+        patch_frame_size(t, begin_func);
+        fallthrough = false;
+        break;
+      }
+      case C_NORET:
+        reg_emit(t, R_NORET, 0, 0, 0);
+        patch_frame_size(t, begin_func);
+        fallthrough = false;
+        break;
+      case C_PRINT: {
+        operand_pop(t);
+        reg_emit(t, R_PRINT, 0, 0, operand_slot(t, depth - 1));
+        break;
+      }
+      case C_CALL: {
+        flush_all(t);
+        ASSERT(depth >= code->c);
+        t->depth = depth - code->c;
+        reg_emit(t, R_CALL, code->c, code->a, reg_slot(t, t->depth));
+        if (code->b) {
+          operand_push(t, OPERAND_SLOT, reg_slot(t, t->depth));
+        }
+        break;
+      }
+      case C_ADDR_CALL:
+      case C_SYSCALL: {
+        flush_all(t);
+        ASSERT(depth >= code->c + 1);
+        t->depth = depth - code->c - 1;
+        reg_emit(t, code->op == C_SYSCALL ? R_SYSCALL : R_ADDR_CALL, code->c, reg_slot(t, depth - 1), reg_slot(t, t->depth));
+        if (code->op == C_SYSCALL || code->b) {
+          operand_push(t, OPERAND_SLOT, reg_slot(t, t->depth));
+        }
+        break;
+      }
+      case C_MEMCPY:
+      case C_MEMSET:
+      case C_STRLEN:
+      case C_ATOMIC_ADD:
+      case C_ATOMIC_CAS:
+      case C_THREAD_CLONE: {
+        // arguments go through registers the same way they do for calls
+        static const u32 intrinsic[] = {
+          [C_MEMCPY] = R_MEMCPY, [C_MEMSET] = R_MEMSET, [C_STRLEN] = R_STRLEN,
+          [C_ATOMIC_ADD] = R_ATOMIC_ADD, [C_ATOMIC_CAS] = R_ATOMIC_CAS, [C_THREAD_CLONE] = R_THREAD_CLONE,
+        };
+        static const u32 intrinsic_argc[] = { [C_STRLEN] = 1, [C_ATOMIC_ADD] = 2, [C_ATOMIC_CAS] = 3, [C_THREAD_CLONE] = 4, };
+        const bool is_memory = code->op == C_MEMCPY || code->op == C_MEMSET;
+        const u32 argc = is_memory ? (code->a == NONE ? 3 : 2) : intrinsic_argc[code->op];
+        flush_all(t);
+        ASSERT(depth >= argc);
+        t->depth = depth - argc;
+        reg_emit(t, intrinsic[code->op], argc, is_memory ? code->a : 0, reg_slot(t, t->depth));
+        if (!is_memory) {
+          operand_push(t, OPERAND_SLOT, reg_slot(t, t->depth));
+        }
+        break;
+      }
+      case C_JMP:
+        flush_all(t);
+        target_depth[code->a] = t->depth;
+        reg_emit(t, R_JMP, 0, code->a, 0);
+        fallthrough = false;
+        break;
+      case C_JZ: {
+        const Operand cond = operand_pop(t);
+        flush_all(t);
+        target_depth[code->a] = t->depth;
+        if (cond.kind == OPERAND_IMM) {
+          if (cond.value == 0) {
+            reg_emit(t, R_JMP, 0, code->a, 0);
+          }
+        }
+        else if (cond.kind == OPERAND_SLOT) {
+          reg_emit(t, R_JZ, 0, code->a, cond.value);
+        }
+        break;
+      }
+      case C_BEGIN_FUNC:
+        patch_frame_size(t, begin_func);
+        t->depth = 0;
+        t->max_depth = 0;
+        t->frame_size = code->a;
+        begin_func = p->reg_count;
+        reg_emit(t, R_BEGIN_FUNC, code->c, code->a, 0);
+        break;
+      default:
+        ASSERT(!"unhandled code op");
+        break;
+    }
+  }
+  p->reg_index[p->count] = p->reg_count;
+  reg_emit(t, R_HALT, 0, 0, 0);
+
+  for (size_t i = 0; i < p->reg_count; ++i) {
+    Code* code = &p->reg_code[i];
+    if (code->op == R_CALL || code->op == R_JMP || code->op == R_JZ || (code->op >= R_JZ_LT && code->op <= R_JZ_NEQI)) {
+      code->a = p->reg_index[code->a];
+    }
+  }
+
+  free(target_depth);
+  free(is_target);
+  free(t);
+}
+
+Result interpret_reg(Context* ctx, const Code* entry) {
+  Program* p = &ctx->program;
+  (void)reg_op_str;
+
+  static const void* dispatch_table[MAX_REG_OP] = {
+    [R_HALT]          = &&op_halt,
+    [R_MOV]           = &&op_mov,
+    [R_MOVI]          = &&op_movi,
+    [R_LEA]           = &&op_lea,
+    [R_LOADG]         = &&op_loadg,
+    [R_LOAD64]        = &&op_load64,
+    [R_LOAD32]        = &&op_load32,
+    [R_LOAD16]        = &&op_load16,
+    [R_LOAD8]         = &&op_load8,
+    [R_LOAD_LOCAL32]  = &&op_load_local32,
+    [R_LOAD_LOCAL16]  = &&op_load_local16,
+    [R_LOAD_LOCAL8]   = &&op_load_local8,
+    [R_STORE64]       = &&op_store64,
+    [R_STORE32]       = &&op_store32,
+    [R_STORE16]       = &&op_store16,
+    [R_STORE8]        = &&op_store8,
+    [R_STORE_LOCAL32] = &&op_store_local32,
+    [R_STORE_LOCAL16] = &&op_store_local16,
+    [R_STORE_LOCAL8]  = &&op_store_local8,
+    [R_ADD]           = &&op_add,
+    [R_SUB]           = &&op_sub,
+    [R_MUL]           = &&op_mul,
+    [R_LSHIFT]        = &&op_lshift,
+    [R_RSHIFT]        = &&op_rshift,
+    [R_DIV]           = &&op_div,
+    [R_DIVMOD]        = &&op_divmod,
+    [R_LT]            = &&op_lt,
+    [R_GT]            = &&op_gt,
+    [R_AND]           = &&op_and,
+    [R_OR]            = &&op_or,
+    [R_XOR]           = &&op_xor,
+    [R_EQ]            = &&op_eq,
+    [R_NEQ]           = &&op_neq,
+    [R_ADDI]          = &&op_addi,
+    [R_SUBI]          = &&op_subi,
+    [R_MULI]          = &&op_muli,
+    [R_LSHIFTI]       = &&op_lshifti,
+    [R_RSHIFTI]       = &&op_rshifti,
+    [R_DIVI]          = &&op_divi,
+    [R_DIVMODI]       = &&op_divmodi,
+    [R_LTI]           = &&op_lti,
+    [R_GTI]           = &&op_gti,
+    [R_ANDI]          = &&op_andi,
+    [R_ORI]           = &&op_ori,
+    [R_XORI]          = &&op_xori,
+    [R_EQI]           = &&op_eqi,
+    [R_NEQI]          = &&op_neqi,
+    [R_LOGICAL_NOT]   = &&op_logical_not,
+    [R_NOT]           = &&op_not,
+    [R_JMP]           = &&op_jmp,
+    [R_JZ]            = &&op_jz,
+    [R_JZ_LT]         = &&op_jz_lt,
+    [R_JZ_GT]         = &&op_jz_gt,
+    [R_JZ_EQ]         = &&op_jz_eq,
+    [R_JZ_NEQ]        = &&op_jz_neq,
+    [R_JZ_LTI]        = &&op_jz_lti,
+    [R_JZ_GTI]        = &&op_jz_gti,
+    [R_JZ_EQI]        = &&op_jz_eqi,
+    [R_JZ_NEQI]       = &&op_jz_neqi,
+    [R_CALL]          = &&op_call,
+    [R_ADDR_CALL]     = &&op_addr_call,
+    [R_SYSCALL]       = &&op_syscall,
+    [R_RET]           = &&op_ret,
+    [R_NORET]         = &&op_noret,
+    [R_BEGIN_FUNC]    = &&op_begin_func,
+    [R_PRINT]         = &&op_print,
+    [R_MEMCPY]        = &&op_memcpy,
+    [R_MEMSET]        = &&op_memset,
+    [R_STRLEN]        = &&op_strlen,
+    [R_ATOMIC_ADD]    = &&op_atomic_add,
+    [R_ATOMIC_CAS]    = &&op_atomic_cas,
+    [R_THREAD_CLONE]  = &&op_thread_clone,
+  };
+
+  if (UNLIKELY(!p->reg_threaded)) {
+    for (size_t i = 0; i < p->reg_count; ++i) {
+      p->reg_code[i].handler = dispatch_table[p->reg_code[i].op];
+    }
+    p->reg_threaded = true;
+  }
+
+  // same guest stack layout as interpret(), except that operands live in the registers of each frame
+  const size_t stack_size = ctx->stack_size;
+  const u8* stack_limit = ctx->stack + MIN(STACK_HEADROOM, stack_size / 2);
+
+  u8* sp = ctx->stack + stack_size; // bottom of the current frame
+  u8* fp = sp;
+
+  size_t frame_count = 0;
+  size_t frame_capacity = ctx->frame_capacity;
+  Frame* frames = ctx->frames;
+
+  Result result = Ok;
+  size_t rax = 0;
+  size_t args[MAX_FUNC_ARGC] = { ctx->thread_arg, };
+  const Code* ip = entry;
+
+  #define SLOT(TYPE, SLOT) (*(TYPE*)(fp - (SLOT)))
+
+  #undef DISPATCH
+  #define DISPATCH() do {                                                                                                      \
+    THINK(100);                                                                                                                \
+    tabs(frame_count);                                                                                                         \
+    verbose_printf("%4zu: %s: %u, %zu, %zu\n", (size_t)(ip - p->reg_code), reg_op_str[ip->op], ip->c, ip->a, ip->b);         \
+    goto *ip->handler;                                                                                                         \
+  } while (0)
+
+  #undef BRANCH_UNLESS
+  #define BRANCH_UNLESS(COND) do { \
+    if (COND) {                    \
+      NEXT();                      \
+    }                              \
+    ip = &p->reg_code[ip->a];      \
+    DISPATCH();                    \
+  } while (0)
+
+  #define REG_BINOP(EXPR) do {         \
+    size_t a = SLOT(size_t, ip->a);    \
+    size_t b = SLOT(size_t, ip->b);    \
+    SLOT(size_t, ip->c) = (size_t)(EXPR); \
+    NEXT();                            \
+  } while (0)
+
+  #define REG_BINOP_IMM(EXPR) do {     \
+    size_t a = SLOT(size_t, ip->a);    \
+    size_t b = ip->b;                  \
+    SLOT(size_t, ip->c) = (size_t)(EXPR); \
+    NEXT();                            \
+  } while (0)
+
+  #define ARGS_LOAD() do {                                                          \
+    for (size_t i = 0; i < ip->c; ++i) {                                            \
+      args[i] = SLOT(size_t, ip->b + sizeof(size_t) * (ip->c - 1 - i));             \
+    }                                                                               \
+  } while (0)
+
+  DISPATCH();
+
+op_mov:
+  SLOT(size_t, ip->c) = SLOT(size_t, ip->b);
+  NEXT();
+op_movi:
+  SLOT(size_t, ip->c) = ip->b;
+  NEXT();
+op_lea:
+  SLOT(size_t, ip->c) = (size_t)(fp - ip->b);
+  NEXT();
+op_loadg:
+  SLOT(size_t, ip->c) = *(size_t*)ip->a & ip->b;
+  NEXT();
+op_load64:
+  SLOT(size_t, ip->c) = *(size_t*)SLOT(size_t, ip->b);
+  NEXT();
+op_load32:
+  SLOT(size_t, ip->c) = *(u32*)SLOT(size_t, ip->b);
+  NEXT();
+op_load16:
+  SLOT(size_t, ip->c) = *(u16*)SLOT(size_t, ip->b);
+  NEXT();
+op_load8:
+  SLOT(size_t, ip->c) = *(u8*)SLOT(size_t, ip->b);
+  NEXT();
+op_load_local32:
+  SLOT(size_t, ip->c) = SLOT(u32, ip->b);
+  NEXT();
+op_load_local16:
+  SLOT(size_t, ip->c) = SLOT(u16, ip->b);
+  NEXT();
+op_load_local8:
+  SLOT(size_t, ip->c) = SLOT(u8, ip->b);
+  NEXT();
+op_store64:
+  *(size_t*)SLOT(size_t, ip->a) = SLOT(size_t, ip->b);
+  NEXT();
+op_store32:
+  *(u32*)SLOT(size_t, ip->a) = (u32)SLOT(size_t, ip->b);
+  NEXT();
+op_store16:
+  *(u16*)SLOT(size_t, ip->a) = (u16)SLOT(size_t, ip->b);
+  NEXT();
+op_store8:
+  *(u8*)SLOT(size_t, ip->a) = (u8)SLOT(size_t, ip->b);
+  NEXT();
+op_store_local32:
+  SLOT(u32, ip->c) = (u32)SLOT(size_t, ip->b);
+  NEXT();
+op_store_local16:
+  SLOT(u16, ip->c) = (u16)SLOT(size_t, ip->b);
+  NEXT();
+op_store_local8:
+  SLOT(u8, ip->c) = (u8)SLOT(size_t, ip->b);
+  NEXT();
+op_add:         REG_BINOP(a + b);
+op_sub:         REG_BINOP(a - b);
+op_mul:         REG_BINOP(a * b);
+op_lshift:      REG_BINOP(a << b);
+op_rshift:      REG_BINOP(a >> b);
+op_div:         REG_BINOP(a / b);
+op_divmod:      REG_BINOP(a % b);
+op_lt:          REG_BINOP((i64)a < (i64)b);
+op_gt:          REG_BINOP((i64)a > (i64)b);
+op_and:         REG_BINOP(a & b);
+op_or:          REG_BINOP(a | b);
+op_xor:         REG_BINOP(a ^ b);
+op_eq:          REG_BINOP(a == b);
+op_neq:         REG_BINOP(a != b);
+op_addi:        REG_BINOP_IMM(a + b);
+op_subi:        REG_BINOP_IMM(a - b);
+op_muli:        REG_BINOP_IMM(a * b);
+op_lshifti:     REG_BINOP_IMM(a << b);
+op_rshifti:     REG_BINOP_IMM(a >> b);
+op_divi:        REG_BINOP_IMM(a / b);
+op_divmodi:     REG_BINOP_IMM(a % b);
+op_lti:         REG_BINOP_IMM((i64)a < (i64)b);
+op_gti:         REG_BINOP_IMM((i64)a > (i64)b);
+op_andi:        REG_BINOP_IMM(a & b);
+op_ori:         REG_BINOP_IMM(a | b);
+op_xori:        REG_BINOP_IMM(a ^ b);
+op_eqi:         REG_BINOP_IMM(a == b);
+op_neqi:        REG_BINOP_IMM(a != b);
+op_logical_not:
+  SLOT(size_t, ip->c) = !SLOT(size_t, ip->b);
+  NEXT();
+op_not:
+  SLOT(size_t, ip->c) = ~SLOT(size_t, ip->b);
+  NEXT();
+op_jmp:
+  ip = &p->reg_code[ip->a];
+  DISPATCH();
+op_jz:                  BRANCH_UNLESS(SLOT(size_t, ip->b) != 0);
+op_jz_lt:               BRANCH_UNLESS(SLOT(i64, ip->c) < SLOT(i64, ip->b));
+op_jz_gt:               BRANCH_UNLESS(SLOT(i64, ip->c) > SLOT(i64, ip->b));
+op_jz_eq:               BRANCH_UNLESS(SLOT(size_t, ip->c) == SLOT(size_t, ip->b));
+op_jz_neq:              BRANCH_UNLESS(SLOT(size_t, ip->c) != SLOT(size_t, ip->b));
+op_jz_lti:              BRANCH_UNLESS(SLOT(i64, ip->c) < (i64)ip->b);
+op_jz_gti:              BRANCH_UNLESS(SLOT(i64, ip->c) > (i64)ip->b);
+op_jz_eqi:              BRANCH_UNLESS(SLOT(size_t, ip->c) == ip->b);
+op_jz_neqi:             BRANCH_UNLESS(SLOT(size_t, ip->c) != ip->b);
+op_call:
+  ARGS_LOAD();
+  FRAME_PUSH(ip);
+  ip = &p->reg_code[ip->a];
+  DISPATCH();
+op_addr_call: {
+  // function values are addresses into the stack code, map them over to the register code
+  const Code* target = (const Code*)SLOT(size_t, ip->a);
+  ARGS_LOAD();
+  FRAME_PUSH(ip);
+  ip = &p->reg_code[p->reg_index[target - p->code]];
+  DISPATCH();
+}
+op_syscall:
+  ARGS_LOAD();
+  if (UNLIKELY(SLOT(size_t, ip->a) == SYS_exit || SLOT(size_t, ip->a) == SYS_exit_group)) {
+    ctx->exited = true;
+    ctx->exit_code = (i32)args[0];
+    goto op_halt;
+  }
+  rax = syscall(SLOT(size_t, ip->a), args[0], args[1], args[2], args[3], args[4], args[5]);
+  SLOT(size_t, ip->b) = rax;
+  NEXT();
+op_ret:
+  rax = SLOT(size_t, ip->b);
+  // fallthrough
+op_noret:
+  sp = fp;
+  if (frame_count == 0) {
+    goto op_halt;
+  }
+  frame_count -= 1;
+  fp = frames[frame_count].fp;
+  ip = frames[frame_count].call;
+  // the return value lands in the lowest argument register of the call, which is free when there is none
+  SLOT(size_t, ip->b) = rax;
+  NEXT();
+op_begin_func:
+  fp = sp;
+  sp = fp - ip->a;
+  if (UNLIKELY(sp < stack_limit)) {
+    HOST_ENTER();
+    fprintf(stderr, "[interpreter-error]: stack overflow (%zu frames deep, stack size is %zu bytes)\n", frame_count, stack_size);
+    HOST_LEAVE();
+    result = Error;
+    goto op_halt;
+  }
+  for (size_t i = 0; i < ip->c; ++i) {
+    SLOT(size_t, sizeof(size_t) * (i + 1)) = args[i];
+  }
+  NEXT();
+op_print:
+  HOST_ENTER();
+  dprintf(STDOUT_FILENO, "%zu\n", SLOT(size_t, ip->b));
+  HOST_LEAVE();
+  NEXT();
+op_memcpy:
+  ARGS_LOAD();
+  memcpy((void*)args[0], (const void*)args[1], ip->a != NONE ? ip->a : args[2]);
+  NEXT();
+op_memset:
+  ARGS_LOAD();
+  memset((void*)args[0], (i32)args[1], ip->a != NONE ? ip->a : args[2]);
+  NEXT();
+op_strlen:
+  SLOT(size_t, ip->b) = strlen((const char*)SLOT(size_t, ip->b));
+  NEXT();
+op_atomic_add:
+  ARGS_LOAD();
+  SLOT(size_t, ip->b) = __atomic_fetch_add((size_t*)args[0], args[1], __ATOMIC_SEQ_CST);
+  NEXT();
+op_atomic_cas:
+  ARGS_LOAD();
+  __atomic_compare_exchange_n((size_t*)args[0], &args[1], args[2], false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  SLOT(size_t, ip->b) = args[1];
+  NEXT();
+op_thread_clone:
+  ARGS_LOAD();
+  SLOT(size_t, ip->b) = context_thread_clone(ctx, args);
+  NEXT();
+op_halt:
+  return result;
+}
+
+void program_free(Program* p) {
+  if (p->base) {
+    munmap(p->base, p->base_size);
+  }
+  else {
+    free(p->code);
+    free(p->data);
+  }
+  free(p->reg_code);
+  free(p->reg_index);
+  for (size_t i = 0; i < p->count; ++i) {
+    free(p->func_name[i]);
+  }
+  free(p->func_name);
+  free(p->ir_op);
+  free(p->ir_address);
+  if (p->profile) {
+    profile_free(p->profile);
+  }
+  if (p->jit) {
+    jit_free(p->jit);
+  }
+  memset(p, 0, sizeof(Program));
+}
+
+void module_free(Module* m) {
+  if (m->file) {
+    munmap(m->file, m->file_size);
+  }
+  memset(m, 0, sizeof(Module));
+}
+
+static u64 module_hash(const Module* m) {
+  u64 hash = 0xcbf29ce484222325;
+  for (size_t i = 0; i < m->file_size; ++i) {
+    hash = (hash ^ m->file[i]) * 0x100000001b3;
+  }
+  return hash;
+}
+
+// code index of a snapshot point, given as a function name or an ir address
+static size_t snapshot_point(const Program* p, const char* at) {
+  char* end = NULL;
+  const size_t ir_address = strtoull(at, &end, 10);
+  for (size_t i = 0; i < p->count; ++i) {
+    if (*end == 0 && end != at ? p->ir_address[i] >= ir_address : p->func_name[i] && !strcmp(p->func_name[i], at)) {
+      return i;
+    }
+  }
+  return NONE;
+}
+
+static void region_add(Context* ctx, u8* address, size_t size) {
+  if (ctx->region_count == ctx->region_capacity) {
+    ctx->region_capacity = MAX(ctx->region_capacity * 2, 16);
+    ctx->regions = realloc(ctx->regions, ctx->region_capacity * sizeof(Region));
+    ASSERT(ctx->regions != NULL);
+  }
+  ctx->regions[ctx->region_count++] = (Region) { .address = address, .size = size, };
+}
+
+// forget [address, address + size), splitting regions that are only partly unmapped
+static void region_remove(Context* ctx, u8* address, size_t size) {
+  u8* end = address + size;
+  for (size_t i = 0; i < ctx->region_count;) {
+    Region region = ctx->regions[i];
+    u8* region_end = region.address + region.size;
+    if (region_end <= address || region.address >= end) {
+      i += 1;
+      continue;
+    }
+    ctx->regions[i] = ctx->regions[--ctx->region_count];
+    if (region.address < address) {
+      region_add(ctx, region.address, address - region.address);
+    }
+    if (region_end > end) {
+      region_add(ctx, end, region_end - end);
+    }
+  }
+}
+
+// mmap, mremap and munmap of a program that is going to be snapshotted, so that its memory can be found and mapped back.
+// mappings without an address of their own are placed above the guest stack, where a resumed run reserves them again
+size_t context_map(Context* ctx, size_t code, const size_t* args) {
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  const size_t size = ALIGN(args[1], page_size);
+  if (code == SYS_mremap) {
+    const size_t new_size = ALIGN(args[2], page_size);
+    size_t flags = args[3];
+    u8* at = (u8*)args[4];
+    if ((flags & MREMAP_MAYMOVE) && !(flags & MREMAP_FIXED)) {
+      flags |= MREMAP_FIXED;
+      at = ctx->map_next;
+    }
+    const size_t result = syscall(SYS_mremap, args[0], args[1], args[2], flags, at);
+    if ((void*)result == MAP_FAILED) {
+      return result;
+    }
+    if ((u8*)result == ctx->map_next) {
+      ctx->map_next += new_size;
+    }
+    region_remove(ctx, (u8*)args[0], size);
+    region_add(ctx, (u8*)result, new_size);
+    return result;
+  }
+  if (code == SYS_munmap) {
+    const size_t result = syscall(SYS_munmap, args[0], args[1]);
+    if (result == 0) {
+      region_remove(ctx, (u8*)args[0], size);
+    }
+    return result;
+  }
+  u8* at = (u8*)args[0];
+  size_t flags = args[3];
+  if (!at) {
+    at = ctx->map_next;
+    flags |= MAP_FIXED_NOREPLACE;
+  }
+  const size_t result = syscall(SYS_mmap, at, args[1], args[2], flags, args[4], args[5]);
+  if ((void*)result == MAP_FAILED) {
+    return result;
+  }
+  if (!args[0]) {
+    ctx->map_next = (u8*)result + size;
+  }
+  region_remove(ctx, (u8*)result, size);
+  if (args[2] & PROT_READ) {
+    region_add(ctx, (u8*)result, size);
+  }
+  return result;
+}
+
+static Result write_all(i32 fd, const void* data, size_t size, size_t offset) {
+  while (size > 0) {
+    const ssize_t written = pwrite(fd, data, size, offset);
+    if (written <= 0) {
+      return Error;
+    }
+    data = (const u8*)data + written;
+    size -= written;
+    offset += written;
+  }
+  return Ok;
+}
+
+// static data, the used part of the guest stack and everything the guest has mapped, along with the registers and frames
+Result snapshot_write(Context* ctx, const Snapshot_state* state, const Frame* frames) {
+  Result result = Ok;
+  const Program* p = &ctx->program;
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  const char* path = ctx->options.snapshot_path;
+  const size_t region_count = 2 + ctx->region_count;
+  Snapshot_region* regions = malloc(region_count * sizeof(Snapshot_region));
+  ASSERT(regions != NULL);
+  u8* stack_end = ctx->stack + ctx->stack_size;
+  const u64 stack_start = state->sp - state->sp % page_size;
+  regions[0] = (Snapshot_region) { .address = (u64)p->data, .size = ALIGN((p->data_size + sizeof(size_t)), page_size), };
+  regions[1] = (Snapshot_region) { .address = stack_start, .size = (u64)stack_end - stack_start, };
+  for (size_t i = 0; i < ctx->region_count; ++i) {
+    regions[2 + i] = (Snapshot_region) { .address = (u64)ctx->regions[i].address, .size = ctx->regions[i].size, };
+  }
+  const Snapshot_header header = {
+    .magic = SNAPSHOT_MAGIC,
+    .version = SNAPSHOT_VERSION,
+    .module_hash = ctx->module_hash,
+    .fused = ctx->fused,
+    .code_count = p->count,
+    .stack_size = ctx->stack_size,
+    .map_next = (u64)ctx->map_next,
+    .state = *state,
+    .region_count = region_count,
+  };
+  const size_t frames_offset = sizeof(header) + region_count * sizeof(Snapshot_region);
+  size_t offset = ALIGN((frames_offset + state->frame_count * sizeof(Frame)), page_size);
+  for (size_t i = 0; i < region_count; ++i) {
+    regions[i].offset = offset;
+    offset += regions[i].size;
+  }
+
+  i32 fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    fprintf(stderr, "failed to open `%s`\n", path);
+    free(regions);
+    return Error;
+  }
+  if (
+    write_all(fd, &header, sizeof(header), 0) != Ok ||
+    write_all(fd, regions, region_count * sizeof(Snapshot_region), sizeof(header)) != Ok ||
+    write_all(fd, frames, state->frame_count * sizeof(Frame), frames_offset) != Ok
+  ) {
+    return_defer(Error);
+  }
+  for (size_t i = 0; i < region_count; ++i) {
+    if (write_all(fd, (const void*)regions[i].address, regions[i].size, regions[i].offset) != Ok) {
+      return_defer(Error);
+    }
+  }
+  fprintf(stderr, "snapshot written to `%s` (%zu bytes)\n", path, offset);
+defer:
+  if (result != Ok) {
+    fprintf(stderr, "failed to write snapshot to `%s`\n", path);
+  }
+  close(fd);
+  free(regions);
+  return result;
+}
+
+// maps a snapshot back to where it was taken from, pages are only read from the file once they are touched
+static Result snapshot_restore(Context* ctx, i32 fd, const Snapshot_header* header) {
+  Result result = Ok;
+  const Program* p = &ctx->program;
+  u8* stack_end = ctx->stack + ctx->stack_size;
+  const size_t frames_offset = sizeof(Snapshot_header) + header->region_count * sizeof(Snapshot_region);
+  Snapshot_region* regions = malloc(header->region_count * sizeof(Snapshot_region));
+  ASSERT(regions != NULL);
+  if (pread(fd, regions, header->region_count * sizeof(Snapshot_region), sizeof(Snapshot_header)) != (ssize_t)(header->region_count * sizeof(Snapshot_region))) {
+    return_defer(Error);
+  }
+  if (header->code_count != p->count || header->map_next < (u64)stack_end || header->state.ip < (u64)p->code || header->state.ip >= (u64)(p->code + p->count)) {
+    return_defer(Error);
+  }
+  // guest mappings live between the stack and map_next, that whole range is reserved before the saved regions go on top of it
+  ctx->map_next = (u8*)header->map_next;
+  if (ctx->map_next > stack_end) {
+    if (mmap(stack_end, ctx->map_next - stack_end, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0) != stack_end) {
+      return_defer(Error);
+    }
+  }
+  for (size_t i = 0; i < header->region_count; ++i) {
+    const Snapshot_region* region = &regions[i];
+    if (region->address < (u64)p->base || region->address + region->size > header->map_next || region->address + region->size < region->address) {
+      return_defer(Error);
+    }
+    if (region->size == 0) {
+      continue;
+    }
+    if (mmap((void*)region->address, region->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, region->offset) != (void*)region->address) {
+      return_defer(Error);
+    }
+  }
+  if (header->state.frame_count > ctx->frame_capacity) {
+    ctx->frame_capacity = header->state.frame_count;
+    ctx->frames = realloc(ctx->frames, ctx->frame_capacity * sizeof(Frame));
+    ASSERT(ctx->frames != NULL);
+  }
+  if (pread(fd, ctx->frames, header->state.frame_count * sizeof(Frame), frames_offset) != (ssize_t)(header->state.frame_count * sizeof(Frame))) {
+    return_defer(Error);
+  }
+  ctx->resume_state = header->state;
+  ctx->resume = &ctx->resume_state;
+defer:
+  free(regions);
+  return result;
+}
+
+Context* context_new(const Module* m, const Options* options) {
+  Context* ctx = calloc(1, sizeof(Context));
+  ASSERT(ctx != NULL);
+  ctx->options = *options;
+  ctx->snapshot_at = NONE;
+  ctx->owner = ctx;
+  pthread_mutex_init(&ctx->thread_lock, NULL);
+  Program* p = &ctx->program;
+  // the register code is translated from plain stack code, superinstructions would only hide operands from it.
+  // profiles are reported per source instruction, so they are also taken on unfused code
+  ctx->fused = options->fuse && options->engine == ENGINE_STACK && !options->profile_path;
+  size_t stack_size = options->stack_size;
+
+  // snapshots are resumed with the same code and layout they were taken with
+  Snapshot_header header = {0};
+  i32 snapshot_fd = -1;
+  if (options->resume_path) {
+    snapshot_fd = open(options->resume_path, O_RDONLY);
+    if (snapshot_fd < 0) {
+      fprintf(stderr, "failed to open `%s`\n", options->resume_path);
+      free(ctx);
+      return NULL;
+    }
+    if (pread(snapshot_fd, &header, sizeof(header), 0) != sizeof(header) || header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION) {
+      fprintf(stderr, "[interpreter-error]: `%s` is not a snapshot\n", options->resume_path);
+      close(snapshot_fd);
+      free(ctx);
+      return NULL;
+    }
+    if (header.module_hash != module_hash(m)) {
+      fprintf(stderr, "[interpreter-error]: `%s` is a snapshot of a different program\n", options->resume_path);
+      close(snapshot_fd);
+      free(ctx);
+      return NULL;
+    }
+    ctx->fused = header.fused;
+    stack_size = header.stack_size;
+  }
+  const bool fixed = options->resume_path || options->snapshot_path;
+  if (options->snapshot_path) {
+    ctx->module_hash = module_hash(m);
+  }
+
+  prepare_interpreter(m, p, ctx->fused, fixed ? (u8*)SNAPSHOT_BASE : NULL);
+  if (options->engine == ENGINE_REG) {
+    prepare_registers(p);
+  }
+  if (options->jit) {
+    p->jit = jit_new(p, options->jit_threshold);
+  }
+  if (options->profile_path) {
+    p->profile = profile_new(p, options->profile_path);
+  }
+
+  // pages of the guest stack are only backed by memory once they are touched
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  ctx->stack_size = ALIGN(MAX(stack_size, page_size), page_size);
+  u8* stack_at = fixed ? p->base + p->base_size : NULL;
+  u8* stack = mmap(stack_at, page_size + ctx->stack_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | (fixed ? MAP_FIXED_NOREPLACE : 0), -1, 0);
+  ASSERT(stack != MAP_FAILED && (!fixed || stack == stack_at));
+  mprotect(stack, page_size, PROT_NONE);
+  ctx->stack = stack + page_size;
+  ctx->frame_capacity = 64;
+  ctx->frames = malloc(ctx->frame_capacity * sizeof(Frame));
+  ASSERT(ctx->frames != NULL);
+  if (fixed) {
+    ctx->map_next = ctx->stack + ctx->stack_size;
+  }
+
+  if (options->snapshot_path) {
+    ctx->snapshot_at = snapshot_point(p, options->snapshot_at);
+    if (ctx->snapshot_at == NONE) {
+      fprintf(stderr, "[interpreter-error]: no function or ir address `%s` to take a snapshot at\n", options->snapshot_at);
+      context_free(ctx);
+      return NULL;
+    }
+  }
+  if (snapshot_fd >= 0) {
+    const Result result = snapshot_restore(ctx, snapshot_fd, &header);
+    close(snapshot_fd);
+    if (result != Ok) {
+      fprintf(stderr, "[interpreter-error]: failed to restore snapshot `%s`\n", options->resume_path);
+      context_free(ctx);
+      return NULL;
+    }
+  }
+  return ctx;
+}
+
+// ends the program of the top-level context `owner`: no more guest threads are started, and the running ones are
+// stopped, together with the thread running context_run() when `stop_host` is set
+static void context_stop(Context* owner, bool stop_host) {
+  pthread_mutex_lock(&owner->thread_lock);
+  owner->stopping = true;
+  const pthread_t self = pthread_self();
+  for (size_t i = 0; i < owner->thread_count; ++i) {
+    if (!pthread_equal(owner->threads[i], self)) {
+      pthread_kill(owner->threads[i], THREAD_STOP_SIGNAL);
+    }
+  }
+  if (stop_host && !pthread_equal(owner->host, self)) {
+    pthread_kill(owner->host, THREAD_STOP_SIGNAL);
+  }
+  pthread_mutex_unlock(&owner->thread_lock);
+}
+
+// stops the guest threads of `ctx` and waits for every one of them, so that none is left running on its program
+// or stacks once context_run() returns
+static void context_join(Context* ctx) {
+  context_stop(ctx, false);
+  // the list no longer changes once `stopping` is set
+  for (size_t i = 0; i < ctx->thread_count; ++i) {
+    pthread_join(ctx->threads[i], NULL);
+  }
+  ctx->thread_count = 0;
+  // a stop that one of them sent to this thread is delivered when the next syscall returns, which is made here so
+  // that it is only marked pending instead of being taken in a later run on this thread
+  sigset_t pending;
+  sigpending(&pending);
+}
+
+Result context_run(Context* ctx) {
+  Program* p = &ctx->program;
+  ctx->exited = false;
+  ctx->exit_code = 0;
+  if (p->entry == NONE) {
+    return Ok;
+  }
+  ctx->host = pthread_self();
+  ctx->stopping = false;
+  ctx->thread_exited = false;
+  jmp_buf exit_target;
+  jmp_buf* prev_exit_target = jit_exit_target;
+  jit_exit_target = &exit_target;
+  sigjmp_buf stop_target;
+  thread_host_depth = 0;
+  thread_stop_pending = 0;
+  volatile Result result = Ok;
+  if (sigsetjmp(stop_target, 1)) {
+    // stopped by a guest thread that ended the program, its exit code is taken below
+  }
+  else {
+    thread_stop_target = &stop_target;
+    if (setjmp(exit_target)) {
+      ctx->exited = true;
+      ctx->exit_code = jit_exit_code;
+    }
+    else if (ctx->options.engine == ENGINE_REG) {
+      result = interpret_reg(ctx, &p->reg_code[p->reg_index[p->entry]]);
+    }
+    else {
+      result = interpret(ctx, &p->code[p->entry]);
+    }
+  }
+  HOST_ENTER();
+  context_join(ctx);
+  thread_stop_target = NULL;
+  thread_stop_pending = 0;
+  thread_host_depth = 0;
+  if (ctx->thread_exited) {
+    result = ctx->thread_result;
+    ctx->exited = true;
+    ctx->exit_code = ctx->thread_exit_code;
+  }
+  jit_exit_target = prev_exit_target;
+  return result;
+}
+
+void context_free(Context* ctx) {
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  munmap(ctx->stack - page_size, page_size + ctx->stack_size);
+  if (ctx->map_next > ctx->stack + ctx->stack_size) {
+    munmap(ctx->stack + ctx->stack_size, ctx->map_next - (ctx->stack + ctx->stack_size));
+  }
+  free(ctx->regions);
+  free(ctx->frames);
+  if (!ctx->thread) {
+    program_free(&ctx->program);
+    pthread_mutex_destroy(&ctx->thread_lock);
+    free(ctx->threads);
+  }
+  free(ctx);
+}
+
+typedef struct Thread_start {
+  Context* ctx;
+  const Code* entry;
+  size_t flags;
+  u32* parent_tid;
+  u32* child_tid;
+  u32 tid;
+  u32 started; // futex the cloning thread waits on until the new thread has taken what it needs from here
+} Thread_start;
+
+static void* context_thread(void* data) {
+  thread_host_depth = 1; // a stop is only marked pending until the guest code starts
+  Thread_start* start = (Thread_start*)data;
+  Context* ctx = start->ctx;
+  Context* owner = ctx->owner;
+  const Code* entry = start->entry;
+  u32* child_tid = (start->flags & CLONE_CHILD_CLEARTID) ? start->child_tid : NULL;
+  start->tid = (u32)syscall(SYS_gettid);
+  if (start->flags & CLONE_PARENT_SETTID) {
+    __atomic_store_n(start->parent_tid, start->tid, __ATOMIC_SEQ_CST);
+  }
+  __atomic_store_n(&start->started, 1, __ATOMIC_SEQ_CST);
+  syscall(SYS_futex, &start->started, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+
+  Program* p = &ctx->program;
+  jmp_buf exit_target;
+  jit_exit_target = &exit_target;
+  sigjmp_buf stop_target;
+  volatile Result result = Ok;
+  volatile bool stopped = false;
+  if (sigsetjmp(stop_target, 1)) {
+    stopped = true;
+  }
+  else {
+    thread_stop_target = &stop_target;
+    HOST_LEAVE();
+    if (setjmp(exit_target)) {
+      ctx->exited = true;
+      ctx->exit_code = jit_exit_code;
+    }
+    else if (ctx->options.engine == ENGINE_REG) {
+      result = interpret_reg(ctx, &p->reg_code[p->reg_index[entry - p->code]]);
+    }
+    else {
+      result = interpret(ctx, entry);
+    }
+  }
+  HOST_ENTER();
+  // natively a guest thread only ends by returning from its function, exiting from one ends the whole program.
+  // only the program this thread belongs to is ended, context_run() of its owner reports how
+  if (!stopped && (result != Ok || ctx->exited)) {
+    pthread_mutex_lock(&owner->thread_lock);
+    if (!owner->thread_exited) {
+      owner->thread_exited = true;
+      owner->thread_result = result;
+      owner->thread_exit_code = result != Ok ? EXIT_FAILURE : ctx->exit_code;
+    }
+    pthread_mutex_unlock(&owner->thread_lock);
+    context_stop(owner, true);
+  }
+  context_free(ctx);
+  if (child_tid) {
+    __atomic_store_n(child_tid, 0, __ATOMIC_SEQ_CST);
+    syscall(SYS_futex, child_tid, FUTEX_WAKE, INT32_MAX, NULL, NULL, 0);
+  }
+  thread_stop_target = NULL;
+  return NULL;
+}
+
+static pthread_once_t thread_stop_once = PTHREAD_ONCE_INIT;
+
+static void thread_stop_install(void) {
+  struct sigaction action = {0};
+  action.sa_handler = thread_stop_handler;
+  sigemptyset(&action.sa_mask);
+  ASSERT(sigaction(THREAD_STOP_SIGNAL, &action, NULL) == 0);
+}
+
+// the clone that I_THREAD_CLONE does natively, args are <flags, stack, parent_tid, child_tid>. the stack holds the
+// function to run and its argument, which run on a new context that shares the program with `ctx` and gets a guest
+// stack of its own. the thread is kept on the top-level context until context_run() of that context joins it.
+// returns the thread id or a negative error, like the syscall
+size_t context_thread_clone(Context* ctx, const size_t* args) {
+  const Program* p = &ctx->program;
+  if (p->profile || ctx->snapshot_at != NONE || p->base) {
+    return (size_t)-ENOSYS;
+  }
+  pthread_once(&thread_stop_once, thread_stop_install);
+  HOST_ENTER();
+  Context* owner = ctx->owner;
+  Context* thread = calloc(1, sizeof(Context));
+  ASSERT(thread != NULL);
+  thread->program = *p;
+  thread->options = ctx->options;
+  thread->snapshot_at = NONE;
+  thread->fused = ctx->fused;
+  thread->thread = true;
+  thread->thread_arg = ((const size_t*)args[1])[1];
+  thread->owner = owner;
+
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  thread->stack_size = ctx->stack_size;
+  u8* stack = mmap(NULL, page_size + thread->stack_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (stack == MAP_FAILED) {
+    free(thread);
+    HOST_LEAVE();
+    return (size_t)-ENOMEM;
+  }
+  mprotect(stack, page_size, PROT_NONE);
+  thread->stack = stack + page_size;
+  thread->frame_capacity = 64;
+  thread->frames = malloc(thread->frame_capacity * sizeof(Frame));
+  ASSERT(thread->frames != NULL);
+  // the jit code buffer is made writable while compiling, which would pull it from under running threads
+  if (p->jit) {
+    p->jit->frozen = true;
+  }
+
+  Thread_start start = {
+    .ctx = thread,
+    .entry = (const Code*)((const size_t*)args[1])[0],
+    .flags = args[0],
+    .parent_tid = (u32*)args[2],
+    .child_tid = (u32*)args[3],
+    .tid = 0,
+    .started = 0,
+  };
+  // the thread is added under the lock, so that it is either stopped with the others or not started at all
+  pthread_mutex_lock(&owner->thread_lock);
+  i32 error = owner->stopping ? EAGAIN : 0;
+  if (!error && owner->thread_count == owner->thread_capacity) {
+    owner->thread_capacity = MAX(owner->thread_capacity * 2, 8);
+    owner->threads = realloc(owner->threads, owner->thread_capacity * sizeof(pthread_t));
+    ASSERT(owner->threads != NULL);
+  }
+  if (!error) {
+    error = pthread_create(&owner->threads[owner->thread_count], NULL, context_thread, &start);
+  }
+  if (!error) {
+    owner->thread_count += 1;
+  }
+  pthread_mutex_unlock(&owner->thread_lock);
+  if (error) {
+    context_free(thread);
+    HOST_LEAVE();
+    return (size_t)-error;
+  }
+  // a stop that arrives while waiting is only marked pending, `start` has to outlive the wait
+  while (!__atomic_load_n(&start.started, __ATOMIC_SEQ_CST)) {
+    syscall(SYS_futex, &start.started, FUTEX_WAIT_PRIVATE, 0, NULL, NULL, 0);
+  }
+  HOST_LEAVE();
+  return start.tid;
+}
+
+typedef struct Batch_job {
+  const Module* module;
+  const char* path;
+  Result result;
+  i32 exit_code;
+} Batch_job;
+
+typedef struct Batch {
+  Batch_job* jobs;
+  size_t job_count;
+  size_t next; // next job to be taken by a worker
+  const Options* options;
+} Batch;
+
+static void* batch_worker(void* data) {
+  Batch* batch = (Batch*)data;
+  for (;;) {
+    const size_t index = __atomic_fetch_add(&batch->next, 1, __ATOMIC_RELAXED);
+    if (index >= batch->job_count) {
+      break;
+    }
+    Batch_job* job = &batch->jobs[index];
+    Context* ctx = context_new(job->module, batch->options);
+    if (!ctx) {
+      job->result = Error;
+      continue;
+    }
+    job->result = context_run(ctx);
+    job->exit_code = ctx->exit_code;
+    context_free(ctx);
+  }
+  return NULL;
+}
+
+// runs every program `repeat` times on a pool of worker threads, each run in a context of its own.
+// modules are loaded once and shared between all runs of the same program.
+Result run_batch(const char** paths, size_t path_count, size_t repeat, size_t jobs, const Options* options) {
+  Result result = Ok;
+  Module* modules = calloc(path_count, sizeof(Module));
+  Batch batch = {
+    .jobs = calloc(path_count * repeat, sizeof(Batch_job)),
+    .job_count = 0,
+    .next = 0,
+    .options = options,
+  };
+  ASSERT(modules != NULL && batch.jobs != NULL);
+  for (size_t i = 0; i < path_count; ++i) {
+    if (module_load(paths[i], &modules[i]) != Ok) {
+      result = Error;
+      continue;
+    }
+    for (size_t n = 0; n < repeat; ++n) {
+      batch.jobs[batch.job_count++] = (Batch_job) { .module = &modules[i], .path = paths[i], .result = Ok, .exit_code = 0, };
+    }
+  }
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  jobs = MAX(MIN(jobs, batch.job_count), 1);
+  pthread_t* workers = malloc(jobs * sizeof(pthread_t));
+  ASSERT(workers != NULL);
+  for (size_t i = 0; i < jobs; ++i) {
+    ASSERT(pthread_create(&workers[i], NULL, batch_worker, &batch) == 0);
+  }
+  for (size_t i = 0; i < jobs; ++i) {
+    pthread_join(workers[i], NULL);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  size_t failed = 0;
+  for (size_t i = 0; i < batch.job_count; ++i) {
+    const Batch_job* job = &batch.jobs[i];
+    if (job->result != Ok || job->exit_code != 0) {
+      fprintf(stderr, "`%s` (run %zu) failed with exit code %d\n", job->path, i % repeat, job->result != Ok ? -1 : job->exit_code);
+      failed += 1;
+    }
+  }
+  const f64 elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  fprintf(stderr, "batch complete: %zu runs, %zu failed, %zu workers, %g s\n", batch.job_count, failed, jobs, elapsed);
+  if (failed > 0) {
+    result = Error;
+  }
+
+  free(workers);
+  free(batch.jobs);
+  for (size_t i = 0; i < path_count; ++i) {
+    module_free(&modules[i]);
+  }
+  free(modules);
+  return result;
 }
@@ -0,0 +1,64 @@
+#!/bin/sh
+# test_batch.sh
+# runs every program in tests/batch many times at once in the bytecode interpreter, on every engine, and checks
+# that each run ends with the exit code the program has natively
+#
+#   usage: ./test_batch.sh [runs] [jobs]
+#
+# environment:
+#   BATCH_DIR            where binaries go (.cache/batch)
+
+RUNS=${1:-50}
+JOBS=${2:-8}
+BATCH_DIR=${BATCH_DIR:-.cache/batch}
+SPL=./spl
+INTERPRETER=${BATCH_DIR}/interpreter
+FAILED=0
+
+mkdir -p ${BATCH_DIR}
+gcc interpreter/src/interpreter.c -o ${INTERPRETER} -Iinterpreter/include -Wall -O2 -pthread || exit 1
+
+# compiles a program natively and dumps its bytecode, both end up in the batch directory
+build() {
+  source=$1
+  name=$2
+  ${SPL} dump ${source} > /dev/null 2>&1 || return 1
+  mv -f $(basename ${source} .spl) ${BATCH_DIR}/${name} || return 1
+  mv -f ${source}.bin ${BATCH_DIR}/${name}.spl.bin
+}
+
+# every run has to fail with the native exit code, or none of them when it is 0
+check() {
+  name=$1
+  expected=$2
+  shift 2
+  expected_failed=$([ ${expected} -eq 0 ] && echo 0 || echo ${RUNS})
+  report=$(${INTERPRETER} "$@" --repeat ${RUNS} --jobs ${JOBS} ${BATCH_DIR}/${name}.spl.bin 2>&1 > /dev/null)
+  failed=$(echo "${report}" | grep -c "failed with exit code ${expected}\$")
+  if echo "${report}" | grep -q "^batch complete: ${RUNS} runs, ${expected_failed} failed" && [ ${failed} -eq ${expected_failed} ]; then
+    printf "%-24s %-14s ok\n" ${name} "$*"
+  else
+    printf "%-24s %-14s expected exit code %d from every run\n%s\n" ${name} "$*" ${expected} "${report}"
+    FAILED=$((FAILED + 1))
+  fi
+}
+
+for source in tests/batch/*.spl; do
+  name=$(basename ${source} .spl)
+  if ! build ${source} ${name}; then
+    printf "%-24s failed to build\n" ${name}
+    FAILED=$((FAILED + 1))
+    continue
+  fi
+  ${BATCH_DIR}/${name} > /dev/null 2>&1
+  expected=$?
+  check ${name} ${expected}
+  check ${name} ${expected} --engine reg
+  check ${name} ${expected} --jit
+done
+
+if [ ${FAILED} -ne 0 ]; then
+  echo "${FAILED} batch tests failed"
+  exit 1
+fi
+echo "batch tests passed"